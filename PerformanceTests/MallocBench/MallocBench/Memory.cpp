@@ -31,6 +31,8 @@
 #ifdef __APPLE__
 #include <mach/mach.h>
 #include <mach/task_info.h>
+#elif defined(__HAIKU__)
+#include <OS.h>
 #else
 #include <stdio.h>
 #include <unistd.h>
@@ -50,6 +52,23 @@ Memory currentMemoryBytes()
 
     memory.resident = vm_info.internal + vm_info.compressed - vm_info.purgeable_volatile_pmap;
     memory.residentMax = vm_info.resident_size_peak;
+#elif defined(__HAIKU__)
+    // There is no /proc on Haiku; sum the resident size of the team's areas
+    // instead. The kernel keeps no peak-RSS counter either, so the peak is
+    // tracked here across calls (the benchmarks sample at their high-water
+    // marks, which makes this a good approximation).
+    area_info info;
+    ssize_t cookie = 0;
+    size_t resident = 0;
+    while (get_next_area_info(B_CURRENT_TEAM, &cookie, &info) == B_OK)
+        resident += info.ram_size;
+
+    static size_t residentMax;
+    if (resident > residentMax)
+        residentMax = resident;
+
+    memory.resident = resident;
+    memory.residentMax = residentMax;
 #else
     FILE* file = fopen("/proc/self/status", "r");
 
@@ -1476,6 +1476,10 @@ public:
     {
         ASSERT(metadataTable.m_isFinalized);
         m_hasMetadata = metadataTable.m_hasMetadata;
+        // Carry the tier-up profile across launches, so code that optimized
+        // in a previous run starts out with the lowered JIT threshold from
+        // UnlinkedCodeBlock::thresholdForJIT() instead of rediscovering it.
+        m_didOptimize = metadataTable.m_didOptimize;
         if (!m_hasMetadata)
             return;
         m_is32Bit = metadataTable.m_is32Bit;
@@ -1499,6 +1503,7 @@ public:
         metadataTable->m_isLinked = false;
         metadataTable->m_hasMetadata = m_hasMetadata;
         metadataTable->m_numValueProfiles = m_numValueProfiles;
+        metadataTable->m_didOptimize = m_didOptimize;
         if (m_is32Bit) {
             for (unsigned i = UnlinkedMetadataTable::s_offsetTableEntries; i--;)
                 metadataTable->offsetTable32()[i] = m_metadata[i];
@@ -1512,6 +1517,7 @@ public:
 private:
     bool m_hasMetadata;
     bool m_is32Bit;
+    TriState m_didOptimize;
     unsigned m_numValueProfiles;
     std::array<unsigned, UnlinkedMetadataTable::s_offsetTableEntries> m_metadata;
 };
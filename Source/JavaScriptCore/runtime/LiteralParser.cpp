@@ -697,8 +697,23 @@ ALWAYS_INLINE TokenType LiteralParser<CharType>::Lexer::lex(LiteralParserToken<C
     m_currentTokenID++;
 #endif
 
-    while (m_ptr < m_end && isJSONWhiteSpace(*m_ptr))
-        ++m_ptr;
+    {
+        // Pretty-printed payloads are mostly indentation; skip whitespace runs
+        // a vector at a time, the same way lexString() scans string characters.
+        using UnsignedType = std::make_unsigned_t<CharType>;
+        constexpr auto spaceMask = SIMD::splat<UnsignedType>(' ');
+        constexpr auto tabMask = SIMD::splat<UnsignedType>('\t');
+        constexpr auto lineFeedMask = SIMD::splat<UnsignedType>('\n');
+        constexpr auto carriageReturnMask = SIMD::splat<UnsignedType>('\r');
+        auto vectorMatch = [&](auto input) ALWAYS_INLINE_LAMBDA {
+            auto whitespaces = SIMD::bitOr(SIMD::equal(input, spaceMask), SIMD::equal(input, tabMask), SIMD::equal(input, lineFeedMask), SIMD::equal(input, carriageReturnMask));
+            return SIMD::findFirstNonZeroIndex(SIMD::bitNot(whitespaces));
+        };
+        auto scalarMatch = [&](auto character) ALWAYS_INLINE_LAMBDA {
+            return !isJSONWhiteSpace(character);
+        };
+        m_ptr = SIMD::find(std::span { m_ptr, m_end }, vectorMatch, scalarMatch);
+    }
 
     ASSERT(m_ptr <= m_end);
     if (m_ptr == m_end) {
@@ -1229,14 +1244,17 @@ JSValue LiteralParser<CharType>::parseRecursively(VM& vm, uint8_t* stackLimit)
     auto scope = DECLARE_THROW_SCOPE(vm);
     TokenType type = m_lexer.currentToken()->type;
     if (type == TokLBracket) {
-        JSArray* array = constructEmptyArray(m_globalObject, nullptr);
-        RETURN_IF_EXCEPTION(scope, { });
         TokenType type = m_lexer.next();
         if (type == TokRBracket) {
             m_lexer.next();
+            JSArray* array = constructEmptyArray(m_globalObject, nullptr);
+            RETURN_IF_EXCEPTION(scope, { });
             return array;
         }
-        unsigned index = 0;
+        // Buffer the elements and create the array in one go once the length
+        // is known: a single right-sized butterfly allocation instead of
+        // growing through putDirectIndex() for every element.
+        MarkedArgumentBuffer elements;
         while (true) {
             JSValue value;
             if (type == TokLBrace || type == TokLBracket)
@@ -1247,8 +1265,11 @@ JSValue LiteralParser<CharType>::parseRecursively(VM& vm, uint8_t* stackLimit)
             if (UNLIKELY(!value))
                 return { };
 
-            array->putDirectIndex(m_globalObject, index++, value);
-            RETURN_IF_EXCEPTION(scope, { });
+            elements.append(value);
+            if (UNLIKELY(elements.hasOverflowed())) {
+                throwOutOfMemoryError(m_globalObject, scope);
+                return { };
+            }
 
             type = m_lexer.currentToken()->type;
             if (type == TokComma) {
@@ -1266,7 +1287,7 @@ JSValue LiteralParser<CharType>::parseRecursively(VM& vm, uint8_t* stackLimit)
             }
 
             m_lexer.next();
-            return array;
+            return constructArray(m_globalObject, static_cast<ArrayAllocationProfile*>(nullptr), elements);
         }
     }
 
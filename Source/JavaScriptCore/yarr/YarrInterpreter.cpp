@@ -2190,7 +2190,11 @@ public:
 
         freeDisjunctionContext(context);
 
-        pattern->m_allocator->stopAllocator();
+        // Keep a bounded amount of pool memory on the VM's allocator so that
+        // heavily-backtracking patterns do not remap their context pools on
+        // every match.
+        static constexpr size_t retainedPoolCapacity = 256 * KB;
+        pattern->m_allocator->stopAllocator(retainedPoolCapacity);
 
         ASSERT((result == JSRegExpResult::Match) == (output[0] != offsetNoMatch));
 
@@ -43,6 +43,13 @@
 #include <wtf/text/StringBuilder.h>
 #include <wtf/text/WTFString.h>
 
+#if OS(HAIKU)
+#include <wtf/Condition.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Threading.h>
+#include <wtf/Vector.h>
+#endif
+
 #if USE(CF)
 #include <CoreFoundation/CFString.h>
 #endif // USE(CF)
@@ -253,8 +260,11 @@ void WTFReportNotImplementedYet(const char* file, int line, const char* function
     printCallSite(file, line, function);
 }
 
+static void flushAsyncChannelLog();
+
 void WTFReportAssertionFailure(const char* file, int line, const char* function, const char* assertion)
 {
+    flushAsyncChannelLog();
     if (assertion)
         printf_stderr_common("ASSERTION FAILED: %s\n", assertion);
     else
@@ -264,6 +274,7 @@ void WTFReportAssertionFailure(const char* file, int line, const char* function,
 
 void WTFReportAssertionFailureWithMessage(const char* file, int line, const char* function, const char* assertion, const char* format, ...)
 {
+    flushAsyncChannelLog();
     va_list args;
     va_start(args, format);
     vprintf_stderr_with_prefix("ASSERTION FAILED: ", format, args);
@@ -395,6 +406,7 @@ bool WTFIsDebuggerAttached()
 
 void WTFReportFatalError(const char* file, int line, const char* function, const char* format, ...)
 {
+    flushAsyncChannelLog();
     va_list args;
     va_start(args, format);
     vprintf_stderr_with_prefix("FATAL ERROR: ", format, args);
@@ -456,6 +468,108 @@ static WTFLoggingAccumulator& loggingAccumulator()
     return *accumulator;
 }
 
+#if OS(HAIKU)
+
+// Hands formatted channel log lines to a background writer, so the logging
+// thread pays for the formatting only and never blocks on the unbuffered
+// stderr write. This keeps full channel logging cheap enough to leave
+// enabled in production without perturbing the timing it is observing.
+// Assertion, crash and WTFLogAlways output still writes synchronously:
+// that has to reach the log even when the process is about to die.
+class AsyncChannelLogWriter {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static AsyncChannelLogWriter& singleton()
+    {
+        static LazyNeverDestroyed<AsyncChannelLogWriter> writer;
+        static std::once_flag onceKey;
+        std::call_once(onceKey, [&] {
+            writer.construct();
+        });
+        return writer.get();
+    }
+
+    void append(CString&& line)
+    {
+        {
+            Locker locker { m_lock };
+            // Bound the backlog so a log storm degrades to dropped lines
+            // (reported on the next drain) instead of unbounded memory use.
+            if (m_pending.size() >= maximumPendingLines) {
+                ++m_droppedLines;
+                return;
+            }
+            m_pending.append(WTFMove(line));
+        }
+        m_condition.notifyOne();
+    }
+
+    // Called from assertion and fatal-error reporting so the backlog lands
+    // in the log ahead of the crash output it led up to.
+    void flush()
+    {
+        Vector<CString> lines;
+        unsigned dropped = 0;
+        {
+            Locker locker { m_lock };
+            lines = std::exchange(m_pending, { });
+            dropped = std::exchange(m_droppedLines, 0);
+        }
+        writeLines(lines, dropped);
+    }
+
+private:
+    friend class LazyNeverDestroyed<AsyncChannelLogWriter>;
+
+    AsyncChannelLogWriter()
+    {
+        Thread::create("WTF: ChannelLogWriter"_s, [this] {
+            drainLoop();
+        })->detach();
+    }
+
+    NO_RETURN void drainLoop()
+    {
+        while (true) {
+            Vector<CString> lines;
+            unsigned dropped = 0;
+            {
+                Locker locker { m_lock };
+                m_condition.wait(m_lock, [this]() WTF_REQUIRES_LOCK(m_lock) {
+                    return !m_pending.isEmpty() || m_droppedLines;
+                });
+                lines = std::exchange(m_pending, { });
+                dropped = std::exchange(m_droppedLines, 0);
+            }
+            writeLines(lines, dropped);
+        }
+    }
+
+    static void writeLines(const Vector<CString>& lines, unsigned dropped)
+    {
+        for (auto& line : lines)
+            fwrite(line.data(), 1, line.length(), stderr);
+        if (dropped)
+            fprintf(stderr, "Channel logging dropped %u line(s) under load\n", dropped);
+    }
+
+    static constexpr size_t maximumPendingLines = 16384;
+
+    Lock m_lock;
+    Condition m_condition;
+    Vector<CString> m_pending WTF_GUARDED_BY_LOCK(m_lock);
+    unsigned m_droppedLines WTF_GUARDED_BY_LOCK(m_lock) { 0 };
+};
+
+#endif // OS(HAIKU)
+
+static void flushAsyncChannelLog()
+{
+#if OS(HAIKU)
+    AsyncChannelLogWriter::singleton().flush();
+#endif
+}
+
 void WTFSetLogChannelLevel(WTFLogChannel* channel, WTFLogLevel level)
 {
     channel->level = level;
@@ -491,7 +605,16 @@ static void WTFLogVaList(WTFLogChannel* channel, const char* format, va_list arg
         return;
 
     if (channel->state == WTFLogChannelState::On) {
+#if OS(HAIKU)
+ALLOW_NONLITERAL_FORMAT_BEGIN
+        String line = WTF::createWithFormatAndArguments(format, args);
+ALLOW_NONLITERAL_FORMAT_END
+        if (!line.endsWith('\n'))
+            line = makeString(line, '\n');
+        AsyncChannelLogWriter::singleton().append(line.utf8());
+#else
         vprintf_stderr_with_trailing_newline(format, args);
+#endif
         return;
     }
 
@@ -551,6 +674,7 @@ void WTFLogAlways(const char* format, ...)
 
 void WTFLogAlwaysAndCrash(const char* format, ...)
 {
+    flushAsyncChannelLog();
     va_list args;
     va_start(args, format);
     WTFLogAlwaysV(format, args);
@@ -127,14 +127,22 @@ private:
         return nullptr;
     }
 
-    void shrink()
+    // Rewinds all pools and destroys chained pools beyond the first, except
+    // that up to 'retainedCapacity' bytes worth of chained pools are kept
+    // around (rewound) for reuse by the next allocation cycle.
+    void shrink(size_t retainedCapacity = 0)
     {
         ASSERT(!m_previous);
         m_current = m_start;
-        while (m_next) {
-            BumpPointerPool* nextNext = m_next->m_next;
-            m_next->destroy();
-            m_next = nextNext;
+        BumpPointerPool* lastRetained = this;
+        while (lastRetained->m_next && lastRetained->m_next->m_allocation.size() <= retainedCapacity) {
+            lastRetained = lastRetained->m_next;
+            retainedCapacity -= lastRetained->m_allocation.size();
+            lastRetained->m_current = lastRetained->m_start;
+        }
+        while (BumpPointerPool* next = lastRetained->m_next) {
+            lastRetained->m_next = next->m_next;
+            next->destroy();
         }
     }
 
@@ -239,10 +247,10 @@ public:
         return m_head;
     }
 
-    void stopAllocator()
+    void stopAllocator(size_t retainedCapacity = 0)
     {
         if (m_head)
-            m_head->shrink();
+            m_head->shrink(retainedCapacity);
     }
 
 private:
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <wtf/Function.h>
+#include <wtf/Noncopyable.h>
+
+namespace WTF {
+
+#if ENABLE(PERFORMANCE_COUNTERS)
+
+// A named, process-wide event counter cheap enough to leave in hot paths:
+// incrementing is a single relaxed atomic add, with no branch and no lock.
+// Counters are declared as namespace-scope statics through the
+// PERFORMANCE_COUNTER macros below, register themselves in a global list
+// during static initialization (single-threaded, so the list head needs no
+// locking), and live for the life of the process. Values are cumulative;
+// consumers sample and diff.
+class PerformanceCounter {
+    WTF_MAKE_NONCOPYABLE(PerformanceCounter);
+public:
+    WTF_EXPORT_PRIVATE explicit PerformanceCounter(const char* name);
+
+    void add(uint64_t count) { m_value.fetch_add(count, std::memory_order_relaxed); }
+    void increment() { add(1); }
+
+    const char* name() const { return m_name; }
+    uint64_t value() const { return m_value.load(std::memory_order_relaxed); }
+
+    // Visits every registered counter, in no particular order.
+    WTF_EXPORT_PRIVATE static void forEach(const Function<void(const PerformanceCounter&)>&);
+
+private:
+    const char* m_name;
+    std::atomic<uint64_t> m_value { 0 };
+    PerformanceCounter* m_next { nullptr };
+};
+
+// Declares a counter at namespace scope (so incrementing carries no
+// first-use guard) and increments it. The declaration goes in exactly one
+// translation unit, next to the code it counts.
+#define PERFORMANCE_COUNTER(identifier, name) \
+    static WTF::PerformanceCounter identifier(name)
+#define PERFORMANCE_COUNTER_INCREMENT(identifier) \
+    (identifier).increment()
+#define PERFORMANCE_COUNTER_ADD(identifier, count) \
+    (identifier).add(count)
+
+#else
+
+#define PERFORMANCE_COUNTER(identifier, name)
+#define PERFORMANCE_COUNTER_INCREMENT(identifier) ((void)0)
+#define PERFORMANCE_COUNTER_ADD(identifier, count) ((void)0)
+
+#endif // ENABLE(PERFORMANCE_COUNTERS)
+
+}
+
+#if ENABLE(PERFORMANCE_COUNTERS)
+using WTF::PerformanceCounter;
+#endif
@@ -434,6 +434,18 @@
 #define ENABLE_PENCIL_HOVER 0
 #endif
 
+/* Cheap always-on instrumentation counters in the style/layout hot paths
+   (see wtf/PerformanceCounter.h). The signpost instrumentation upstream
+   uses for this is Darwin-only; on Haiku a counter is one relaxed atomic
+   add, so production builds ship with them enabled. */
+#if !defined(ENABLE_PERFORMANCE_COUNTERS) && OS(HAIKU)
+#define ENABLE_PERFORMANCE_COUNTERS 1
+#endif
+
+#if !defined(ENABLE_PERFORMANCE_COUNTERS)
+#define ENABLE_PERFORMANCE_COUNTERS 0
+#endif
+
 #if !defined(ENABLE_PERIODIC_MEMORY_MONITOR)
 #define ENABLE_PERIODIC_MEMORY_MONITOR 0
 #endif
@@ -462,6 +474,10 @@
 #define ENABLE_REMOTE_LAYER_TREE_ON_MAC_BY_DEFAULT 0
 #endif
 
+#if !defined(ENABLE_RESOURCE_USAGE) && OS(HAIKU)
+#define ENABLE_RESOURCE_USAGE 1
+#endif
+
 #if !defined(ENABLE_RESOURCE_USAGE)
 #define ENABLE_RESOURCE_USAGE 0
 #endif
@@ -706,6 +722,17 @@
 
 #endif /* !defined(ENABLE_DFG_JIT) && ENABLE(JIT) */
 
+#if !defined(ENABLE_FTL_JIT) && ENABLE(DFG_JIT)
+
+/* Enable the FTL JIT on Haiku x86_64. The pieces it depends on are already
+   there for the DFG: machine-context access (HAVE_MACHINE_CONTEXT above) and
+   the signal-based VM traps that follow from it. */
+#if CPU(X86_64) && OS(HAIKU)
+#define ENABLE_FTL_JIT 1
+#endif
+
+#endif /* !defined(ENABLE_FTL_JIT) && ENABLE(DFG_JIT) */
+
 #if ENABLE(DFG_JIT) && ASSERT_ENABLED
 #define ENABLE_DFG_DOES_GC_VALIDATION 1
 #else
@@ -760,6 +787,26 @@
 #define ENABLE_WEBASSEMBLY 1
 #endif
 
+/* Enable WebAssembly on Haiku x86_64. The fault signal handler and the 4GB
+   signaling-memory reservation both work there: SIGSEGV/SIGBUS handlers go
+   through wtf/threads/Signals.cpp and MachineContext.h, which carry Haiku
+   branches, and the reservation is plain POSIX mmap. */
+#if !defined(ENABLE_WEBASSEMBLY) && OS(HAIKU) && CPU(X86_64) && !ENABLE(C_LOOP)
+#define ENABLE_WEBASSEMBLY 1
+#endif
+
+/* With B3 built for the FTL, the Haiku x86_64 build can run the wasm
+   optimizing tiers too; modules start on LLInt and hot functions are
+   promoted to BBQ and then OMG on the compilation worklist threads. */
+#if ENABLE(WEBASSEMBLY) && ENABLE(B3_JIT) && OS(HAIKU) && CPU(X86_64)
+#if !defined(ENABLE_WEBASSEMBLY_OMGJIT)
+#define ENABLE_WEBASSEMBLY_OMGJIT 1
+#endif
+#if !defined(ENABLE_WEBASSEMBLY_BBQJIT)
+#define ENABLE_WEBASSEMBLY_BBQJIT 1
+#endif
+#endif
+
 /* The SamplingProfiler is the probabilistic and low-overhead profiler used by
  * JSC to measure where time is spent inside a JavaScript program.
  * In configurations other than Windows and Darwin, because layout of mcontext_t depends on standard libraries (like glibc),
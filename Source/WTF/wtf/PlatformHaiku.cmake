@@ -14,6 +14,7 @@ posix/CPUTimePOSIX.cpp
     haiku/CurrentProcessMemoryStatus.cpp
     haiku/MemoryFootprintHaiku.cpp
     haiku/FileSystemHaiku.cpp
+    haiku/TraceRecorderHaiku.cpp
 
     unicode/icu/CollatorICU.cpp
 
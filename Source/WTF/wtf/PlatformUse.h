@@ -265,7 +265,7 @@
 #define USE_UICONTEXTMENU 1
 #endif
 
-#if PLATFORM(IOS_FAMILY) || (!USE(SYSTEM_MALLOC) && (OS(LINUX) && (PLATFORM(GTK) || PLATFORM(WPE))))
+#if PLATFORM(IOS_FAMILY) || (!USE(SYSTEM_MALLOC) && ((OS(LINUX) && (PLATFORM(GTK) || PLATFORM(WPE))) || OS(HAIKU)))
 #define USE_BMALLOC_MEMORY_FOOTPRINT_API 1
 #endif
 
@@ -200,6 +200,10 @@ void RunLoop::threadWillExit()
     {
         Locker locker { m_nextIterationLock };
         m_nextIteration.clear();
+#if USE(HAIKU_EVENT_LOOP)
+        for (auto& lane : m_dispatchLanes)
+            lane.clear();
+#endif
     }
 }
 
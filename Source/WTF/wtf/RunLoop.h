@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include <array>
 #include <functional>
 #include <wtf/Condition.h>
 #include <wtf/Deque.h>
@@ -54,7 +55,6 @@
 
 #if USE(HAIKU_EVENT_LOOP)
 class BHandler;
-class BMessageRunner;
 class BLooper;
 #endif
 
@@ -130,6 +130,27 @@ public:
     WTF_EXPORT_PRIVATE static void setWakeUpCallback(WTF::Function<void()>&&);
 #endif
 
+#if USE(HAIKU_EVENT_LOOP)
+    // File descriptor readiness source. A shared watcher thread waits on
+    // all registered descriptors at once (wait_for_objects) and invokes
+    // the callback on this loop; the watch stays disarmed until the
+    // callback has run, so a busy descriptor produces one wakeup per
+    // serviced batch instead of one per packet.
+    enum class FileDescriptorEvent { Read, Write };
+    WTF_EXPORT_PRIVATE void watchFileDescriptor(int fd, FileDescriptorEvent, Function<void()>&&);
+    WTF_EXPORT_PRIVATE void unwatchFileDescriptor(int fd);
+
+    // Priority lanes for dispatched functions, mirroring the GSource
+    // priorities the GLib port gives its sources. Each loop turn drains a
+    // bounded batch, higher lanes first, and reposts itself while work
+    // remains, so native messages (input, timer fires) interleave with a
+    // burst of queued callbacks instead of waiting out the whole backlog.
+    // Plain dispatch() lands in the Default lane; Idle runs only when
+    // every other lane is empty.
+    enum class DispatchPriority : uint8_t { Input, Rendering, Default, Idle };
+    WTF_EXPORT_PRIVATE void dispatch(DispatchPriority, Function<void()>&&);
+#endif
+
 #if USE(WINDOWS_EVENT_LOOP)
     static void registerRunLoopMessageWindowClass();
 #endif
@@ -174,9 +195,19 @@ public:
         bool m_isRepeating { false };
         Seconds m_interval { 0 };
 #elif USE(HAIKU_EVENT_LOOP)
-        BMessageRunner* m_messageRunner;
-        void timerFired();
+        void timerFired(uint32_t generation);
         friend class LoopHandler;
+        friend class TimerService;
+
+        // Scheduled through the shared TimerService deadline heap. The
+        // generation distinguishes the current schedule from 'tmrf'
+        // messages left over from an earlier one. All fields are guarded
+        // by the TimerService lock; times are in microseconds.
+        int64_t m_fireTime { 0 };
+        int64_t m_fireInterval { 0 };
+        uint32_t m_generation { 0 };
+        bool m_repeating { false };
+        bool m_isActive { false };
 #elif USE(GENERIC_EVENT_LOOP)
         bool isActiveWithLock() const WTF_REQUIRES_LOCK(m_runLoop->m_loopLock);
         void stopWithLock() WTF_REQUIRES_LOCK(m_runLoop->m_loopLock);
@@ -263,9 +294,16 @@ private:
     GRefPtr<GSource> m_source;
     WeakHashSet<Observer> m_observers;
 #elif USE(HAIKU_EVENT_LOOP)
+    void performWorkBatched();
+    bool takeFunctionsForNextTurn() WTF_REQUIRES_LOCK(m_nextIterationLock);
+
     BHandler* m_handler;
     BLooper* m_looper;
+    // Input, Rendering, and Idle lanes; the Default lane is m_nextIteration
+    // so the shared dispatch() path stays untouched.
+    std::array<Deque<Function<void()>>, 3> m_dispatchLanes WTF_GUARDED_BY_LOCK(m_nextIterationLock);
     friend class LoopHandler;
+    friend class TimerService;
 #elif USE(GENERIC_EVENT_LOOP)
     void scheduleWithLock(TimerBase::ScheduledTask&) WTF_REQUIRES_LOCK(m_loopLock);
     void unscheduleWithLock(TimerBase::ScheduledTask&) WTF_REQUIRES_LOCK(m_loopLock);
@@ -29,33 +29,56 @@
 #include <wtf/HashMap.h>
 #include <wtf/ScopedLambda.h>
 #include <wtf/StdLibExtras.h>
+#include <wtf/Vector.h>
 
 namespace WTF {
 
-// This is a map optimized for holding 0 or 1 items with no hashing or allocations in those cases.
-template<typename Key, typename Value>
+// This is a map optimized for holding few items with no hashing or allocations in those cases.
+// Up to inlineCapacity entries are kept in a linear-scan array inside the object; the map
+// promotes itself to a full HashMap the first time it outgrows that, and never demotes.
+template<typename Key, typename Value, unsigned inlineCapacity = 1>
 class SmallMap {
 public:
     using Pair = KeyValuePair<Key, Value>;
     using Map = HashMap<Key, Value>;
-    using Storage = std::variant<std::monostate, Pair, Map>;
+    using Inline = Vector<Pair, inlineCapacity>;
+    using Storage = std::conditional_t<inlineCapacity == 1, std::variant<std::monostate, Pair, Map>, std::variant<Inline, Map>>;
 
-    static_assert(sizeof(Pair) <= 4 * sizeof(uint64_t), "Don't use SmallMap with large types. It probably wastes memory.");
+    static_assert(inlineCapacity >= 1);
+    static_assert(inlineCapacity * sizeof(Pair) <= 16 * sizeof(uint64_t), "Don't use SmallMap with large inline storage. It probably wastes memory.");
 
     Value& ensure(const Key& key, const auto& functor)
     {
         ASSERT(Map::isValidKey(key));
-        if (std::holds_alternative<std::monostate>(m_storage)) {
-            m_storage = Pair { key, functor() };
-            return std::get<Pair>(m_storage).value;
-        }
-        if (auto* pair = std::get_if<Pair>(&m_storage)) {
-            if (pair->key == key)
-                return pair->value;
-            Map map;
-            map.add(WTFMove(pair->key), WTFMove(pair->value));
-            m_storage = WTFMove(map);
-            return std::get<Map>(m_storage).add(key, functor()).iterator->value;
+        if constexpr (inlineCapacity == 1) {
+            if (std::holds_alternative<std::monostate>(m_storage)) {
+                m_storage = Pair { key, functor() };
+                return std::get<Pair>(m_storage).value;
+            }
+            if (auto* pair = std::get_if<Pair>(&m_storage)) {
+                if (pair->key == key)
+                    return pair->value;
+                Map map;
+                map.add(WTFMove(pair->key), WTFMove(pair->value));
+                m_storage = WTFMove(map);
+                return std::get<Map>(m_storage).add(key, functor()).iterator->value;
+            }
+        } else {
+            if (auto* entries = std::get_if<Inline>(&m_storage)) {
+                for (auto& pair : *entries) {
+                    if (pair.key == key)
+                        return pair.value;
+                }
+                if (entries->size() < inlineCapacity) {
+                    entries->append(Pair { key, functor() });
+                    return entries->last().value;
+                }
+                Map map;
+                for (auto& pair : *entries)
+                    map.add(WTFMove(pair.key), WTFMove(pair.value));
+                m_storage = WTFMove(map);
+                return std::get<Map>(m_storage).add(key, functor()).iterator->value;
+            }
         }
         return std::get<Map>(m_storage).ensure(key, functor).iterator->value;
     }
@@ -63,20 +86,43 @@ public:
     void remove(const Key& key)
     {
         ASSERT(Map::isValidKey(key));
-        if (auto* pair = std::get_if<Pair>(&m_storage)) {
-            if (pair->key == key)
-                m_storage = std::monostate { };
-        } else if (auto* map = std::get_if<Map>(&m_storage))
+        if constexpr (inlineCapacity == 1) {
+            if (auto* pair = std::get_if<Pair>(&m_storage)) {
+                if (pair->key == key)
+                    m_storage = std::monostate { };
+                return;
+            }
+        } else {
+            if (auto* entries = std::get_if<Inline>(&m_storage)) {
+                entries->removeFirstMatching([&] (auto& pair) {
+                    return pair.key == key;
+                });
+                return;
+            }
+        }
+        if (auto* map = std::get_if<Map>(&m_storage))
             map->remove(key);
     }
 
     const Value* get(const Key& key) const
     {
         ASSERT(Map::isValidKey(key));
-        if (auto* pair = std::get_if<Pair>(&m_storage)) {
-            if (pair->key == key)
-                return std::addressof(pair->value);
-        } else if (auto* map = std::get_if<Map>(&m_storage)) {
+        if constexpr (inlineCapacity == 1) {
+            if (auto* pair = std::get_if<Pair>(&m_storage)) {
+                if (pair->key == key)
+                    return std::addressof(pair->value);
+                return nullptr;
+            }
+        } else {
+            if (auto* entries = std::get_if<Inline>(&m_storage)) {
+                for (auto& pair : *entries) {
+                    if (pair.key == key)
+                        return std::addressof(pair.value);
+                }
+                return nullptr;
+            }
+        }
+        if (auto* map = std::get_if<Map>(&m_storage)) {
             if (auto it = map->find(key); it != map->end())
                 return std::addressof(it->value);
         }
@@ -85,24 +131,42 @@ public:
 
     void forEach(const auto& callback) const
     {
-        switchOn(m_storage, [&] (const std::monostate&) {
-        }, [&] (const Pair& pair) {
-            callback(pair.key, pair.value);
-        }, [&] (const Map& map) {
-            for (auto& [key, value] : map)
-                callback(key, value);
-        });
+        if constexpr (inlineCapacity == 1) {
+            switchOn(m_storage, [&] (const std::monostate&) {
+            }, [&] (const Pair& pair) {
+                callback(pair.key, pair.value);
+            }, [&] (const Map& map) {
+                for (auto& [key, value] : map)
+                    callback(key, value);
+            });
+        } else {
+            switchOn(m_storage, [&] (const Inline& entries) {
+                for (auto& pair : entries)
+                    callback(pair.key, pair.value);
+            }, [&] (const Map& map) {
+                for (auto& [key, value] : map)
+                    callback(key, value);
+            });
+        }
     }
 
     size_t size() const
     {
-        return switchOn(m_storage, [&] (const std::monostate&) {
-            return 0u;
-        }, [&] (const Pair&) {
-            return 1u;
-        }, [&] (const Map& map) {
-            return map.size();
-        });
+        if constexpr (inlineCapacity == 1) {
+            return switchOn(m_storage, [&] (const std::monostate&) {
+                return 0u;
+            }, [&] (const Pair&) {
+                return 1u;
+            }, [&] (const Map& map) {
+                return map.size();
+            });
+        } else {
+            return switchOn(m_storage, [&] (const Inline& entries) {
+                return static_cast<unsigned>(entries.size());
+            }, [&] (const Map& map) {
+                return map.size();
+            });
+        }
     }
 
     const Storage& rawStorage() const { return m_storage; }
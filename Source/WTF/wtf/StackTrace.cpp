@@ -37,6 +37,12 @@
 #include <wtf/NeverDestroyed.h>
 #endif
 
+#if OS(HAIKU)
+#include <image.h>
+#include <stdio.h>
+#include <string.h>
+#endif
+
 void WTFGetBacktrace(void** stack, int* size)
 {
 #if HAVE(BACKTRACE)
@@ -144,6 +150,25 @@ auto StackTraceSymbolResolver::demangle(void* pc) -> std::optional<DemangleEntry
     }
     if (mangledName || cxaDemangled)
         return DemangleEntry { mangledName, cxaDemangled };
+#if OS(HAIKU)
+    // dladdr() only knows exported symbols. For everything else, name the
+    // containing image and the offset into its text segment, which
+    // addr2line can resolve offline against the matching binary. This is
+    // what makes the sampling profiler's mixed-mode stacks readable.
+    image_info info;
+    int32 cookie = 0;
+    while (get_next_image_info(B_CURRENT_TEAM, &cookie, &info) == B_OK) {
+        if (pc < info.text || pc >= static_cast<char*>(info.text) + info.text_size)
+            continue;
+        const char* imageName = strrchr(info.name, '/');
+        imageName = imageName ? imageName + 1 : info.name;
+        char* described = nullptr;
+        if (asprintf(&described, "%s+0x%lx", imageName,
+                static_cast<unsigned long>(static_cast<char*>(pc) - static_cast<char*>(info.text))) > 0)
+            return DemangleEntry { nullptr, described };
+        break;
+    }
+#endif
 #else
     UNUSED_PARAM(pc);
 #endif
@@ -182,6 +182,17 @@ enum TracePointCode {
     UpdateLayerContentBuffersEnd,
 #endif
 
+#if PLATFORM(HAIKU)
+    HaikuPortRange = 21000,
+
+    TileRasterStart,
+    TileRasterEnd,
+    PagePaintStart,
+    PagePaintEnd,
+    PageBlitStart,
+    PageBlitEnd,
+#endif
+
 };
 
 #ifdef __cplusplus
@@ -191,6 +202,10 @@ enum TracePointCode {
 #include <wtf/glib/SysprofAnnotator.h>
 #endif
 
+#if OS(HAIKU)
+#include <wtf/haiku/TraceRecorderHaiku.h>
+#endif
+
 namespace WTF {
 
 inline void tracePoint(TracePointCode code, uint64_t data1 = 0, uint64_t data2 = 0, uint64_t data3 = 0, uint64_t data4 = 0)
@@ -204,6 +219,11 @@ inline void tracePoint(TracePointCode code, uint64_t data1 = 0, uint64_t data2 =
     UNUSED_PARAM(data2);
     UNUSED_PARAM(data3);
     UNUSED_PARAM(data4);
+#elif OS(HAIKU)
+    TraceRecorder::record(code, data1);
+    UNUSED_PARAM(data2);
+    UNUSED_PARAM(data3);
+    UNUSED_PARAM(data4);
 #else
     UNUSED_PARAM(code);
     UNUSED_PARAM(data1);
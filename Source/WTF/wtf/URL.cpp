@@ -28,12 +28,14 @@
 #include <wtf/URL.h>
 
 #include "URLParser.h"
+#include <array>
 #include <stdio.h>
 #include <unicode/uidna.h>
 #include <wtf/FileSystem.h>
 #include <wtf/HashMap.h>
 #include <wtf/HashSet.h>
 #include <wtf/Lock.h>
+#include <wtf/MainThread.h>
 #include <wtf/NeverDestroyed.h>
 #include <wtf/PrintStream.h>
 #include <wtf/StdLibExtras.h>
@@ -63,8 +65,39 @@ void URL::invalidate()
     m_queryEnd = 0;
 }
 
+// Pages with thousands of links resolve many identical relative strings
+// against the same base URL, and re-running the parser for every repeat is
+// measurable on link-heavy documents. A small direct-mapped cache keyed on
+// the exact (base string, relative string) pair returns a copy of the
+// previously parsed result; since a URL's components are a pure function
+// of its string, a hit reproduces exactly what the parser would return.
+// Restricted to the main thread (no locking) and to the default UTF-8
+// encoding, whose result depends on nothing but the two strings.
+struct RelativeURLCacheEntry {
+    String base;
+    String relative;
+    URL result;
+};
+static constexpr unsigned relativeURLCacheSize = 256;
+
 URL::URL(const URL& base, const String& relative, const URLTextEncoding* encoding)
 {
+    if (!encoding && !relative.isNull() && isMainThread()) {
+        static NeverDestroyed<std::array<RelativeURLCacheEntry, relativeURLCacheSize>> cache;
+        unsigned hash = relative.impl()->hash();
+        if (auto* baseImpl = base.string().impl())
+            hash ^= baseImpl->hash();
+        auto& entry = cache.get()[hash & (relativeURLCacheSize - 1)];
+        if (entry.relative == relative && entry.base == base.string()) {
+            *this = entry.result;
+            return;
+        }
+        *this = URLParser(String { relative }, base, encoding).result();
+        entry.base = base.string();
+        entry.relative = relative;
+        entry.result = *this;
+        return;
+    }
     *this = URLParser(String { relative },  base, encoding).result();
 }
 
@@ -26,24 +26,25 @@
 #include "config.h"
 #include "wtf/MemoryFootprint.h"
 
-#include <image.h>
+#include <OS.h>
 
 
 namespace WTF {
 
 size_t memoryFootprint()
 {
-	image_info info;
-	int32* cookie = NULL;
+	// Sum up the resident size of all areas of the team. Unlike the image
+	// list this accounts for the heap and any mapped caches, and only
+	// counts pages that are actually in RAM.
+	area_info info;
+	ssize_t cookie = 0;
 
-	size_t heapSize;
+	size_t footprint = 0;
 
-	while(get_next_image_info(B_CURRENT_TEAM, cookie, &info) == B_OK)
-	{
-		heapSize += info.data_size;
-	}
+	while (get_next_area_info(B_CURRENT_TEAM, &cookie, &info) == B_OK)
+		footprint += info.ram_size;
 
-	return heapSize;
+	return footprint;
 }
 
 }
@@ -28,12 +28,368 @@
 
 #include <Application.h>
 #include <Handler.h>
-#include <MessageRunner.h>
 #include <errno.h>
 #include <stdio.h>
+#include <unistd.h>
+
+#include <wtf/Lock.h>
+#include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/PerformanceCounter.h>
+#include <wtf/Vector.h>
 
 namespace WTF {
 
+// A single watch on a file descriptor. The armed flag implements one-shot
+// rearming: wait_for_objects() is level-triggered, so the watcher skips the
+// descriptor until the loop-side callback has actually run.
+struct FileDescriptorWatch : public ThreadSafeRefCounted<FileDescriptorWatch> {
+    FileDescriptorWatch(int fd, uint16 events, RunLoop& runLoop, Function<void()>&& callback)
+        : fd(fd)
+        , events(events)
+        , runLoop(runLoop)
+        , callback(WTFMove(callback))
+    {
+    }
+
+    int fd;
+    uint16 events;
+    Ref<RunLoop> runLoop;
+    Function<void()> callback;
+    std::atomic<bool> armed { true };
+    std::atomic<bool> removed { false };
+};
+
+// One thread waits on every registered descriptor at once and dispatches
+// readiness to the owning loops, so servicing N sockets costs one waiting
+// thread instead of N, and a chatty socket wakes its loop once per serviced
+// batch rather than once per packet.
+class FileDescriptorWatcher {
+public:
+    static FileDescriptorWatcher& shared()
+    {
+        static NeverDestroyed<FileDescriptorWatcher> watcher;
+        return watcher;
+    }
+
+    FileDescriptorWatcher()
+    {
+        pipe(m_wakePipe);
+        Thread::create("RunLoop fd watcher"_s, [this] {
+            threadLoop();
+        })->detach();
+    }
+
+    void add(Ref<FileDescriptorWatch>&& watch)
+    {
+        {
+            Locker locker { m_lock };
+            m_watches.append(WTFMove(watch));
+        }
+        wake();
+    }
+
+    void remove(int fd)
+    {
+        {
+            Locker locker { m_lock };
+            for (auto& watch : m_watches) {
+                if (watch->fd == fd)
+                    watch->removed = true;
+            }
+        }
+        wake();
+    }
+
+    void wake()
+    {
+        char byte = 0;
+        write(m_wakePipe[1], &byte, 1);
+    }
+
+private:
+    void threadLoop()
+    {
+        for (;;) {
+            Vector<object_wait_info> infos;
+            Vector<RefPtr<FileDescriptorWatch>> waiting;
+
+            {
+                Locker locker { m_lock };
+                m_watches.removeAllMatching([](const RefPtr<FileDescriptorWatch>& watch) {
+                    return watch->removed.load();
+                });
+                for (auto& watch : m_watches) {
+                    if (!watch->armed)
+                        continue;
+                    infos.append({ watch->fd, B_OBJECT_TYPE_FD, watch->events });
+                    waiting.append(watch);
+                }
+            }
+            infos.append({ m_wakePipe[0], B_OBJECT_TYPE_FD, B_EVENT_READ });
+
+            if (wait_for_objects(infos.data(), infos.size()) < 0)
+                continue;
+
+            if (infos.last().events & B_EVENT_READ) {
+                char buffer[64];
+                read(m_wakePipe[0], buffer, sizeof(buffer));
+            }
+
+            for (size_t i = 0; i < waiting.size(); i++) {
+                RefPtr<FileDescriptorWatch> watch = waiting[i];
+                if (!(infos[i].events & watch->events) || watch->removed)
+                    continue;
+
+                watch->armed = false;
+                watch->runLoop->dispatch([watch] {
+                    if (watch->removed)
+                        return;
+                    watch->callback();
+                    watch->armed = true;
+                    FileDescriptorWatcher::shared().wake();
+                });
+            }
+        }
+    }
+
+    Lock m_lock;
+    Vector<RefPtr<FileDescriptorWatch>> m_watches;
+    int m_wakePipe[2] { -1, -1 };
+};
+
+void RunLoop::watchFileDescriptor(int fd, FileDescriptorEvent event, Function<void()>&& callback)
+{
+    uint16 events = event == FileDescriptorEvent::Read ? B_EVENT_READ : B_EVENT_WRITE;
+    FileDescriptorWatcher::shared().add(adoptRef(
+        *new FileDescriptorWatch(fd, events, *this, WTFMove(callback))));
+}
+
+void RunLoop::unwatchFileDescriptor(int fd)
+{
+    FileDescriptorWatcher::shared().remove(fd);
+}
+
+
+// One thread services the deadlines of every timer on every loop. Waiting
+// on a semaphore with an absolute timeout gives microsecond scheduling,
+// where a BMessageRunner per timer costs one kernel object each and rounds
+// to the event-loop pulse granularity; deadlines falling within a short
+// window of each other are fired in one batch so that a cluster of timers
+// produces a single wakeup.
+class TimerService {
+public:
+    static TimerService& shared()
+    {
+        static NeverDestroyed<TimerService> service;
+        return service;
+    }
+
+    TimerService()
+    {
+        m_wakeSem = create_sem(0, "RunLoop timer service");
+        Thread::create("RunLoop timer service"_s, [this] {
+            threadLoop();
+        })->detach();
+    }
+
+    void start(RunLoop::TimerBase* timer, int64_t interval, bool repeat)
+    {
+        {
+            Locker locker { m_lock };
+            removeLocked(timer);
+            timer->m_generation++;
+            timer->m_fireInterval = interval;
+            timer->m_repeating = repeat;
+            timer->m_fireTime = system_time() + interval;
+            timer->m_isActive = true;
+            m_timers.append(timer);
+        }
+        release_sem(m_wakeSem);
+    }
+
+    void stop(RunLoop::TimerBase* timer)
+    {
+        Locker locker { m_lock };
+        removeLocked(timer);
+        timer->m_generation++;
+        timer->m_isActive = false;
+    }
+
+    // Called from the loop thread when a 'tmrf' message arrives; rejects
+    // messages from a schedule that has since been stopped or replaced.
+    bool shouldFire(RunLoop::TimerBase* timer, uint32_t generation)
+    {
+        Locker locker { m_lock };
+        if (generation != timer->m_generation || !timer->m_isActive)
+            return false;
+        if (!timer->m_repeating)
+            timer->m_isActive = false;
+        return true;
+    }
+
+    bool isActive(const RunLoop::TimerBase* timer)
+    {
+        Locker locker { m_lock };
+        return timer->m_isActive;
+    }
+
+    Seconds secondsUntilFire(const RunLoop::TimerBase* timer)
+    {
+        Locker locker { m_lock };
+        if (!timer->m_isActive)
+            return 0_s;
+        return Seconds::fromMicroseconds(std::max<int64_t>(0, timer->m_fireTime - system_time()));
+    }
+
+private:
+    // Deadlines this close together are serviced by the same wakeup.
+    static const int64_t coalescingWindow = 50;
+
+    void removeLocked(RunLoop::TimerBase* timer)
+    {
+        m_timers.removeAll(timer);
+    }
+
+    void threadLoop()
+    {
+        for (;;) {
+            int64_t nextDeadline = -1;
+            {
+                Locker locker { m_lock };
+                int64_t now = system_time();
+                for (auto* timer : m_timers) {
+                    if (timer->m_fireTime <= now + coalescingWindow) {
+                        BLooper* looper = timer->m_runLoop->m_handler->Looper();
+                        if (!looper) {
+                            // The owning loop has not started running yet;
+                            // check again shortly.
+                            timer->m_fireTime = now + 1000;
+                        } else {
+                            BMessage message('tmrf');
+                            message.AddPointer("timer", timer);
+                            message.AddUInt32("generation", timer->m_generation);
+                            looper->PostMessage(&message, timer->m_runLoop->m_handler);
+                            if (timer->m_repeating)
+                                timer->m_fireTime = now + timer->m_fireInterval;
+                            else {
+                                timer->m_fireTime = -1;
+                                continue;
+                            }
+                        }
+                    }
+                    if (nextDeadline < 0 || timer->m_fireTime < nextDeadline)
+                        nextDeadline = timer->m_fireTime;
+                }
+                m_timers.removeAllMatching([](RunLoop::TimerBase* timer) {
+                    return timer->m_fireTime < 0;
+                });
+            }
+
+            if (nextDeadline < 0)
+                acquire_sem(m_wakeSem);
+            else
+                acquire_sem_etc(m_wakeSem, 1, B_ABSOLUTE_TIMEOUT, nextDeadline);
+        }
+    }
+
+    Lock m_lock;
+    Vector<RunLoop::TimerBase*> m_timers;
+    sem_id m_wakeSem { -1 };
+};
+
+// At most this many queued functions run per 'loop' message; the turn
+// reposts itself while work remains, so the looper gets to deliver the
+// native messages queued behind it (input, 'tmrf' timer fires) between
+// batches instead of after the entire backlog.
+static const unsigned maxFunctionsPerTurn = 32;
+
+void RunLoop::dispatch(DispatchPriority priority, Function<void()>&& function)
+{
+    RELEASE_ASSERT(function);
+
+    if (priority == DispatchPriority::Default) {
+        dispatch(WTFMove(function));
+        return;
+    }
+
+    unsigned lane = priority == DispatchPriority::Input ? 0 : priority == DispatchPriority::Rendering ? 1 : 2;
+    bool needsWakeup = false;
+    {
+        Locker locker { m_nextIterationLock };
+        needsWakeup = m_dispatchLanes[lane].isEmpty();
+        m_dispatchLanes[lane].append(WTFMove(function));
+    }
+
+    if (needsWakeup)
+        wakeUp();
+}
+
+// Moves one bounded batch into m_currentIteration, higher-priority lanes
+// first and the Idle lane only once everything else is empty. Returns
+// whether functions remain queued for a later turn.
+bool RunLoop::takeFunctionsForNextTurn()
+{
+    unsigned taken = m_currentIteration.size();
+    auto takeFrom = [&](Deque<Function<void()>>& lane) {
+        while (taken < maxFunctionsPerTurn && !lane.isEmpty()) {
+            m_currentIteration.append(lane.takeFirst());
+            taken++;
+        }
+    };
+
+    takeFrom(m_dispatchLanes[0]);
+    takeFrom(m_dispatchLanes[1]);
+    takeFrom(m_nextIteration);
+    if (m_dispatchLanes[0].isEmpty() && m_dispatchLanes[1].isEmpty() && m_nextIteration.isEmpty())
+        takeFrom(m_dispatchLanes[2]);
+
+    return !m_dispatchLanes[0].isEmpty() || !m_dispatchLanes[1].isEmpty() || !m_nextIteration.isEmpty() || !m_dispatchLanes[2].isEmpty();
+}
+
+// The Haiku analogue of performWork(): same re-entry and suspension
+// semantics, but drains in bounded, priority-ordered batches.
+void RunLoop::performWorkBatched()
+{
+    bool didSuspendFunctions = false;
+    bool workRemains = false;
+
+    {
+        Locker locker { m_nextIterationLock };
+
+        // If the RunLoop re-enters or re-schedules, we're expected to execute
+        // the leftover functions in order, ahead of anything queued since.
+        workRemains = takeFunctionsForNextTurn();
+    }
+
+    while (!m_currentIteration.isEmpty()) {
+        if (m_isFunctionDispatchSuspended) {
+            didSuspendFunctions = true;
+            break;
+        }
+
+        auto function = m_currentIteration.takeFirst();
+        function();
+    }
+
+    // Suspend only for a single cycle.
+    m_isFunctionDispatchSuspended = false;
+    m_hasSuspendedFunctions = didSuspendFunctions;
+
+    if (m_hasSuspendedFunctions || workRemains)
+        wakeUp();
+}
+
+#if ENABLE(PERFORMANCE_COUNTERS)
+PERFORMANCE_COUNTER(longTaskCounter, "main thread long tasks");
+PERFORMANCE_COUNTER(longTaskTimeCounter, "main thread long task us");
+
+// Matching the Long Tasks API threshold: a dispatch holding the loop
+// longer than this has visibly delayed input handling and painting.
+// Microtask storms land here too — a checkpoint drains at the end of the
+// task that queued it, so the whole storm is one long dispatch.
+static constexpr bigtime_t kLongTaskThreshold = 50000;
+#endif
 
 class LoopHandler: public BHandler
 {
@@ -45,16 +401,26 @@ class LoopHandler: public BHandler
 
         void MessageReceived(BMessage* message) override
         {
+#if ENABLE(PERFORMANCE_COUNTERS)
+            bigtime_t dispatchStart = system_time();
+#endif
             if (message->what == 'loop') {
-                RunLoop::current().performWork();
+                RunLoop::current().performWorkBatched();
             } else if (message->what == 'tmrf') {
                 RunLoop::TimerBase* timer
                     = (RunLoop::TimerBase*)message->GetPointer("timer");
-                timer->timerFired();
+                timer->timerFired(message->GetUInt32("generation", 0));
             } else {
                 message->PrintToStream();
                 BHandler::MessageReceived(message);
             }
+#if ENABLE(PERFORMANCE_COUNTERS)
+            bigtime_t elapsed = system_time() - dispatchStart;
+            if (elapsed >= kLongTaskThreshold && isMainThread()) {
+                PERFORMANCE_COUNTER_INCREMENT(longTaskCounter);
+                PERFORMANCE_COUNTER_ADD(longTaskTimeCounter, elapsed);
+            }
+#endif
         }
 };
 
@@ -119,7 +485,6 @@ void RunLoop::wakeUp()
 RunLoop::TimerBase::TimerBase(RunLoop& runLoop)
     : m_runLoop(runLoop)
 {
-    m_messageRunner = NULL;
 }
 
 RunLoop::TimerBase::~TimerBase()
@@ -127,52 +492,27 @@ RunLoop::TimerBase::~TimerBase()
     stop();
 }
 
-void RunLoop::TimerBase::timerFired()
+void RunLoop::TimerBase::timerFired(uint32_t generation)
 {
-    // was timer stopped?
-    if (m_messageRunner == nullptr)
+    if (!TimerService::shared().shouldFire(this, generation))
         return;
 
-    // do we need to stop it?
-    bigtime_t interval = 0;
-    int32 count = 0;
-
-    m_messageRunner->GetInfo(&interval, &count);
-    if (count == 1)
-        stop();
-
     fired();
 }
 
 void RunLoop::TimerBase::start(Seconds nextFireInterval, bool repeat)
 {
-	if (m_messageRunner) {
-		delete m_messageRunner;
-		m_messageRunner = nullptr;
-	}
-
-	BMessage* message = new BMessage('tmrf');
-	message->AddPointer("timer", this);
-
-   	m_messageRunner = new BMessageRunner(m_runLoop->m_handler,
-       	message, nextFireInterval.microseconds(), repeat ? -1 : 1);
+    TimerService::shared().start(this, nextFireInterval.microseconds(), repeat);
 }
 
 bool RunLoop::TimerBase::isActive() const
 {
-	bool active = false;
-	if (m_runLoop->m_handler->LockLooper()) {
-		active = (m_messageRunner != NULL);
-		m_runLoop->m_handler->UnlockLooper();
-	}
-
-	return active;
+    return TimerService::shared().isActive(this);
 }
 
 void RunLoop::TimerBase::stop()
 {
-    delete m_messageRunner;
-    m_messageRunner = NULL;
+    TimerService::shared().stop(this);
 }
 
 RunLoop::CycleResult RunLoop::cycle(RunLoopMode)
@@ -187,7 +527,6 @@ RunLoop::CycleResult RunLoop::cycle(RunLoopMode)
 
 Seconds RunLoop::TimerBase::secondsUntilFire() const
 {
-    // FIXME implement
-    return 0_s;
+    return TimerService::shared().secondsUntilFire(this);
 }
 }
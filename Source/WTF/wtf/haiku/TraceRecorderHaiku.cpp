@@ -0,0 +1,271 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include <wtf/haiku/TraceRecorderHaiku.h>
+
+#if OS(HAIKU)
+
+#include <OS.h>
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/StdLibExtras.h>
+#include <wtf/SystemTracing.h>
+#include <wtf/Vector.h>
+
+namespace WTF {
+
+// Roughly 400KB per traced thread. Events overwrite the oldest ones when a
+// thread wraps its buffer, so a capture always holds the most recent activity.
+static constexpr size_t eventsPerThread = 1 << 14;
+
+struct TraceRecorderBuffer {
+    int32_t thread { 0 };
+    // Written only by the owning thread; the exporter reads it with acquire
+    // ordering to get a consistent prefix of the events array.
+    std::atomic<uint64_t> head { 0 };
+    TraceRecorder::Event events[eventsPerThread];
+};
+
+bool TraceRecorder::s_enabled = !!getenv("WEBKIT_TRACE_RECORDER");
+
+// When the environment variable holds an absolute path instead of a bare
+// "1", the capture is written there as a Chrome trace when the process
+// exits, so a whole session can be recorded without touching any code.
+static const char* traceOutputPath()
+{
+    const char* value = getenv("WEBKIT_TRACE_RECORDER");
+    if (value && value[0] == '/')
+        return value;
+    return nullptr;
+}
+
+static struct TraceRecorderExitDump {
+    TraceRecorderExitDump()
+    {
+        if (TraceRecorder::isEnabled() && traceOutputPath()) {
+            atexit([] {
+                TraceRecorder::exportChromeTrace(traceOutputPath());
+            });
+        }
+    }
+} traceRecorderExitDump;
+
+static Lock bufferRegistryLock;
+
+static Vector<TraceRecorderBuffer*>& bufferRegistry() WTF_REQUIRES_LOCK(bufferRegistryLock)
+{
+    static NeverDestroyed<Vector<TraceRecorderBuffer*>> registry;
+    return registry;
+}
+
+void TraceRecorder::recordSlowPath(uint32_t code, uint64_t data)
+{
+    // Buffers are intentionally never freed: a thread that exits keeps its
+    // events exportable, and recording only happens when the recorder was
+    // explicitly enabled for a profiling session.
+    static thread_local TraceRecorderBuffer* buffer;
+    if (UNLIKELY(!buffer)) {
+        buffer = new TraceRecorderBuffer;
+        buffer->thread = find_thread(nullptr);
+        Locker locker { bufferRegistryLock };
+        bufferRegistry().append(buffer);
+    }
+
+    uint64_t index = buffer->head.load(std::memory_order_relaxed);
+    Event& event = buffer->events[index % eventsPerThread];
+    event.timestamp = system_time_nsecs();
+    event.thread = buffer->thread;
+    event.code = code;
+    event.data = data;
+    buffer->head.store(index + 1, std::memory_order_release);
+}
+
+static Vector<TraceRecorder::Event> collectSortedEvents()
+{
+    Vector<TraceRecorder::Event> events;
+    {
+        Locker locker { bufferRegistryLock };
+        for (auto* buffer : bufferRegistry()) {
+            uint64_t head = buffer->head.load(std::memory_order_acquire);
+            uint64_t count = std::min<uint64_t>(head, eventsPerThread);
+            for (uint64_t i = head - count; i < head; i++)
+                events.append(buffer->events[i % eventsPerThread]);
+        }
+    }
+
+    std::sort(events.begin(), events.end(), [] (const TraceRecorder::Event& a, const TraceRecorder::Event& b) {
+        return a.timestamp < b.timestamp;
+    });
+    return events;
+}
+
+bool TraceRecorder::exportTo(const char* path)
+{
+    Vector<Event> events = collectSortedEvents();
+
+    FILE* out = fopen(path, "w");
+    if (!out)
+        return false;
+
+    // Codes are the TracePointCode values from wtf/SystemTracing.h; the
+    // mapping to names lives in Tools/Tracing/SystemTracePoints.plist.
+    for (const Event& event : events)
+        fprintf(out, "%" PRId64 "\t%" PRId32 "\t%" PRIu32 "\t%" PRIu64 "\n", event.timestamp, event.thread, event.code, event.data);
+
+    fclose(out);
+    return true;
+}
+
+// Phases follow the Chrome Trace Event Format: 'B'/'E' are a duration span
+// nested on its thread, 'b'/'e' an async span matched by id across threads
+// (the data word carries the id), 'i' an instant. Codes missing from the
+// table are still exported, as generic instants.
+struct TraceEventDescription {
+    uint32_t code;
+    const char* name;
+    char phase;
+};
+
+static const TraceEventDescription traceEventDescriptions[] = {
+    { VMEntryScopeStart, "VMEntryScope", 'B' },
+    { VMEntryScopeEnd, "VMEntryScope", 'E' },
+    { WebAssemblyCompileStart, "WebAssemblyCompile", 'B' },
+    { WebAssemblyCompileEnd, "WebAssemblyCompile", 'E' },
+    { WebAssemblyExecuteStart, "WebAssemblyExecute", 'B' },
+    { WebAssemblyExecuteEnd, "WebAssemblyExecute", 'E' },
+    { IncrementalSweepStart, "IncrementalSweep", 'B' },
+    { IncrementalSweepEnd, "IncrementalSweep", 'E' },
+
+    // The loads span threads and overlap freely, so they export as async
+    // events: the main resource keyed on the page identifier, subresources
+    // on the resource-load identifier.
+    { MainResourceLoadDidStartProvisional, "MainResourceLoad", 'b' },
+    { MainResourceLoadDidEnd, "MainResourceLoad", 'e' },
+    { SubresourceLoadWillStart, "SubresourceLoad", 'b' },
+    { SubresourceLoadDidEnd, "SubresourceLoad", 'e' },
+
+    { FetchCookiesStart, "FetchCookies", 'B' },
+    { FetchCookiesEnd, "FetchCookies", 'E' },
+    { StyleRecalcStart, "StyleRecalc", 'B' },
+    { StyleRecalcEnd, "StyleRecalc", 'E' },
+    { RenderTreeBuildStart, "RenderTreeBuild", 'B' },
+    { RenderTreeBuildEnd, "RenderTreeBuild", 'E' },
+    { PerformLayoutStart, "PerformLayout", 'B' },
+    { PerformLayoutEnd, "PerformLayout", 'E' },
+    { RenderTreeLayoutStart, "RenderTreeLayout", 'B' },
+    { RenderTreeLayoutEnd, "RenderTreeLayout", 'E' },
+    { PaintLayerStart, "PaintLayer", 'B' },
+    { PaintLayerEnd, "PaintLayer", 'E' },
+    { AsyncImageDecodeStart, "AsyncImageDecode", 'B' },
+    { AsyncImageDecodeEnd, "AsyncImageDecode", 'E' },
+    { RAFCallbackStart, "RAFCallback", 'B' },
+    { RAFCallbackEnd, "RAFCallback", 'E' },
+    { MemoryPressureHandlerStart, "MemoryPressureHandler", 'B' },
+    { MemoryPressureHandlerEnd, "MemoryPressureHandler", 'E' },
+    { DisplayListRecordStart, "DisplayListRecord", 'B' },
+    { DisplayListRecordEnd, "DisplayListRecord", 'E' },
+    { DisplayListReplayStart, "DisplayListReplay", 'B' },
+    { DisplayListReplayEnd, "DisplayListReplay", 'E' },
+    { ComputeEventRegionsStart, "ComputeEventRegions", 'B' },
+    { ComputeEventRegionsEnd, "ComputeEventRegions", 'E' },
+    { RenderingUpdateStart, "RenderingUpdate", 'B' },
+    { RenderingUpdateEnd, "RenderingUpdate", 'E' },
+    { CompositingUpdateStart, "CompositingUpdate", 'B' },
+    { CompositingUpdateEnd, "CompositingUpdate", 'E' },
+    { ParseHTMLStart, "ParseHTML", 'B' },
+    { ParseHTMLEnd, "ParseHTML", 'E' },
+    { PerformOpportunisticallyScheduledTasksStart, "OpportunisticTasks", 'B' },
+    { PerformOpportunisticallyScheduledTasksEnd, "OpportunisticTasks", 'E' },
+
+    { ScheduleRenderingUpdate, "ScheduleRenderingUpdate", 'i' },
+    { TriggerRenderingUpdate, "TriggerRenderingUpdate", 'i' },
+    { DisplayRefreshDispatchingToMainThread, "DisplayRefreshDispatch", 'i' },
+
+    { TileRasterStart, "TileRaster", 'B' },
+    { TileRasterEnd, "TileRaster", 'E' },
+    { PagePaintStart, "PagePaint", 'B' },
+    { PagePaintEnd, "PagePaint", 'E' },
+    { PageBlitStart, "PageBlit", 'B' },
+    { PageBlitEnd, "PageBlit", 'E' },
+};
+
+static const TraceEventDescription* describeTraceEvent(uint32_t code)
+{
+    for (const auto& description : traceEventDescriptions) {
+        if (description.code == code)
+            return &description;
+    }
+    return nullptr;
+}
+
+bool TraceRecorder::exportChromeTrace(const char* path)
+{
+    Vector<Event> events = collectSortedEvents();
+
+    FILE* out = fopen(path, "w");
+    if (!out)
+        return false;
+
+    pid_t pid = getpid();
+    fputs("{\"traceEvents\":[", out);
+    bool first = true;
+    for (const Event& event : events) {
+        const TraceEventDescription* description = describeTraceEvent(event.code);
+        if (!first)
+            fputs(",\n", out);
+        first = false;
+
+        // Timestamps are microseconds in the trace format.
+        double timestamp = event.timestamp / 1000.0;
+        if (!description) {
+            fprintf(out, "{\"name\":\"tracePoint %" PRIu32 "\",\"cat\":\"webkit\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":%d,\"tid\":%" PRId32 "}", event.code, timestamp, (int)pid, event.thread);
+            continue;
+        }
+
+        fprintf(out, "{\"name\":\"%s\",\"cat\":\"webkit\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":%d,\"tid\":%" PRId32, description->name, description->phase, timestamp, (int)pid, event.thread);
+        if (description->phase == 'b' || description->phase == 'e')
+            fprintf(out, ",\"id\":\"0x%" PRIx64 "\"", event.data);
+        else if (description->phase == 'i')
+            fputs(",\"s\":\"t\"", out);
+        if (event.data && description->phase != 'e' && description->phase != 'E')
+            fprintf(out, ",\"args\":{\"data\":%" PRIu64 "}", event.data);
+        fputs("}", out);
+    }
+    fputs("]}\n", out);
+
+    fclose(out);
+    return true;
+}
+
+} // namespace WTF
+
+#endif // OS(HAIKU)
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#if OS(HAIKU)
+
+#include <stdint.h>
+#include <wtf/ExportMacros.h>
+
+namespace WTF {
+
+// Lightweight in-process trace recorder backing the tracePoint() signposts
+// on Haiku, where no system tracing facility is available. Each thread owns a
+// fixed-size ring buffer of timestamped events, so recording is wait-free and
+// never blocks the traced code; the buffers are merged and sorted only when a
+// capture is exported. Recording is off unless WEBKIT_TRACE_RECORDER is set in
+// the environment, and the fast path when off is a single branch on a bool.
+class TraceRecorder {
+public:
+    struct Event {
+        int64_t timestamp { 0 }; // system_time_nsecs()
+        int32_t thread { 0 };
+        uint32_t code { 0 };
+        uint64_t data { 0 };
+    };
+
+    static bool isEnabled() { return s_enabled; }
+
+    static void record(uint32_t code, uint64_t data)
+    {
+        if (LIKELY(!s_enabled))
+            return;
+        recordSlowPath(code, data);
+    }
+
+    // Merges every thread's ring buffer, oldest event first, and writes one
+    // tab-separated line per event (nanosecond timestamp, thread id, trace
+    // point code, data word) to the given path. Safe to call from any thread
+    // while recording continues; events overwritten during the copy are lost,
+    // which is the usual ring-buffer trade.
+    WTF_EXPORT_PRIVATE static bool exportTo(const char* path);
+
+    // Same merge, written as a Chrome trace ("Trace Event Format") JSON
+    // file loadable in any about:tracing or Perfetto viewer. Start/End code
+    // pairs become named duration spans on their thread; the resource-load
+    // pairs become async spans keyed on the identifier in the data word, so
+    // a navigation's network, parse, style, layout and raster work line up
+    // under one id. Written automatically at exit when WEBKIT_TRACE_RECORDER
+    // holds an absolute path.
+    WTF_EXPORT_PRIVATE static bool exportChromeTrace(const char* path);
+
+private:
+    WTF_EXPORT_PRIVATE static void recordSlowPath(uint32_t code, uint64_t data);
+
+    WTF_EXPORT_PRIVATE static bool s_enabled;
+};
+
+} // namespace WTF
+
+using WTF::TraceRecorder;
+
+#endif // OS(HAIKU)
@@ -301,6 +301,24 @@ static int schedPolicy(Thread::QOS qos, Thread::SchedulingPolicy schedulingPolic
 }
 #endif
 
+#if PLATFORM(HAIKU)
+static int32 haikuThreadPriority(Thread::QOS qos)
+{
+    switch (qos) {
+    case Thread::QOS::UserInteractive:
+        return B_DISPLAY_PRIORITY;
+    case Thread::QOS::UserInitiated:
+    case Thread::QOS::Default:
+        return B_NORMAL_PRIORITY;
+    case Thread::QOS::Utility:
+        return (B_LOW_PRIORITY + B_NORMAL_PRIORITY) / 2;
+    case Thread::QOS::Background:
+        return B_LOW_PRIORITY;
+    }
+    RELEASE_ASSERT_NOT_REACHED();
+}
+#endif
+
 bool Thread::establishHandle(NewThreadContext* context, std::optional<size_t> stackSize, QOS qos, SchedulingPolicy schedulingPolicy)
 {
     pthread_t threadHandle;
@@ -331,6 +349,12 @@ bool Thread::establishHandle(NewThreadContext* context, std::optional<size_t> st
         if (error)
             LOG_ERROR("Failed to set sched policy %d for thread %ld: %s", policy, threadHandle, safeStrerror(error).data());
     }
+#elif PLATFORM(HAIKU)
+    // There are no QOS classes here; map them onto the kernel's thread
+    // priorities so utility and background work yields the cores to the
+    // UI under load instead of time-slicing evenly against it.
+    set_thread_priority(get_pthread_thread_id(threadHandle), haikuThreadPriority(qos));
+    UNUSED_PARAM(schedulingPolicy);
 #else
 #if !HAVE(QOS_CLASSES)
     UNUSED_PARAM(qos);
@@ -475,10 +475,45 @@ template<typename StringClass, unsigned length> bool equal(const StringClass& a,
     return equal(a.span16().data(), { codeUnits, length });
 }
 
+template<typename CharacterType>
+ALWAYS_INLINE bool equalIgnoringASCIICaseWithLengthBulk(const CharacterType* a, const CharacterType* b, size_t lengthToCheck)
+{
+    using UnsignedType = std::make_unsigned_t<CharacterType>;
+    constexpr size_t stride = SIMD::stride<UnsignedType>;
+    ASSERT(lengthToCheck >= stride);
+
+    // Set bit 0x20 on the lanes holding ASCII uppercase letters; everything
+    // else, including non-ASCII lanes, compares unchanged, matching
+    // toASCIILower().
+    auto lowerIfUpper = [](auto value) {
+        auto isUpper = SIMD::bitAnd(SIMD::greaterThanOrEqual(value, SIMD::splat<UnsignedType>('A')), SIMD::lessThanOrEqual(value, SIMD::splat<UnsignedType>('Z')));
+        return SIMD::bitOr(value, SIMD::bitAnd(isUpper, SIMD::splat<UnsignedType>(0x20)));
+    };
+
+    auto blocksDiffer = [&](size_t index) {
+        auto lhs = lowerIfUpper(SIMD::load(bitwise_cast<const UnsignedType*>(a + index)));
+        auto rhs = lowerIfUpper(SIMD::load(bitwise_cast<const UnsignedType*>(b + index)));
+        return SIMD::isNonZero(SIMD::bitNot(SIMD::equal(lhs, rhs)));
+    };
+
+    size_t index = 0;
+    for (; index + stride <= lengthToCheck; index += stride) {
+        if (blocksDiffer(index))
+            return false;
+    }
+    if (index < lengthToCheck && blocksDiffer(lengthToCheck - stride))
+        return false;
+    return true;
+}
+
 template<typename CharacterTypeA, typename CharacterTypeB> inline bool equalIgnoringASCIICaseWithLength(std::span<const CharacterTypeA> a, std::span<const CharacterTypeB> b, size_t lengthToCheck)
 {
     ASSERT(a.size() >= lengthToCheck);
     ASSERT(b.size() >= lengthToCheck);
+    if constexpr (sizeof(CharacterTypeA) == sizeof(CharacterTypeB)) {
+        if (lengthToCheck >= SIMD::stride<std::make_unsigned_t<CharacterTypeA>>)
+            return equalIgnoringASCIICaseWithLengthBulk(a.data(), bitwise_cast<const CharacterTypeA*>(b.data()), lengthToCheck);
+    }
     for (size_t i = 0; i < lengthToCheck; ++i) {
         if (toASCIILower(a[i]) != toASCIILower(b[i]))
             return false;
@@ -26,121 +26,80 @@
 #include "config.h"
 #include "CryptoDigest.h"
 
-#include <openssl/sha.h>
-
-namespace {
-struct SHA1Functions {
-    static constexpr auto init = SHA1_Init;
-    static constexpr auto update = SHA1_Update;
-    static constexpr auto final = SHA1_Final;
-    static constexpr size_t digestLength = SHA_DIGEST_LENGTH;
-};
-
-struct SHA224Functions {
-    static constexpr auto init = SHA224_Init;
-    static constexpr auto update = SHA224_Update;
-    static constexpr auto final = SHA224_Final;
-    static constexpr size_t digestLength = SHA224_DIGEST_LENGTH;
-};
-
-struct SHA256Functions {
-    static constexpr auto init = SHA256_Init;
-    static constexpr auto update = SHA256_Update;
-    static constexpr auto final = SHA256_Final;
-    static constexpr size_t digestLength = SHA256_DIGEST_LENGTH;
-};
-
-struct SHA384Functions {
-    static constexpr auto init = SHA384_Init;
-    static constexpr auto update = SHA384_Update;
-    static constexpr auto final = SHA384_Final;
-    static constexpr size_t digestLength = SHA384_DIGEST_LENGTH;
-};
-
-struct SHA512Functions {
-    static constexpr auto init = SHA512_Init;
-    static constexpr auto update = SHA512_Update;
-    static constexpr auto final = SHA512_Final;
-    static constexpr size_t digestLength = SHA512_DIGEST_LENGTH;
-};
-}
+#include <openssl/evp.h>
 
 namespace PAL {
 
+// Uses the EVP interface rather than the deprecated low-level SHA*_Init
+// family: EVP dispatches to the library's provider implementations, which
+// select the hardware-accelerated code paths (SHA extensions on x86,
+// the NEON/crypto instructions elsewhere) when the CPU has them.
 struct CryptoDigestContext {
-    virtual ~CryptoDigestContext() = default;
-    virtual void addBytes(std::span<const uint8_t> input) = 0;
-    virtual Vector<uint8_t> computeHash() = 0;
-};
-
-template <typename SHAContext, typename SHAFunctions>
-struct CryptoDigestContextImpl : public CryptoDigestContext {
     WTF_MAKE_STRUCT_FAST_ALLOCATED;
 
-    static std::unique_ptr<CryptoDigestContext> create()
-    {
-        return makeUnique<CryptoDigestContextImpl>();
-    }
-
-    CryptoDigestContextImpl()
+    CryptoDigestContext()
+        : context(EVP_MD_CTX_new())
     {
-        SHAFunctions::init(&m_context);
     }
 
-    void addBytes(std::span<const uint8_t> input) override
+    ~CryptoDigestContext()
     {
-        SHAFunctions::update(&m_context, static_cast<const void*>(input.data()), input.size());
+        EVP_MD_CTX_free(context);
     }
 
-    Vector<uint8_t> computeHash() override
-    {
-        Vector<uint8_t> result(SHAFunctions::digestLength);
-        SHAFunctions::final(result.data(), &m_context);
-        return result;
-    }
-
-private:
-    SHAContext m_context;
+    EVP_MD_CTX* context { nullptr };
 };
 
 CryptoDigest::CryptoDigest() = default;
 
 CryptoDigest::~CryptoDigest() = default;
 
-static std::unique_ptr<CryptoDigestContext> createCryptoDigest(CryptoDigest::Algorithm algorithm)
+static const EVP_MD* evpDigest(CryptoDigest::Algorithm algorithm)
 {
     switch (algorithm) {
     case CryptoDigest::Algorithm::SHA_1:
-        return CryptoDigestContextImpl<SHA_CTX, SHA1Functions>::create();
+        return EVP_sha1();
     case CryptoDigest::Algorithm::SHA_224:
-        return CryptoDigestContextImpl<SHA256_CTX, SHA224Functions>::create();
+        return EVP_sha224();
     case CryptoDigest::Algorithm::SHA_256:
-        return CryptoDigestContextImpl<SHA256_CTX, SHA256Functions>::create();
+        return EVP_sha256();
     case CryptoDigest::Algorithm::SHA_384:
-        return CryptoDigestContextImpl<SHA512_CTX, SHA384Functions>::create();
+        return EVP_sha384();
     case CryptoDigest::Algorithm::SHA_512:
-        return CryptoDigestContextImpl<SHA512_CTX, SHA512Functions>::create();
+        return EVP_sha512();
     }
     return nullptr;
 }
 
 std::unique_ptr<CryptoDigest> CryptoDigest::create(CryptoDigest::Algorithm algorithm)
 {
+    const EVP_MD* digestAlgorithm = evpDigest(algorithm);
+    if (!digestAlgorithm)
+        return nullptr;
+
+    auto context = WTF::makeUnique<CryptoDigestContext>();
+    if (!context->context || EVP_DigestInit_ex(context->context, digestAlgorithm, nullptr) != 1)
+        return nullptr;
+
     std::unique_ptr<CryptoDigest> digest = WTF::makeUnique<CryptoDigest>();
-    digest->m_context = createCryptoDigest(algorithm);
+    digest->m_context = WTFMove(context);
     return digest;
 }
 
 void CryptoDigest::addBytes(std::span<const uint8_t> input)
 {
     ASSERT(m_context);
-    m_context->addBytes(input);
+    EVP_DigestUpdate(m_context->context, input.data(), input.size());
 }
 
 Vector<uint8_t> CryptoDigest::computeHash()
 {
     ASSERT(m_context);
-    return m_context->computeHash();
+    Vector<uint8_t> result(EVP_MD_CTX_size(m_context->context));
+    unsigned digestLength = 0;
+    EVP_DigestFinal_ex(m_context->context, result.data(), &digestLength);
+    result.shrink(digestLength);
+    return result;
 }
 
 } // namespace PAL
@@ -27,6 +27,7 @@
 #include "TextCodecUTF8.h"
 
 #include "TextCodecASCIIFastPath.h"
+#include <wtf/SIMDUTF.h>
 #include <wtf/text/CString.h>
 #include <wtf/text/StringBuffer.h>
 #include <wtf/text/WTFString.h>
@@ -306,6 +307,53 @@ String TextCodecUTF8::decode(std::span<const uint8_t> bytes, bool flush, bool st
         sawError = true;
         return { };
     }
+
+    // Whole-buffer fast path: when no bytes are pending from the previous
+    // chunk, validate and convert all the complete sequences in this chunk
+    // with simdutf's vectorized routines, and only fall back to the scalar
+    // loop below for invalid input. Chunks that may start with a byte order
+    // mark take the scalar path, since the mark can be split across chunks.
+    if (!m_partialSequenceSize && !m_shouldStripByteOrderMark && !bytes.empty()) {
+        // A sequence truncated by the chunk boundary is carried over to the
+        // next chunk. On flush a truncated tail is an error, which the scalar
+        // path reports when validation fails.
+        size_t completeLength = bytes.size();
+        if (!flush) {
+            size_t lead = bytes.size();
+            while (lead && (bytes[lead - 1] & 0xC0) == 0x80 && bytes.size() - lead < 3)
+                --lead;
+            if (lead && !isASCII(bytes[lead - 1])
+                && nonASCIISequenceLength(bytes[lead - 1]) > bytes.size() - (lead - 1))
+                completeLength = lead - 1;
+        }
+
+        auto* data = reinterpret_cast<const char*>(bytes.data());
+        if (!completeLength || simdutf::validate_utf8(data, completeLength)) {
+            String result;
+            if (completeLength) {
+                StringBuffer<LChar> latin1Buffer(simdutf::latin1_length_from_utf8(data, completeLength));
+                auto latin1Result = simdutf::convert_utf8_to_latin1_with_errors(data, completeLength, reinterpret_cast<char*>(latin1Buffer.characters()));
+                if (latin1Result.error == simdutf::SUCCESS)
+                    result = String::adopt(WTFMove(latin1Buffer));
+                else {
+                    // Valid UTF-8 that does not fit in 8 bits per character.
+                    ASSERT(latin1Result.error == simdutf::TOO_LARGE);
+                    StringBuffer<UChar> utf16Buffer(simdutf::utf16_length_from_utf8(data, completeLength));
+                    size_t written = simdutf::convert_utf8_to_utf16(data, completeLength, reinterpret_cast<char16_t*>(utf16Buffer.characters()));
+                    ASSERT_UNUSED(written, written == utf16Buffer.length());
+                    result = String::adopt(WTFMove(utf16Buffer));
+                }
+            } else
+                result = emptyString();
+            if (size_t remaining = bytes.size() - completeLength) {
+                ASSERT(remaining < sizeof(m_partialSequence));
+                m_partialSequenceSize = remaining;
+                memcpy(m_partialSequence, bytes.data() + completeLength, remaining);
+            }
+            return result;
+        }
+    }
+
     StringBuffer<LChar> buffer(bufferSize);
 
     auto source = bytes;
@@ -15,14 +15,22 @@ if(USE_CURL)
 else()
   list(APPEND WebCore_INCLUDE_DIRECTORIES
     "${WEBCORE_DIR}/platform/network/haiku"
+    "${WEBCORE_DIR}/platform/network/curl"
   )
 
   list(APPEND WebCore_SOURCES
+    # The disk cache is shared with the curl backend; it only depends on
+    # ResourceHandle and FileSystem.
+    platform/network/curl/CurlCacheEntry.cpp
+    platform/network/curl/CurlCacheManager.cpp
+
     platform/network/haiku/BUrlProtocolHandler.cpp
+    platform/network/haiku/BUrlRequestPool.cpp
     platform/network/haiku/CertificateInfo.cpp
     platform/network/haiku/CookieJarHaiku.cpp
     platform/network/haiku/DNSHaiku.cpp
     platform/network/haiku/HaikuFormDataStream.cpp
+    platform/network/haiku/NetworkWaterfall.cpp
     platform/network/haiku/ResourceHandleHaiku.cpp
     platform/network/haiku/ResourceRequestHaiku.cpp
 
@@ -35,6 +43,7 @@ else()
     platform/network/haiku/AuthenticationChallenge.h
     platform/network/haiku/CertificateInfo.h
     platform/network/haiku/HaikuFormDataStream.h
+    platform/network/haiku/NetworkWaterfall.h
     platform/network/haiku/ResourceError.h
     platform/network/haiku/ResourceRequest.h
     platform/network/haiku/ResourceResponse.h
@@ -60,24 +69,31 @@ list(APPEND WebCore_SOURCES
   accessibility/playstation/AXObjectCachePlayStation.cpp
   accessibility/playstation/AccessibilityObjectPlayStation.cpp
 
+  bindings/js/ScriptBytecodeDiskCache.cpp
+
   editing/haiku/EditorHaiku.cpp
 
   platform/Cursor.cpp
 
   page/haiku/DragControllerHaiku.cpp
+  page/haiku/MemoryReleaseHaiku.cpp
   page/haiku/EventHandlerHaiku.cpp
+  page/haiku/ResourceUsageOverlayHaiku.cpp
+  page/haiku/ResourceUsageThreadHaiku.cpp
 
   page/PointerLockController.cpp
 
   platform/audio/FFTFrameStub.cpp
 
+  platform/generic/KeyedDecoderGeneric.cpp
+  platform/generic/KeyedEncoderGeneric.cpp
+  platform/generic/ScrollbarsControllerGeneric.cpp
+
   platform/haiku/CursorHaiku.cpp
   platform/haiku/DragImageHaiku.cpp
   platform/haiku/DragDataHaiku.cpp
   platform/haiku/ErrorsHaiku.cpp
   platform/haiku/FileSystemHaiku.cpp
-  platform/haiku/KeyedDecoderHaiku.cpp
-  platform/haiku/KeyedEncoderHaiku.cpp
   platform/haiku/KURLHaiku.cpp
   platform/haiku/LoggingHaiku.cpp
   platform/haiku/MIMETypeRegistryHaiku.cpp
@@ -105,6 +121,7 @@ list(APPEND WebCore_SOURCES
 
   platform/graphics/haiku/AffineTransformHaiku.cpp
   platform/graphics/haiku/BitmapImageHaiku.cpp
+  platform/graphics/haiku/BitmapPoolHaiku.cpp
   platform/graphics/haiku/ColorHaiku.cpp
   platform/graphics/haiku/ComplexTextControllerHaiku.cpp
   platform/graphics/haiku/FontCacheHaiku.cpp
@@ -128,11 +145,15 @@ list(APPEND WebCore_SOURCES
   platform/graphics/haiku/MediaPlayerPrivateHaiku.cpp
   platform/graphics/haiku/NativeImageHaiku.cpp
   platform/graphics/haiku/PathHaiku.cpp
+  platform/graphics/haiku/PathRasterizerHaiku.cpp
   platform/graphics/haiku/ShareableBitmapHaiku.cpp
   platform/graphics/haiku/SimpleFontDataHaiku.cpp
   platform/graphics/haiku/SystemFontDatabaseHaiku.cpp
+  platform/graphics/haiku/PixelConversionsHaiku.cpp
   platform/graphics/haiku/TileHaiku.cpp
+  platform/graphics/haiku/TileRasterPool.cpp
   platform/graphics/haiku/TiledBackingStoreHaiku.cpp
+  platform/graphics/haiku/TiledScrollingFastPathHaiku.cpp
   platform/graphics/haiku/GraphicsLayerHaiku.cpp
 
   platform/network/haiku/NetworkStateNotifierHaiku.cpp
@@ -167,6 +188,30 @@ else()
 
 endif()
 
+if (USE_TEXTURE_MAPPER)
+    list(APPEND WebCore_INCLUDE_DIRECTORIES
+        "${WEBCORE_DIR}/platform/graphics/texmap"
+    )
+    list(APPEND WebCore_SOURCES
+        platform/graphics/haiku/AcceleratedCompositingContextHaiku.cpp
+        platform/graphics/texmap/BitmapTexture.cpp
+        platform/graphics/texmap/BitmapTexturePool.cpp
+        platform/graphics/texmap/ClipStack.cpp
+        platform/graphics/texmap/GraphicsLayerTextureMapper.cpp
+        platform/graphics/texmap/TextureMapper.cpp
+        platform/graphics/texmap/TextureMapperBackingStore.cpp
+        platform/graphics/texmap/TextureMapperFPSCounter.cpp
+        platform/graphics/texmap/TextureMapperLayer.cpp
+        platform/graphics/texmap/TextureMapperPlatformLayer.cpp
+        platform/graphics/texmap/TextureMapperShaderProgram.cpp
+        platform/graphics/texmap/TextureMapperTile.cpp
+        platform/graphics/texmap/TextureMapperTiledBackingStore.cpp
+    )
+    list(APPEND WebCore_LIBRARIES
+        GL
+    )
+endif ()
+
 set(WebCore_USER_AGENT_SCRIPTS
     ${WebCore_DERIVED_SOURCES_DIR}/ModernMediaControls.js
 )
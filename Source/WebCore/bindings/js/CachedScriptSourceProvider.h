@@ -32,6 +32,14 @@
 #include <JavaScriptCore/SourceProvider.h>
 #include <wtf/TZoneMallocInlines.h>
 
+#if PLATFORM(HAIKU)
+#include <JavaScriptCore/Strong.h>
+#endif
+
+namespace JSC {
+class UnlinkedFunctionCodeBlock;
+}
+
 namespace WebCore {
 
 class CachedScriptSourceProvider : public JSC::SourceProvider, public CachedResourceClient {
@@ -41,12 +49,24 @@ public:
 
     virtual ~CachedScriptSourceProvider()
     {
+#if PLATFORM(HAIKU)
+        commitCachedBytecode();
+#endif
         m_cachedScript->removeClient(*this);
     }
 
     unsigned hash() const override;
     StringView source() const override;
 
+#if PLATFORM(HAIKU)
+    // Bytecode disk cache hooks, backed by ScriptBytecodeDiskCache and
+    // driven by JSC's CodeCache; defined in ScriptBytecodeDiskCache.cpp.
+    RefPtr<JSC::CachedBytecode> cachedBytecode() const final;
+    void cacheBytecode(const JSC::BytecodeCacheGenerator&) const final;
+    void updateCache(const JSC::UnlinkedFunctionExecutable*, const JSC::SourceCode&, JSC::CodeSpecializationKind, const JSC::UnlinkedFunctionCodeBlock*) const final;
+    void commitCachedBytecode() const final;
+#endif
+
 private:
     CachedScriptSourceProvider(CachedScript* cachedScript, JSC::SourceProviderSourceType sourceType, Ref<CachedScriptFetcher>&& scriptFetcher)
         : SourceProvider(JSC::SourceOrigin { cachedScript->response().url(), WTFMove(scriptFetcher) }, String(cachedScript->response().url().string()), cachedScript->response().isRedirected() ? String(cachedScript->url().string()) : String(), JSC::SourceTaintedOrigin::Untainted, TextPosition(), sourceType)
@@ -56,6 +76,20 @@ private:
     }
 
     CachedResourceHandle<CachedScript> m_cachedScript;
+#if PLATFORM(HAIKU)
+    // Function code blocks are encoded at commit time rather than as they
+    // compile, so the serialized blocks carry this run's tier-up profile
+    // (UnlinkedCodeBlock::didOptimize); the Strong references keep them
+    // alive until then.
+    struct PendingFunctionUpdate {
+        JSC::Strong<JSC::UnlinkedFunctionExecutable> executable;
+        JSC::CodeSpecializationKind kind;
+        JSC::Strong<JSC::UnlinkedFunctionCodeBlock> codeBlock;
+    };
+    mutable RefPtr<JSC::CachedBytecode> m_cachedBytecode;
+    mutable String m_bytecodeCachePath;
+    mutable Vector<PendingFunctionUpdate> m_pendingFunctionUpdates;
+#endif
 };
 
 inline unsigned CachedScriptSourceProvider::hash() const
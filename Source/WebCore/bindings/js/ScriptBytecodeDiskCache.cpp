@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "ScriptBytecodeDiskCache.h"
+
+#if PLATFORM(HAIKU)
+
+#include "CachedScriptSourceProvider.h"
+#include <JavaScriptCore/BytecodeCacheError.h>
+#include <JavaScriptCore/CachedTypes.h>
+#include <JavaScriptCore/StrongInlines.h>
+#include <JavaScriptCore/UnlinkedFunctionCodeBlock.h>
+#include <JavaScriptCore/UnlinkedFunctionExecutable.h>
+#include <wtf/CheckedArithmetic.h>
+#include <wtf/FileSystem.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Scope.h>
+#include <wtf/URL.h>
+#include <wtf/text/MakeString.h>
+
+namespace WebCore {
+
+ScriptBytecodeDiskCache& ScriptBytecodeDiskCache::singleton()
+{
+    static NeverDestroyed<ScriptBytecodeDiskCache> cache;
+    return cache;
+}
+
+void ScriptBytecodeDiskCache::setDirectory(const String& directory)
+{
+    if (!directory.isEmpty())
+        FileSystem::makeAllDirectories(directory);
+    Locker locker { m_lock };
+    m_directory = directory;
+}
+
+bool ScriptBytecodeDiskCache::isEnabled() const
+{
+    Locker locker { m_lock };
+    return !m_directory.isEmpty();
+}
+
+String ScriptBytecodeDiskCache::pathForScript(const URL& url, unsigned sourceHash) const
+{
+    String directory;
+    {
+        Locker locker { m_lock };
+        directory = m_directory;
+    }
+    if (directory.isEmpty())
+        return { };
+
+    // The URL hash picks the entry; the source hash validates it, so a script
+    // whose content changed gets a fresh file instead of stale bytecode. The
+    // last path component is only there to keep the directory legible.
+    String filename = FileSystem::encodeForFileName(url.lastPathComponent().toString());
+    return FileSystem::pathByAppendingComponent(directory, makeString(url.string().hash(), '-', sourceHash, '-', filename, ".bytecode-cache"_s));
+}
+
+RefPtr<JSC::CachedBytecode> ScriptBytecodeDiskCache::load(const String& path) const
+{
+    if (path.isNull())
+        return nullptr;
+
+    auto fd = FileSystem::openAndLockFile(path, FileSystem::FileOpenMode::Read, { FileSystem::FileLockMode::Shared, FileSystem::FileLockMode::Nonblocking });
+    if (!FileSystem::isHandleValid(fd))
+        return nullptr;
+
+    auto closeFD = makeScopeExit([&] {
+        FileSystem::unlockAndCloseFile(fd);
+    });
+
+    bool success;
+    FileSystem::MappedFileData mappedFileData(fd, FileSystem::MappedFileMode::Private, success);
+    if (!success)
+        return nullptr;
+
+    return JSC::CachedBytecode::create(WTFMove(mappedFileData));
+}
+
+void ScriptBytecodeDiskCache::commit(const String& path, JSC::CachedBytecode& cachedBytecode) const
+{
+    if (path.isNull() || !cachedBytecode.hasUpdates())
+        return;
+
+    auto fd = FileSystem::openAndLockFile(path, FileSystem::FileOpenMode::ReadWrite, { FileSystem::FileLockMode::Exclusive, FileSystem::FileLockMode::Nonblocking });
+    if (!FileSystem::isHandleValid(fd))
+        return;
+
+    auto closeFD = makeScopeExit([&] {
+        FileSystem::unlockAndCloseFile(fd);
+    });
+
+    auto fileSize = FileSystem::fileSize(fd);
+    if (!fileSize)
+        return;
+
+    size_t cacheFileSize;
+    if (!WTF::convertSafely(*fileSize, cacheFileSize) || cacheFileSize != cachedBytecode.size()) {
+        // Another process got there first with a different base; leave it be.
+        return;
+    }
+
+    if (!FileSystem::truncateFile(fd, cachedBytecode.sizeForUpdate()))
+        return;
+
+    cachedBytecode.commitUpdates([&] (off_t offset, std::span<const uint8_t> data) {
+        long long result = FileSystem::seekFile(fd, offset, FileSystem::FileSeekOrigin::Beginning);
+        ASSERT_UNUSED(result, result != -1);
+        size_t bytesWritten = static_cast<size_t>(FileSystem::writeToFile(fd, data));
+        ASSERT_UNUSED(bytesWritten, bytesWritten == data.size());
+    });
+}
+
+// The CachedScriptSourceProvider side of the cache, modeled on the jsc
+// shell's ShellSourceProvider. The CodeCache drives all four hooks: it asks
+// for cachedBytecode() before parsing, hands back serialized blocks through
+// cacheBytecode()/updateCache() as compilation proceeds, and the provider
+// flushes whatever accumulated when it goes away.
+
+RefPtr<JSC::CachedBytecode> CachedScriptSourceProvider::cachedBytecode() const
+{
+    if (!m_cachedBytecode) {
+        if (m_bytecodeCachePath.isNull())
+            m_bytecodeCachePath = ScriptBytecodeDiskCache::singleton().pathForScript(sourceOrigin().url(), hash());
+        m_cachedBytecode = ScriptBytecodeDiskCache::singleton().load(m_bytecodeCachePath);
+    }
+    return m_cachedBytecode.copyRef();
+}
+
+void CachedScriptSourceProvider::cacheBytecode(const JSC::BytecodeCacheGenerator& generator) const
+{
+    if (!ScriptBytecodeDiskCache::singleton().isEnabled())
+        return;
+    if (!m_cachedBytecode)
+        m_cachedBytecode = JSC::CachedBytecode::create();
+    auto update = generator();
+    if (update)
+        m_cachedBytecode->addGlobalUpdate(*update);
+}
+
+void CachedScriptSourceProvider::updateCache(const JSC::UnlinkedFunctionExecutable* executable, const JSC::SourceCode&, JSC::CodeSpecializationKind kind, const JSC::UnlinkedFunctionCodeBlock* codeBlock) const
+{
+    if (!m_cachedBytecode || !ScriptBytecodeDiskCache::singleton().isEnabled())
+        return;
+    // Don't encode yet: by commit time the block's metadata records whether
+    // this run tiered it up, and serializing it then lets the next launch
+    // start the same functions at the lowered JIT threshold.
+    JSC::VM& vm = executable->vm();
+    m_pendingFunctionUpdates.append({
+        JSC::Strong<JSC::UnlinkedFunctionExecutable>(vm, const_cast<JSC::UnlinkedFunctionExecutable*>(executable)),
+        kind,
+        JSC::Strong<JSC::UnlinkedFunctionCodeBlock>(vm, const_cast<JSC::UnlinkedFunctionCodeBlock*>(codeBlock))
+    });
+}
+
+void CachedScriptSourceProvider::commitCachedBytecode() const
+{
+    if (!m_cachedBytecode)
+        return;
+
+    auto clearBytecode = makeScopeExit([&] {
+        m_cachedBytecode = nullptr;
+    });
+
+    for (auto& update : m_pendingFunctionUpdates) {
+        JSC::BytecodeCacheError error;
+        RefPtr<JSC::CachedBytecode> encoded = JSC::encodeFunctionCodeBlock(update.executable->vm(), update.codeBlock.get(), error);
+        if (encoded && !error.isValid())
+            m_cachedBytecode->addFunctionUpdate(update.executable.get(), update.kind, *encoded);
+    }
+    m_pendingFunctionUpdates.clear();
+
+    if (!m_cachedBytecode->hasUpdates())
+        return;
+
+    if (m_bytecodeCachePath.isNull())
+        m_bytecodeCachePath = ScriptBytecodeDiskCache::singleton().pathForScript(sourceOrigin().url(), hash());
+    ScriptBytecodeDiskCache::singleton().commit(m_bytecodeCachePath, *m_cachedBytecode);
+}
+
+} // namespace WebCore
+
+#endif // PLATFORM(HAIKU)
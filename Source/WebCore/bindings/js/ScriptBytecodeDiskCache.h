@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#if PLATFORM(HAIKU)
+
+#include <JavaScriptCore/CachedBytecode.h>
+#include <wtf/Lock.h>
+#include <wtf/text/WTFString.h>
+
+namespace WebCore {
+
+// Disk cache for serialized UnlinkedCodeBlocks, the Haiku counterpart of the
+// bytecode cache the jsc shell keeps behind JSC::Options::diskCachePath().
+// Entries are named after the response URL and the decoded script's hash, so
+// a script whose content changed simply misses and rewrites its entry rather
+// than deserializing stale bytecode; the embedder owns the directory and its
+// eviction policy. Disabled until BWebSettings supplies a directory.
+class ScriptBytecodeDiskCache {
+public:
+    WEBCORE_EXPORT static ScriptBytecodeDiskCache& singleton();
+
+    WEBCORE_EXPORT void setDirectory(const String&);
+    bool isEnabled() const;
+
+    // Returns the entry path for a script, or the null string when disabled.
+    String pathForScript(const URL&, unsigned sourceHash) const;
+
+    RefPtr<JSC::CachedBytecode> load(const String& path) const;
+    void commit(const String& path, JSC::CachedBytecode&) const;
+
+private:
+    mutable Lock m_lock;
+    String m_directory WTF_GUARDED_BY_LOCK(m_lock);
+};
+
+} // namespace WebCore
+
+#endif // PLATFORM(HAIKU)
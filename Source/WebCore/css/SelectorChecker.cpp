@@ -52,9 +52,13 @@
 #include "Text.h"
 #include "TypedElementDescendantIteratorInlines.h"
 #include "ViewTransition.h"
+#include <wtf/PerformanceCounter.h>
 
 namespace WebCore {
 
+PERFORMANCE_COUNTER(selectorsCheckedCounter, "style.selectorsChecked");
+PERFORMANCE_COUNTER(selectorsMatchedCounter, "style.selectorsMatched");
+
 using namespace HTMLNames;
 
 enum class VisitedMatchType : unsigned char {
@@ -180,6 +184,8 @@ SelectorChecker::SelectorChecker(Document& document)
 
 bool SelectorChecker::match(const CSSSelector& selector, const Element& element, CheckingContext& checkingContext) const
 {
+    PERFORMANCE_COUNTER_INCREMENT(selectorsCheckedCounter);
+
     auto pseudoElementIdentifier = checkingContext.pseudoId == PseudoId::None ? std::nullopt : std::optional(Style::PseudoElementIdentifier { checkingContext.pseudoId, checkingContext.pseudoElementNameArgument });
     LocalContext context(selector, element, checkingContext.resolvingMode == SelectorChecker::Mode::QueryingRules ? VisitedMatchType::Disabled : VisitedMatchType::Enabled, pseudoElementIdentifier);
 
@@ -193,6 +199,7 @@ bool SelectorChecker::match(const CSSSelector& selector, const Element& element,
     MatchResult result = matchRecursively(checkingContext, context, pseudoIdSet);
     if (result.match != Match::SelectorMatches)
         return false;
+    PERFORMANCE_COUNTER_INCREMENT(selectorsMatchedCounter);
     if (checkingContext.pseudoId != PseudoId::None && !pseudoIdSet.has(checkingContext.pseudoId))
         return false;
 
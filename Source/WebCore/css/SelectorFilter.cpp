@@ -122,6 +122,13 @@ void SelectorFilter::popParent()
     if (m_parentStack.isEmpty()) {
         ASSERT(m_ancestorIdentifierFilter.likelyEmpty());
         m_ancestorIdentifierFilter.clear();
+#if SELECTOR_FILTER_STATS
+        if (m_queryCount) {
+            WTFLogAlways("SelectorFilter: rejected %llu of %llu candidate rules (%.1f%%)", static_cast<unsigned long long>(m_rejectionCount), static_cast<unsigned long long>(m_queryCount), m_rejectionCount * 100.0 / m_queryCount);
+            m_queryCount = 0;
+            m_rejectionCount = 0;
+        }
+#endif
     }
 }
 
@@ -172,6 +179,13 @@ void SelectorFilter::collectSimpleSelectorHash(CollectedSelectorHashes& collecte
             if (selector.selectorList()->listSize() == 1)
                 collectSelectorHashes(collectedHashes, *selector.selectorList()->first(), IncludeRightmost::Yes);
             break;
+        case CSSSelector::PseudoClass::NthChild:
+        case CSSSelector::PseudoClass::NthLastChild:
+            // An element matching :nth-child(An+B of S) also matches S, so the
+            // single argument case can contribute hashes just like :is()/:where().
+            if (const auto* selectorList = selector.selectorList(); selectorList && selectorList->listSize() == 1)
+                collectSelectorHashes(collectedHashes, *selectorList->first(), IncludeRightmost::Yes);
+            break;
         default:
             break;
         }
@@ -33,6 +33,10 @@
 #include <wtf/BloomFilter.h>
 #include <wtf/Vector.h>
 
+// Set to 1 to log how often the ancestor identifier filter rejects candidate
+// rules; useful when checking how well the collected hashes fit a stylesheet.
+#define SELECTOR_FILTER_STATS 0
+
 namespace WebCore {
 
 class CSSSelector;
@@ -81,15 +85,27 @@ private:
     // With 100 unique strings in the filter, 2^12 slot table has false positive rate of ~0.2%.
     static const unsigned bloomFilterKeyBits = 12;
     CountingBloomFilter<bloomFilterKeyBits> m_ancestorIdentifierFilter;
+
+#if SELECTOR_FILTER_STATS
+    mutable uint64_t m_queryCount { 0 };
+    mutable uint64_t m_rejectionCount { 0 };
+#endif
 };
 
 inline bool SelectorFilter::fastRejectSelector(const Hashes& hashes) const
 {
+#if SELECTOR_FILTER_STATS
+    ++m_queryCount;
+#endif
     for (auto& hash : hashes) {
         if (!hash)
             return false;
-        if (!m_ancestorIdentifierFilter.mayContain(hash))
+        if (!m_ancestorIdentifierFilter.mayContain(hash)) {
+#if SELECTOR_FILTER_STATS
+            ++m_rejectionCount;
+#endif
             return true;
+        }
     }
     return false;
 }
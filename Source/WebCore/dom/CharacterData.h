@@ -43,6 +43,15 @@ public:
 
     bool containsOnlyASCIIWhitespace() const;
 
+    // Swaps in an equal backing string so identical nodes can share one
+    // StringImpl. Since the content is unchanged, no events, range updates
+    // or renderer invalidation are needed.
+    void deduplicateData(const String& data)
+    {
+        ASSERT(data == m_data);
+        m_data = data;
+    }
+
     // Like appendData, but optimized for the parser (e.g., no mutation events).
     void parserAppendData(StringView);
 
@@ -2762,8 +2762,16 @@ auto Document::updateLayout(OptionSet<LayoutOptions> layoutOptions, const Elemen
                     context = nullptr;
             }
             if (frameView->layoutContext().isLayoutPending() || renderView()->needsLayout()) {
+                // A layout reached from here outside the rendering update is a
+                // forced synchronous layout: script invalidated style or layout
+                // and then queried geometry before the next scheduled update.
+                RefPtr page = this->page();
+                bool isForcedLayout = page && !page->isInRenderingUpdate();
+                MonotonicTime forcedLayoutStart = isForcedLayout ? MonotonicTime::now() : MonotonicTime();
                 ContentVisibilityForceLayoutScope scope(*renderView(), context);
                 frameView->layoutContext().layout();
+                if (isForcedLayout)
+                    page->countForcedLayout(MonotonicTime::now() - forcedLayoutStart);
                 result = UpdateLayoutResult::ChangesDone;
             }
 
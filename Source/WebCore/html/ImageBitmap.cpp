@@ -855,7 +855,15 @@ void ImageBitmap::createFromBuffer(ScriptExecutionContext& scriptExecutionContex
         orientation = ImageOrientation::Orientation::None;
 
     FloatRect destRect(FloatPoint(), outputSize);
-    bitmapData->context().drawImage(image, destRect, sourceRectangle.releaseReturnValue(), { interpolationQualityForResizeQuality(options.resizeQuality), options.resolvedImageOrientation(orientation) });
+    auto sourceRect = sourceRectangle.releaseReturnValue();
+
+    // An explicit resize to a smaller bitmap lets the decoder produce a
+    // reduced-resolution frame directly where the platform supports it
+    // (e.g. JPEG DCT scaling), instead of decoding every full-size pixel
+    // only to throw most of them away here.
+    auto allowImageSubsampling = (options.resizeWidth || options.resizeHeight) && outputSize.width() < sourceRect.width() && outputSize.height() < sourceRect.height() ? AllowImageSubsampling::Yes : AllowImageSubsampling::No;
+
+    bitmapData->context().drawImage(image, destRect, sourceRect, { interpolationQualityForResizeQuality(options.resizeQuality), options.resolvedImageOrientation(orientation), allowImageSubsampling });
 
     const bool originClean = true;
     const bool premultiplyAlpha = alphaPremultiplicationForPremultiplyAlpha(options.premultiplyAlpha) == AlphaPremultiplication::Premultiplied;
@@ -418,9 +418,17 @@ void HTMLDocumentParser::append(RefPtr<StringImpl>&& inputSource, SynchronousMod
             m_preloadScanner = nullptr;
         } else {
             m_preloadScanner->appendToEnd(source);
-            if (isWaitingForScripts())
+            if (isWaitingForScripts() || isScheduledForResume())
                 m_preloadScanner->scan(*m_preloader, *document());
         }
+    } else if (isScheduledForResume() && !inPumpSession()) {
+        // The parser yielded to the event loop with input still pending, so
+        // this chunk won't be tokenized until the scheduled resume. Scan ahead
+        // of the tokenizer so its subresources are discovered while we wait.
+        m_preloadScanner = makeUnique<HTMLPreloadScanner>(m_options, document()->url(), document()->deviceScaleFactor());
+        m_preloadScanner->appendToEnd(m_input.current());
+        m_preloadScanner->appendToEnd(source);
+        m_preloadScanner->scan(*m_preloader, *document());
     }
 
     m_input.appendToEnd(source);
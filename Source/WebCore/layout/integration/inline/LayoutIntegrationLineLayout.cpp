@@ -368,6 +368,24 @@ static inline std::optional<Layout::BlockLayoutState::LineGrid> lineGrid(const R
     return { };
 }
 
+bool LineLayout::canReuseExistingLayout() const
+{
+    // The display content from the previous layout is reusable when the content itself is intact
+    // and the constraint space is unchanged (e.g. an ancestor only resized in the block axis).
+    if (!m_inlineContent || m_lineDamage)
+        return false;
+    if (m_inlineContent->isPaginated)
+        return false;
+    if (!m_inlineContentConstraints || !m_constraintsUsedForPreviousLayout)
+        return false;
+    auto& current = *m_inlineContentConstraints;
+    auto& previous = *m_constraintsUsedForPreviousLayout;
+    return current.horizontal().logicalLeft == previous.horizontal().logicalLeft
+        && current.horizontal().logicalWidth == previous.horizontal().logicalWidth
+        && current.logicalTop() == previous.logicalTop()
+        && current.visualLeft() == previous.visualLeft();
+}
+
 std::optional<LayoutRect> LineLayout::layout()
 {
     preparePlacedFloats();
@@ -379,6 +397,8 @@ std::optional<LayoutRect> LineLayout::layout()
     }
 
     ASSERT(m_inlineContentConstraints);
+    m_constraintsUsedForPreviousLayout = m_inlineContentConstraints;
+
     auto intrusiveInitialLetterBottom = [&]() -> std::optional<LayoutUnit> {
         if (auto lowestInitialLetterLogicalBottom = flow().lowestInitialLetterLogicalBottom())
             return { *lowestInitialLetterLogicalBottom - m_inlineContentConstraints->logicalTop() };
@@ -92,6 +92,7 @@ public:
 
     std::pair<LayoutUnit, LayoutUnit> computeIntrinsicWidthConstraints();
 
+    bool canReuseExistingLayout() const;
     std::optional<LayoutRect> layout();
     void paint(PaintInfo&, const LayoutPoint& paintOffset, const RenderInline* layerRenderer = nullptr);
     bool hitTest(const HitTestRequest&, HitTestResult&, const HitTestLocation&, const LayoutPoint& accumulatedOffset, HitTestAction, const RenderInline* layerRenderer = nullptr);
@@ -164,6 +165,7 @@ private:
     Layout::BlockFormattingState& m_blockFormattingState;
     Layout::InlineContentCache& m_inlineContentCache;
     std::optional<Layout::ConstraintsForInlineContent> m_inlineContentConstraints;
+    std::optional<Layout::ConstraintsForInlineContent> m_constraintsUsedForPreviousLayout;
     // FIXME: This should be part of LayoutState.
     std::unique_ptr<Layout::InlineDamage> m_lineDamage;
     std::unique_ptr<InlineContent> m_inlineContent;
@@ -33,9 +33,11 @@
 #include "HTTPParsers.h"
 #include "MemoryCache.h"
 #include "ParsedContentType.h"
+#include "ResourceCryptographicDigest.h"
 #include "SharedBuffer.h"
 #include "StyleSheetContents.h"
 #include "TextResourceDecoder.h"
+#include <wtf/NeverDestroyed.h>
 
 #if PLATFORM(COCOA)
 #include <wtf/cocoa/RuntimeApplicationChecksCocoa.h>
@@ -43,6 +45,44 @@
 
 namespace WebCore {
 
+// Process-wide cache of parsed stylesheets, keyed by a digest of the encoded
+// bytes. The per-resource m_parsedStyleSheetCache dies with its
+// CachedCSSStyleSheet; this map lets a fresh resource with identical bytes —
+// the same framework stylesheet loaded by another page, or a reload after the
+// resource was evicted — skip CSS parsing entirely. Entries count as being in
+// the memory cache, so rule mutation through a wrapper copies on write
+// instead of editing the shared contents.
+struct SharedParsedStyleSheet {
+    String encoding;
+    RefPtr<StyleSheetContents> contents;
+};
+
+static constexpr size_t maximumSharedParsedStyleSheetCount = 16;
+
+static HashMap<ResourceCryptographicDigest, SharedParsedStyleSheet>& sharedParsedStyleSheets()
+{
+    static NeverDestroyed<HashMap<ResourceCryptographicDigest, SharedParsedStyleSheet>> map;
+    return map;
+}
+
+static Vector<ResourceCryptographicDigest>& sharedParsedStyleSheetEvictionOrder()
+{
+    static NeverDestroyed<Vector<ResourceCryptographicDigest>> order;
+    return order;
+}
+
+static void pruneSharedParsedStyleSheetsIfNeeded()
+{
+    auto& order = sharedParsedStyleSheetEvictionOrder();
+    while (order.size() > maximumSharedParsedStyleSheetCount) {
+        auto digest = order.first();
+        order.remove(0);
+        auto entry = sharedParsedStyleSheets().take(digest);
+        if (RefPtr contents = WTFMove(entry.contents))
+            contents->removedFromMemoryCache();
+    }
+}
+
 CachedCSSStyleSheet::CachedCSSStyleSheet(CachedResourceRequest&& request, PAL::SessionID sessionID, const CookieJar* cookieJar)
     : CachedResource(WTFMove(request), Type::CSSStyleSheet, sessionID, cookieJar)
     , m_decoder(TextResourceDecoder::create(cssContentTypeAtom(), request.charset()))
@@ -117,6 +157,7 @@ void CachedCSSStyleSheet::finishLoading(const FragmentedSharedBuffer* data, cons
         m_data = nullptr;
         setEncodedSize(0);
     }
+    m_contentDigest = std::nullopt;
     setLoading(false);
     checkNotify(metrics);
     // Clear the decoded text as it is unlikely to be needed immediately again and is cheap to regenerate.
@@ -202,9 +243,41 @@ void CachedCSSStyleSheet::destroyDecodedData()
     setDecodedSize(0);
 }
 
+const ResourceCryptographicDigest& CachedCSSStyleSheet::contentDigest() const
+{
+    ASSERT(m_data);
+    if (!m_contentDigest)
+        m_contentDigest = cryptographicDigestForSharedBuffer(ResourceCryptographicDigest::Algorithm::SHA256, m_data.get());
+    return *m_contentDigest;
+}
+
+// Adopts a parsed sheet with the same bytes from the process-wide cache, if
+// there is one. Digesting the encoded bytes is an order of magnitude cheaper
+// than parsing them; correctness checks (subresource freshness, parser
+// context) are left to the caller, which applies them to the adopted sheet
+// exactly as to a per-resource cached one.
+void CachedCSSStyleSheet::restoreSharedParsedStyleSheet()
+{
+    ASSERT(!m_parsedStyleSheetCache);
+    if (!m_data)
+        return;
+
+    auto it = sharedParsedStyleSheets().find(contentDigest());
+    if (it == sharedParsedStyleSheets().end())
+        return;
+    if (it->value.encoding != encoding())
+        return;
+
+    saveParsedStyleSheet(Ref { *it->value.contents });
+}
+
 RefPtr<StyleSheetContents> CachedCSSStyleSheet::restoreParsedStyleSheet(const CSSParserContext& context, CachePolicy cachePolicy, FrameLoader& loader)
 {
     RefPtr parsedStyleSheetCache = m_parsedStyleSheetCache;
+    if (!parsedStyleSheetCache) {
+        restoreSharedParsedStyleSheet();
+        parsedStyleSheetCache = m_parsedStyleSheetCache;
+    }
     if (!parsedStyleSheetCache)
         return nullptr;
     if (!parsedStyleSheetCache->subresourcesAllowReuse(cachePolicy, loader)) {
@@ -235,6 +308,18 @@ void CachedCSSStyleSheet::saveParsedStyleSheet(Ref<StyleSheetContents>&& sheet)
     sheet->addedToMemoryCache();
 
     setDecodedSize(sheet->estimatedSizeInBytes());
+
+    // Publish the sheet process-wide so other resources with the same bytes
+    // can adopt it.
+    if (m_data) {
+        auto digest = contentDigest();
+        auto result = sharedParsedStyleSheets().add(digest, SharedParsedStyleSheet { encoding(), sheet.copyRef() });
+        if (result.isNewEntry) {
+            sheet->addedToMemoryCache();
+            sharedParsedStyleSheetEvictionOrder().append(digest);
+            pruneSharedParsedStyleSheetsIfNeeded();
+        }
+    }
 }
 
 }
@@ -24,6 +24,7 @@
 
 #include "CachedResource.h"
 #include "FrameLoaderTypes.h"
+#include "ResourceCryptographicDigest.h"
 
 namespace WebCore {
 
@@ -49,6 +50,8 @@ public:
 private:
     String responseMIMEType() const;
     bool canUseSheet(MIMETypeCheckHint, bool* hasValidMIMEType, bool* hasHTTPStatusOK) const;
+    const ResourceCryptographicDigest& contentDigest() const;
+    void restoreSharedParsedStyleSheet();
     bool mayTryReplaceEncodedData() const final { return true; }
     Ref<TextResourceDecoder> protectedDecoder() const;
 
@@ -68,6 +71,7 @@ private:
     String m_decodedSheetText;
 
     RefPtr<StyleSheetContents> m_parsedStyleSheetCache;
+    mutable std::optional<ResourceCryptographicDigest> m_contentDigest;
 };
 
 } // namespace WebCore
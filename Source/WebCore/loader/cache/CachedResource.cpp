@@ -423,6 +423,18 @@ bool CachedResource::isExpired() const
     return computeCurrentAge(response(), m_responseTimestamp) > freshnessLifetime(response());
 }
 
+bool CachedResource::inStaleWhileRevalidateWindow() const
+{
+    if (response().isNull())
+        return false;
+
+    auto staleWhileRevalidate = response().cacheControlStaleWhileRevalidate();
+    if (!staleWhileRevalidate)
+        return false;
+
+    return computeCurrentAge(response(), m_responseTimestamp) <= freshnessLifetime(response()) + *staleWhileRevalidate;
+}
+
 static inline bool shouldCacheSchemeIndefinitely(StringView scheme)
 {
 #if PLATFORM(COCOA)
@@ -854,9 +866,14 @@ bool CachedResource::canUseCacheValidator() const
 
     if (response().cacheControlContainsNoStore())
         return false;
-    // Network process will handle revalidation for s-w-r.
+#if !PLATFORM(HAIKU)
+    // Network process will handle revalidation for s-w-r. This port loads
+    // in-process with no layer underneath this one, so it must issue the
+    // conditional request itself or s-w-r responses get re-downloaded in
+    // full on every expiry.
     if (response().cacheControlStaleWhileRevalidate())
         return false;
+#endif
     return response().hasCacheValidatorFields();
 }
 
@@ -884,8 +901,16 @@ CachedResource::RevalidationDecision CachedResource::makeRevalidationDecision(Ca
         if (response().cacheControlContainsNoStore())
             return RevalidationDecision::YesDueToNoStore;
 
-        if (isExpired())
+        if (isExpired()) {
+#if PLATFORM(HAIKU)
+            // Nothing below this layer honors stale-while-revalidate in an
+            // in-process loader, so honor the window here: keep serving the
+            // stale copy while it lasts and revalidate once it has passed.
+            if (inStaleWhileRevalidateWindow())
+                return RevalidationDecision::No;
+#endif
             return RevalidationDecision::YesDueToExpired;
+        }
 
         return RevalidationDecision::No;
     };
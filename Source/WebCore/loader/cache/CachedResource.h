@@ -257,6 +257,7 @@ public:
     bool hasOneHandle() const { return m_handleCount == 1; }
 
     bool isExpired() const;
+    bool inStaleWhileRevalidateWindow() const;
 
     void cancelLoad(LoadWillContinueInAnotherProcess = LoadWillContinueInAnotherProcess::No);
     bool wasCanceled() const;
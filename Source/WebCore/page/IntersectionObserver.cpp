@@ -320,59 +320,65 @@ static std::optional<LayoutRect> computeClippedRectInRootContentsSpace(const Lay
     return computeClippedRectInRootContentsSpace(rectInFrameViewSpace, ownerRenderer.get());
 }
 
-auto IntersectionObserver::computeIntersectionState(const IntersectionObserverRegistration& registration, LocalFrameView& frameView, Element& target, bool applyRootMargin) const -> IntersectionObservationState
+auto IntersectionObserver::computeIntersectionState(const IntersectionObserverRegistration& registration, LocalFrameView& frameView, Element& target, bool applyRootMargin, RootBoundsSnapshot& rootSnapshot) const -> IntersectionObservationState
 {
     bool isFirstObservation = !registration.previousThresholdIndex;
 
-    RenderBlock* rootRenderer = nullptr;
     RenderElement* targetRenderer = nullptr;
     IntersectionObservationState intersectionState;
 
-    auto computeRootBounds = [&]() {
-        targetRenderer = target.renderer();
-        if (!targetRenderer)
-            return;
-
+    // The root renderer and its bounds don't depend on the target, so they are
+    // computed once per update pass and reused for every observed element.
+    if (!rootSnapshot.computed) {
+        rootSnapshot.computed = true;
         if (root()) {
-            if (trackingDocument() != &target.document())
-                return;
-
-            if (!root()->renderer())
-                return;
+            if (root()->renderer()) {
+                if (auto* rootRenderer = dynamicDowncast<RenderBlock>(root()->renderer())) {
+                    rootSnapshot.rootRenderer = rootRenderer;
+                    if (root() == trackingDocument())
+                        rootSnapshot.rootBounds = frameView.layoutViewportRect();
+                    else if (rootRenderer->hasNonVisibleOverflow())
+                        rootSnapshot.rootBounds = rootRenderer->contentBoxRect();
+                    else
+                        rootSnapshot.rootBounds = { FloatPoint(), rootRenderer->size() };
+                }
+            }
+        } else {
+            ASSERT(frameView.frame().isMainFrame());
+            rootSnapshot.rootRenderer = frameView.renderView();
+            rootSnapshot.rootBounds = frameView.layoutViewportRect();
+        }
+    }
 
-            rootRenderer = dynamicDowncast<RenderBlock>(root()->renderer());
-            if (!rootRenderer || !rootRenderer->isContainingBlockAncestorFor(*targetRenderer))
-                return;
+    RenderBlock* rootRenderer = rootSnapshot.rootRenderer;
 
-            intersectionState.canComputeIntersection = true;
-            if (root() == &target.document())
-                intersectionState.rootBounds = frameView.layoutViewportRect();
-            else if (rootRenderer->hasNonVisibleOverflow())
-                intersectionState.rootBounds = rootRenderer->contentBoxRect();
-            else
-                intersectionState.rootBounds = { FloatPoint(), rootRenderer->size() };
+    auto canComputeIntersection = [&]() {
+        targetRenderer = target.renderer();
+        if (!targetRenderer || !rootRenderer)
+            return false;
 
-            return;
-        }
+        if (root())
+            return trackingDocument() == &target.document() && rootRenderer->isContainingBlockAncestorFor(*targetRenderer);
 
-        ASSERT(frameView.frame().isMainFrame());
         // FIXME: Handle the case of an implicit-root observer that has a target in a different frame tree.
-        if (&targetRenderer->frame().mainFrame() != &frameView.frame())
-            return;
-
-        intersectionState.canComputeIntersection = true;
-        rootRenderer = frameView.renderView();
-        intersectionState.rootBounds = frameView.layoutViewportRect();
+        return &targetRenderer->frame().mainFrame() == &frameView.frame();
     };
 
-    computeRootBounds();
+    intersectionState.canComputeIntersection = canComputeIntersection();
     if (!intersectionState.canComputeIntersection) {
         intersectionState.observationChanged = isFirstObservation || *registration.previousThresholdIndex != 0;
         return intersectionState;
     }
 
-    if (applyRootMargin)
-        expandRootBoundsWithRootMargin(intersectionState.rootBounds, rootMarginBox(), rootRenderer->style().usedZoom());
+    if (applyRootMargin) {
+        if (!rootSnapshot.rootBoundsWithRootMargin) {
+            auto expandedBounds = rootSnapshot.rootBounds;
+            expandRootBoundsWithRootMargin(expandedBounds, rootMarginBox(), rootRenderer->style().usedZoom());
+            rootSnapshot.rootBoundsWithRootMargin = expandedBounds;
+        }
+        intersectionState.rootBounds = *rootSnapshot.rootBoundsWithRootMargin;
+    } else
+        intersectionState.rootBounds = rootSnapshot.rootBounds;
 
     auto localTargetBounds = [&]() -> LayoutRect {
         if (CheckedPtr renderBox = dynamicDowncast<RenderBox>(*targetRenderer))
@@ -464,6 +470,7 @@ auto IntersectionObserver::updateObservations(Document& hostDocument) -> NeedNot
         return NeedNotify::No;
 
     auto needNotify = NeedNotify::No;
+    RootBoundsSnapshot rootBoundsSnapshot;
 
     for (auto& target : observationTargets()) {
         auto& targetRegistrations = target->intersectionObserverDataIfExists()->registrations;
@@ -474,7 +481,7 @@ auto IntersectionObserver::updateObservations(Document& hostDocument) -> NeedNot
         auto& registration = targetRegistrations[index];
 
         bool isSameOriginObservation = &target->document() == &hostDocument || target->document().protectedSecurityOrigin()->isSameOriginDomain(hostDocument.securityOrigin());
-        auto intersectionState = computeIntersectionState(registration, *frameView, *target, isSameOriginObservation);
+        auto intersectionState = computeIntersectionState(registration, *frameView, *target, isSameOriginObservation, rootBoundsSnapshot);
 
         if (intersectionState.observationChanged) {
             FloatRect targetBoundingClientRect;
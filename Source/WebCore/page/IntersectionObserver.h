@@ -47,6 +47,7 @@ class ContainerNode;
 class Document;
 class Element;
 class IntersectionObserverEntry;
+class RenderBlock;
 
 struct IntersectionObserverRegistration {
     WeakPtr<IntersectionObserver> observer;
@@ -130,7 +131,16 @@ private:
         bool observationChanged { false };
     };
 
-    IntersectionObservationState computeIntersectionState(const IntersectionObserverRegistration&, LocalFrameView&, Element& target, bool applyRootMargin) const;
+    // The root geometry is the same for every target in one update pass, so
+    // updateObservations() computes it once and shares it across targets.
+    struct RootBoundsSnapshot {
+        RenderBlock* rootRenderer { nullptr };
+        FloatRect rootBounds;
+        std::optional<FloatRect> rootBoundsWithRootMargin;
+        bool computed { false };
+    };
+
+    IntersectionObservationState computeIntersectionState(const IntersectionObserverRegistration&, LocalFrameView&, Element& target, bool applyRootMargin, RootBoundsSnapshot&) const;
 
     WeakPtr<Document, WeakPtrImplWithEventTargetData> m_implicitRootDocument;
     WeakPtr<ContainerNode, WeakPtrImplWithEventTargetData> m_root;
@@ -47,6 +47,7 @@
 #include "LayoutTreeBuilder.h"
 #include "RenderDescendantIterator.h"
 #include "RenderStyleInlines.h"
+#include <wtf/PerformanceCounter.h>
 #include <wtf/SetForScope.h>
 #include <wtf/SystemTracing.h>
 #include <wtf/TZoneMallocInlines.h>
@@ -56,6 +57,10 @@ namespace WebCore {
 
 WTF_MAKE_TZONE_ALLOCATED_IMPL(LocalFrameViewLayoutContext);
 
+PERFORMANCE_COUNTER(performLayoutsCounter, "layout.performLayouts");
+PERFORMANCE_COUNTER(subtreeLayoutsCounter, "layout.subtreeLayouts");
+PERFORMANCE_COUNTER(simplifiedLayoutsCounter, "layout.simplifiedLayouts");
+
 UpdateScrollInfoAfterLayoutTransaction::UpdateScrollInfoAfterLayoutTransaction() = default;
 UpdateScrollInfoAfterLayoutTransaction::~UpdateScrollInfoAfterLayoutTransaction() = default;
 
@@ -229,6 +234,13 @@ void LocalFrameViewLayoutContext::performLayout()
     }
 
     auto isSimplifiedLayout = layoutRoot->needsSimplifiedNormalFlowLayoutOnly();
+
+    PERFORMANCE_COUNTER_INCREMENT(performLayoutsCounter);
+    if (subtreeLayoutRoot())
+        PERFORMANCE_COUNTER_INCREMENT(subtreeLayoutsCounter);
+    if (isSimplifiedLayout)
+        PERFORMANCE_COUNTER_INCREMENT(simplifiedLayoutsCounter);
+
     {
         TraceScope tracingScope(RenderTreeLayoutStart, RenderTreeLayoutEnd);
         SetForScope layoutPhase(m_layoutPhase, LayoutPhase::InRenderTreeLayout);
@@ -262,7 +262,7 @@ void logMemoryStatistics(LogMemoryStatisticsReason reason)
 #endif
 
 #if !PLATFORM(COCOA)
-#if !USE(SKIA)
+#if !USE(SKIA) && !PLATFORM(HAIKU)
 void platformReleaseMemory(Critical) { }
 #endif
 void platformReleaseGraphicsMemory(Critical) { }
@@ -751,6 +751,15 @@ public:
     WEBCORE_EXPORT void startTrackingRenderingUpdates();
     WEBCORE_EXPORT unsigned renderingUpdateCount() const;
 
+    bool isInRenderingUpdate() const { return !m_renderingUpdateRemainingSteps.isEmpty(); }
+
+    // Counts synchronous layouts forced by script outside the rendering
+    // update, i.e. layout-querying DOM APIs hit after an invalidation.
+    // Cheap enough to stay on unconditionally; embedders can poll and diff.
+    void countForcedLayout(Seconds duration) { ++m_forcedLayoutCount; m_forcedLayoutDuration += duration; }
+    unsigned forcedLayoutCount() const { return m_forcedLayoutCount; }
+    Seconds forcedLayoutDuration() const { return m_forcedLayoutDuration; }
+
     WEBCORE_EXPORT void suspendScriptedAnimations();
     WEBCORE_EXPORT void resumeScriptedAnimations();
     bool scriptedAnimationsSuspended() const { return m_scriptedAnimationsSuspended; }
@@ -1459,6 +1468,8 @@ private:
 
     unsigned m_renderingUpdateCount { 0 };
     bool m_isTrackingRenderingUpdates { false };
+    unsigned m_forcedLayoutCount { 0 };
+    Seconds m_forcedLayoutDuration;
 
     bool m_isClosing { false };
     bool m_isRestoringCachedPage { false };
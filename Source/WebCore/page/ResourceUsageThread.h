@@ -91,7 +91,7 @@ private:
 #if ENABLE(SAMPLING_PROFILER)
 #if OS(DARWIN)
     mach_port_t m_samplingProfilerMachThread { MACH_PORT_NULL };
-#elif OS(LINUX)
+#elif OS(LINUX) || OS(HAIKU)
     pid_t m_samplingProfilerThreadID { 0 };
 #endif
 #endif
@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "ResourceUsageThread.h"
+
+#if ENABLE(RESOURCE_USAGE) && OS(HAIKU)
+
+#include "MemoryCache.h"
+#include "WorkerThread.h"
+#include <JavaScriptCore/GCActivityCallback.h>
+#include <JavaScriptCore/SamplingProfiler.h>
+#include <JavaScriptCore/VM.h>
+#include <OS.h>
+#include <unistd.h>
+#include <wtf/MainThread.h>
+#include <wtf/Threading.h>
+#include <wtf/haiku/CurrentProcessMemoryStatus.h>
+
+#if USE(TILED_BACKING_STORE)
+#include "TileHaiku.h"
+#endif
+
+namespace WebCore {
+
+void ResourceUsageThread::platformSaveStateBeforeStarting()
+{
+#if ENABLE(SAMPLING_PROFILER)
+    m_samplingProfilerThreadID = 0;
+
+    if (auto* profiler = m_vm->samplingProfiler()) {
+        if (auto* thread = profiler->thread())
+            m_samplingProfilerThreadID = thread->id();
+    }
+#endif
+}
+
+struct ThreadCPUTime {
+    String name;
+    float cpuUsage { 0 };
+    bigtime_t previousTime { 0 };
+    bool sampledThisPeriod { false };
+};
+
+static HashMap<thread_id, ThreadCPUTime>& threadTimeMap()
+{
+    static LazyNeverDestroyed<HashMap<thread_id, ThreadCPUTime>> map;
+    static std::once_flag flag;
+    std::call_once(flag, [&] {
+        map.construct();
+    });
+    return map;
+}
+
+// Walks the team's threads and computes each thread's CPU usage as a
+// percentage of one core over the time elapsed since the previous walk.
+// Returns false on the first walk, when there is no baseline yet.
+static bool collectCPUUsage()
+{
+    static bigtime_t previousSampleTime = 0;
+    bigtime_t now = system_time();
+    bigtime_t period = now - previousSampleTime;
+    bool havePeriod = previousSampleTime && period > 0;
+    previousSampleTime = now;
+
+    for (auto& info : threadTimeMap().values())
+        info.sampledThisPeriod = false;
+
+    thread_info info;
+    int32 cookie = 0;
+    while (get_next_thread_info(B_CURRENT_TEAM, &cookie, &info) == B_OK) {
+        auto& timeInfo = threadTimeMap().add(info.thread, ThreadCPUTime()).iterator->value;
+        if (timeInfo.name.isEmpty())
+            timeInfo.name = String::fromUTF8(info.name);
+
+        bigtime_t time = info.user_time + info.kernel_time;
+        if (havePeriod)
+            timeInfo.cpuUsage = clampTo<float>((time - timeInfo.previousTime) * 100.0 / period, 0, 100);
+        timeInfo.previousTime = time;
+        timeInfo.sampledThisPeriod = true;
+    }
+
+    // Threads that are gone took their CPU time with them.
+    threadTimeMap().removeIf([](auto& entry) {
+        return !entry.value.sampledThisPeriod;
+    });
+
+    return havePeriod;
+}
+
+void ResourceUsageThread::platformCollectCPUData(JSC::VM*, ResourceUsageData& data)
+{
+    if (!collectCPUUsage()) {
+        data.cpu = 0;
+        data.cpuExcludingDebuggerThreads = 0;
+        return;
+    }
+
+    thread_id resourceUsageThreadID = find_thread(NULL);
+
+    HashSet<thread_id> knownWebKitThreads;
+    {
+        Locker locker { Thread::allThreadsLock() };
+        for (auto* thread : Thread::allThreads()) {
+            if (auto id = thread->id())
+                knownWebKitThreads.add(id);
+        }
+    }
+
+    HashMap<thread_id, String> knownWorkerThreads;
+    {
+        for (auto& thread : WorkerOrWorkletThread::workerOrWorkletThreads()) {
+            // Ignore worker threads that have not been fully started yet.
+            if (!thread.thread())
+                continue;
+
+            if (auto id = thread.thread()->id())
+                knownWorkerThreads.set(id, thread.inspectorIdentifier().isolatedCopy());
+        }
+    }
+
+    auto isDebuggerThread = [&](thread_id id) -> bool {
+        if (id == resourceUsageThreadID)
+            return true;
+#if ENABLE(SAMPLING_PROFILER)
+        if (id == m_samplingProfilerThreadID)
+            return true;
+#endif
+        return false;
+    };
+
+    auto isWebKitThread = [&](thread_id id, const String& name) -> bool {
+        if (knownWebKitThreads.contains(id))
+            return true;
+
+        // The bmalloc scavenger thread is below WTF. Detect it by its name.
+        if (name == "BMScavenger"_s)
+            return true;
+
+        return false;
+    };
+
+    for (const auto& it : threadTimeMap()) {
+        float cpuUsage = it.value.cpuUsage;
+        thread_id id = it.key;
+        data.cpu += cpuUsage;
+        if (isDebuggerThread(id))
+            continue;
+
+        data.cpuExcludingDebuggerThreads += cpuUsage;
+
+        // The team's main thread shares the team's id, which getpid() returns.
+        if (getpid() == id)
+            data.cpuThreads.append(ThreadCPUInfo { "Main Thread"_s, { }, cpuUsage, ThreadCPUInfo::Type::Main });
+        else {
+            String threadIdentifier = knownWorkerThreads.get(id);
+            bool isWorkerThread = !threadIdentifier.isEmpty();
+            ThreadCPUInfo::Type type = (isWorkerThread || isWebKitThread(id, it.value.name)) ? ThreadCPUInfo::Type::WebKit : ThreadCPUInfo::Type::Unknown;
+            data.cpuThreads.append(ThreadCPUInfo { it.value.name, threadIdentifier, cpuUsage, type });
+        }
+    }
+}
+
+void ResourceUsageThread::platformCollectMemoryData(JSC::VM* vm, ResourceUsageData& data)
+{
+    ProcessMemoryStatus memoryStatus;
+    currentProcessMemoryStatus(memoryStatus);
+    data.totalDirtySize = memoryStatus.resident - memoryStatus.shared;
+
+    size_t currentGCHeapCapacity = vm->heap.blockBytesAllocated();
+    size_t currentGCOwnedExtra = vm->heap.extraMemorySize();
+    size_t currentGCOwnedExternal = vm->heap.externalMemorySize();
+    RELEASE_ASSERT(currentGCOwnedExternal <= currentGCOwnedExtra);
+
+    data.categories[MemoryCategory::GCHeap].dirtySize = currentGCHeapCapacity;
+    data.categories[MemoryCategory::GCOwned].dirtySize = currentGCOwnedExtra - currentGCOwnedExternal;
+    data.categories[MemoryCategory::GCOwned].externalSize = currentGCOwnedExternal;
+
+    int imagesDecodedSize = 0;
+    callOnMainThreadAndWait([&imagesDecodedSize] {
+        imagesDecodedSize = MemoryCache::singleton().getStatistics().images.decodedSize;
+    });
+    data.categories[MemoryCategory::Images].dirtySize = imagesDecodedSize;
+
+#if USE(TILED_BACKING_STORE)
+    data.categories[MemoryCategory::Layers].dirtySize = TileHaiku::memoryUsage();
+#endif
+
+    size_t categoriesTotalSize = 0;
+    for (auto& category : data.categories)
+        categoriesTotalSize += category.totalSize();
+    data.categories[MemoryCategory::Other].dirtySize = data.totalDirtySize - categoriesTotalSize;
+
+    data.totalExternalSize = currentGCOwnedExternal;
+
+    data.timeOfNextEdenCollection = data.timestamp + vm->heap.edenActivityCallback()->timeUntilFire().value_or(Seconds(std::numeric_limits<double>::infinity()));
+    data.timeOfNextFullCollection = data.timestamp + vm->heap.fullActivityCallback()->timeUntilFire().value_or(Seconds(std::numeric_limits<double>::infinity()));
+}
+
+} // namespace WebCore
+
+#endif // ENABLE(RESOURCE_USAGE) && OS(HAIKU)
@@ -125,6 +125,7 @@ namespace WebCore {
     M(SQLDatabase) \
     M(Storage) \
     M(StorageAPI) \
+    M(StyleInvalidation) \
     M(StyleSheets) \
     M(SVG) \
     M(TextAutosizing) \
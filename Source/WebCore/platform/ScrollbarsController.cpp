@@ -31,7 +31,7 @@
 
 namespace WebCore {
 
-#if !PLATFORM(MAC) && !PLATFORM(WPE) && !PLATFORM(GTK)
+#if !PLATFORM(MAC) && !PLATFORM(WPE) && !PLATFORM(GTK) && !PLATFORM(HAIKU)
 
 WTF_MAKE_TZONE_ALLOCATED_IMPL(ScrollbarsController);
 
@@ -36,6 +36,14 @@
 #include <Accelerate/Accelerate.h>
 #endif
 
+#if CPU(X86_SSE2)
+#include <emmintrin.h>
+#endif
+
+#if HAVE(ARM_NEON_INTRINSICS)
+#include <arm_neon.h>
+#endif
+
 #include "VectorMath.h"
 #include <wtf/TZoneMallocInlines.h>
 
@@ -46,6 +54,9 @@ WTF_MAKE_TZONE_ALLOCATED_IMPL(DirectConvolver);
 DirectConvolver::DirectConvolver(size_t inputBlockSize)
     : m_inputBlockSize(inputBlockSize)
     , m_buffer(inputBlockSize * 2)
+#if !USE(ACCELERATE) && (CPU(X86_SSE2) || HAVE(ARM_NEON_INTRINSICS))
+    , m_reversedKernel(inputBlockSize)
+#endif
 {
 }
 
@@ -76,6 +87,46 @@ void DirectConvolver::process(AudioFloatArray* convolutionKernel, const float* s
 
 #if USE(ACCELERATE)
     vDSP_conv(inputP - kernelSize + 1, 1, kernelP + kernelSize - 1, -1, destP, 1, framesToProcess, kernelSize);
+#elif CPU(X86_SSE2) || HAVE(ARM_NEON_INTRINSICS)
+    // Reversing the kernel turns each output sample into a dot product over an
+    // ascending input window, which vectorizes without any gather loads. The
+    // reversal costs kernelSize stores per block, negligible next to the
+    // kernelSize * framesToProcess multiply-adds below.
+    float* reversedKernelP = m_reversedKernel.data();
+    for (size_t j = 0; j < kernelSize; ++j)
+        reversedKernelP[j] = kernelP[kernelSize - 1 - j];
+
+    for (size_t i = 0; i < framesToProcess; ++i) {
+        const float* windowP = inputP + i - kernelSize + 1;
+        size_t j = 0;
+        float sum = 0;
+#if CPU(X86_SSE2)
+        // Two accumulators hide the latency of the dependent adds.
+        __m128 sum0 = _mm_setzero_ps();
+        __m128 sum1 = _mm_setzero_ps();
+        for (; j + 8 <= kernelSize; j += 8) {
+            sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(windowP + j), _mm_loadu_ps(reversedKernelP + j)));
+            sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(windowP + j + 4), _mm_loadu_ps(reversedKernelP + j + 4)));
+        }
+        sum0 = _mm_add_ps(sum0, sum1);
+        sum0 = _mm_add_ps(sum0, _mm_movehl_ps(sum0, sum0));
+        sum0 = _mm_add_ss(sum0, _mm_shuffle_ps(sum0, sum0, 0x1));
+        sum = _mm_cvtss_f32(sum0);
+#elif HAVE(ARM_NEON_INTRINSICS)
+        float32x4_t sum0 = vdupq_n_f32(0);
+        float32x4_t sum1 = vdupq_n_f32(0);
+        for (; j + 8 <= kernelSize; j += 8) {
+            sum0 = vmlaq_f32(sum0, vld1q_f32(windowP + j), vld1q_f32(reversedKernelP + j));
+            sum1 = vmlaq_f32(sum1, vld1q_f32(windowP + j + 4), vld1q_f32(reversedKernelP + j + 4));
+        }
+        sum0 = vaddq_f32(sum0, sum1);
+        float32x2_t sumPair = vadd_f32(vget_low_f32(sum0), vget_high_f32(sum0));
+        sum = vget_lane_f32(vpadd_f32(sumPair, sumPair), 0);
+#endif
+        for (; j < kernelSize; ++j)
+            sum += windowP[j] * reversedKernelP[j];
+        destP[i] = sum;
+    }
 #else
     // FIXME: The macro can be further optimized to avoid pipeline stalls. One possibility is to maintain 4 separate sums and change the macro to CONVOLVE_FOUR_SAMPLES.
 #define CONVOLVE_ONE_SAMPLE             \
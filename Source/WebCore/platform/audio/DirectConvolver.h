@@ -49,6 +49,10 @@ private:
     size_t m_inputBlockSize;
 
     AudioFloatArray m_buffer;
+#if !USE(ACCELERATE) && (CPU(X86_SSE2) || HAVE(ARM_NEON_INTRINSICS))
+    // Kernel in reversed order, so process() can convolve with contiguous SIMD loads.
+    AudioFloatArray m_reversedKernel;
+#endif
 };
 
 } // namespace WebCore
@@ -793,8 +793,46 @@ void clamp(const float* inputVector, float minimum, float maximum, float* output
 {
     size_t n = numberOfElementsToProcess;
 
-    // FIXME: Optimize for SSE2.
-#if HAVE(ARM_NEON_INTRINSICS)
+#if CPU(X86_SSE2)
+    // If the inputVector address is not 16-byte aligned, the first several frames (at most three) should be processed separately.
+    while (!is16ByteAligned(inputVector) && n) {
+        *outputVector = std::clamp(*inputVector, minimum, maximum);
+        inputVector++;
+        outputVector++;
+        n--;
+    }
+
+    // Now the inputVector address is aligned and start to apply SSE.
+    size_t group = n / 4;
+    __m128 low = _mm_set_ps1(minimum);
+    __m128 high = _mm_set_ps1(maximum);
+    __m128* pSource;
+    __m128* pDest;
+    __m128 dest;
+
+    if (is16ByteAligned(outputVector)) {
+        while (group--) {
+            pSource = reinterpret_cast<__m128*>(const_cast<float*>(inputVector));
+            pDest = reinterpret_cast<__m128*>(outputVector);
+            *pDest = _mm_max_ps(_mm_min_ps(*pSource, high), low);
+
+            inputVector += 4;
+            outputVector += 4;
+        }
+    } else {
+        while (group--) {
+            pSource = reinterpret_cast<__m128*>(const_cast<float*>(inputVector));
+            dest = _mm_max_ps(_mm_min_ps(*pSource, high), low);
+            _mm_storeu_ps(outputVector, dest);
+
+            inputVector += 4;
+            outputVector += 4;
+        }
+    }
+
+    // Non-SSE handling for remaining frames which is less than 4.
+    n %= 4;
+#elif HAVE(ARM_NEON_INTRINSICS)
     size_t tailFrames = n % 4;
     const float* endP = outputVector + n - tailFrames;
 
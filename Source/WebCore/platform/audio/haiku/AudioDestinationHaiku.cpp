@@ -22,11 +22,15 @@
 
 #include "AudioDestinationHaiku.h"
 
+#include "AudioUtilities.h"
 #include "Logging.h"
+#include <SoundPlayer.h>
+#include <wtf/MainThread.h>
+#include <wtf/MonotonicTime.h>
 
 namespace WebCore {
 
-std::unique_ptr<AudioDestination> AudioDestination::create(AudioIOCallback& callback, const String&, unsigned numberOfInputChannels, unsigned numberOfOutputChannels, float sampleRate)
+Ref<AudioDestination> AudioDestination::create(AudioIOCallback& callback, const String&, unsigned numberOfInputChannels, unsigned numberOfOutputChannels, float sampleRate)
 {
     // FIXME: make use of inputDeviceId as appropriate.
 
@@ -38,7 +42,7 @@ std::unique_ptr<AudioDestination> AudioDestination::create(AudioIOCallback& call
     if (numberOfOutputChannels != 2)
         LOG(Media, "AudioDestination::create(%u, %u, %f) - unhandled output channels", numberOfInputChannels, numberOfOutputChannels, sampleRate);
 
-    return std::make_unique<AudioDestinationHaiku>(callback, sampleRate);
+    return adoptRef(*new AudioDestinationHaiku(callback, numberOfOutputChannels, sampleRate));
 }
 
 float AudioDestination::hardwareSampleRate()
@@ -54,31 +58,81 @@ unsigned long AudioDestination::maxChannelCount()
     return 0;
 }
 
-
-static const unsigned framesToPull = 128;
-AudioDestinationHaiku::AudioDestinationHaiku(AudioIOCallback& callback, float sampleRate)
-    : m_callback(callback)
-    , m_renderBus(AudioBus::create(2, framesToPull, false))
-    , m_sampleRate(sampleRate)
-    , m_isPlaying(false)
+AudioDestinationHaiku::AudioDestinationHaiku(AudioIOCallback& callback, unsigned numberOfOutputChannels, float sampleRate)
+    : AudioDestinationResampler(callback, numberOfOutputChannels, sampleRate, hardwareSampleRate())
 {
-    // FIXME implement
+    media_raw_audio_format format = media_raw_audio_format::wildcard;
+    format.frame_rate = hardwareSampleRate();
+    format.channel_count = numberOfOutputChannels;
+    format.format = media_raw_audio_format::B_AUDIO_FLOAT;
+    format.byte_order = B_MEDIA_HOST_ENDIAN;
+    // A few render quanta per buffer keeps output latency low; the FIFO in
+    // AudioDestinationResampler is what absorbs longer render-thread stalls.
+    format.buffer_size = 4 * AudioUtilities::renderQuantumSize * numberOfOutputChannels * sizeof(float);
+
+    m_soundPlayer = new BSoundPlayer(&format, "WebAudio", playBuffer, nullptr, this);
 }
 
-
 AudioDestinationHaiku::~AudioDestinationHaiku()
 {
+    if (m_soundPlayer)
+        m_soundPlayer->Stop();
+    delete m_soundPlayer;
+}
+
+void AudioDestinationHaiku::startRendering(CompletionHandler<void(bool)>&& completionHandler)
+{
+    ASSERT(isMainThread());
+    bool success = m_soundPlayer->InitCheck() == B_OK && m_soundPlayer->Start() == B_OK;
+    if (success) {
+        m_soundPlayer->SetHasData(true);
+        setIsPlaying(true);
+    }
+
+    callOnMainThread([completionHandler = WTFMove(completionHandler), success]() mutable {
+        completionHandler(success);
+    });
 }
 
+void AudioDestinationHaiku::stopRendering(CompletionHandler<void(bool)>&& completionHandler)
+{
+    ASSERT(isMainThread());
+    m_soundPlayer->Stop();
+    setIsPlaying(false);
+
+    callOnMainThread([completionHandler = WTFMove(completionHandler)]() mutable {
+        completionHandler(true);
+    });
+}
 
-void AudioDestinationHaiku::start()
+void AudioDestinationHaiku::playBuffer(void* cookie, void* buffer, size_t size, const media_raw_audio_format& format)
 {
-    // FIXME implement
+    auto& destination = *static_cast<AudioDestinationHaiku*>(cookie);
+    destination.render(static_cast<float*>(buffer), size / (format.channel_count * sizeof(float)));
 }
 
-void AudioDestinationHaiku::stop()
+// Pulls rendered frames out of the FIFO and interleaves them for the sound player.
+void AudioDestinationHaiku::render(float* interleavedBuffer, size_t numberOfFrames)
 {
-    // FIXME implement
+    ASSERT(!isMainThread());
+
+    size_t numberOfChannels = m_outputBus->numberOfChannels();
+    if (m_planarBuffer.size() < numberOfChannels * numberOfFrames)
+        m_planarBuffer.grow(numberOfChannels * numberOfFrames);
+
+    for (size_t channel = 0; channel < numberOfChannels; ++channel)
+        m_outputBus->setChannelMemory(channel, m_planarBuffer.data() + channel * numberOfFrames, numberOfFrames);
+
+    size_t framesToRender = pullRendered(numberOfFrames);
+    AudioDestinationResampler::render(m_framesRendered / static_cast<double>(hardwareSampleRate()), MonotonicTime::now(), framesToRender);
+    m_framesRendered += numberOfFrames;
+
+    for (size_t channel = 0; channel < numberOfChannels; ++channel) {
+        const float* source = m_planarBuffer.data() + channel * numberOfFrames;
+        float* destination = interleavedBuffer + channel;
+        for (size_t frame = 0; frame < numberOfFrames; ++frame, destination += numberOfChannels)
+            *destination = source[frame];
+    }
 }
 
 } // namespace WebCore
@@ -19,32 +19,43 @@
 #ifndef AudioDestinationHaiku_h
 #define AudioDestinationHaiku_h
 
-#include "AudioDestination.h"
+#if ENABLE(WEB_AUDIO)
 
-#include "AudioBus.h"
+#include "AudioDestinationResampler.h"
+
+#include <wtf/RefCounted.h>
+#include <wtf/Vector.h>
+
+class BSoundPlayer;
+struct media_raw_audio_format;
 
 namespace WebCore {
 
-class AudioDestinationHaiku : public AudioDestination {
+// Renders the WebAudio graph through a BSoundPlayer. The base class FIFO
+// decouples the graph renderer from the player callback, so main-thread
+// pauses (GC, layout) only cost buffered frames instead of glitching.
+class AudioDestinationHaiku : public AudioDestinationResampler, public RefCounted<AudioDestinationHaiku> {
 public:
-    AudioDestinationHaiku(AudioIOCallback&, float sampleRate);
-    ~AudioDestinationHaiku();
-
-    void start() override;
-    void stop() override;
+    AudioDestinationHaiku(AudioIOCallback&, unsigned numberOfOutputChannels, float sampleRate);
+    virtual ~AudioDestinationHaiku();
 
-    bool isPlaying() override { return m_isPlaying; }
-    float sampleRate() const override { return m_sampleRate; }
-    //AudioIOCallback& callback() const override { return m_callback; }
+    void ref() const final { RefCounted<AudioDestinationHaiku>::ref(); }
+    void deref() const final { RefCounted<AudioDestinationHaiku>::deref(); }
 
 private:
-    AudioIOCallback& m_callback;
-    RefPtr<AudioBus> m_renderBus;
+    void startRendering(CompletionHandler<void(bool)>&&) final;
+    void stopRendering(CompletionHandler<void(bool)>&&) final;
 
-    float m_sampleRate;
-    bool m_isPlaying;
+    static void playBuffer(void*, void* buffer, size_t size, const media_raw_audio_format&);
+    void render(float* interleavedBuffer, size_t numberOfFrames);
+
+    BSoundPlayer* m_soundPlayer { nullptr };
+    Vector<float> m_planarBuffer;
+    size_t m_framesRendered { 0 };
 };
 
 } // namespace WebCore
 
+#endif // ENABLE(WEB_AUDIO)
+
 #endif // AudioDestinationHaiku_h
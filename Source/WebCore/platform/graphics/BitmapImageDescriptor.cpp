@@ -210,6 +210,12 @@ SubsamplingLevel BitmapImageDescriptor::maximumSubsamplingLevel() const
             break;
     }
 
+    // Decoders that cannot subsample report the same frame size at every
+    // level; treat them as having no subsampling levels at all rather than
+    // pretending deeper levels exist.
+    if (level != SubsamplingLevel::Default && m_source.frameSizeAtIndex(0, level) == m_source.frameSizeAtIndex(0, SubsamplingLevel::Default))
+        level = SubsamplingLevel::Default;
+
     m_maximumSubsamplingLevel = level;
     m_cachedFlags.add(CachedFlag::MaximumSubsamplingLevel);
     return m_maximumSubsamplingLevel;
@@ -217,13 +223,17 @@ SubsamplingLevel BitmapImageDescriptor::maximumSubsamplingLevel() const
 
 SubsamplingLevel BitmapImageDescriptor::subsamplingLevelForScaleFactor(GraphicsContext& context, const FloatSize& scaleFactor, AllowImageSubsampling allowImageSubsampling) const
 {
-#if USE(CG)
+#if USE(CG) || USE(HAIKU)
     if (allowImageSubsampling == AllowImageSubsampling::No)
         return SubsamplingLevel::Default;
 
+#if USE(CG)
     // Never use subsampled images for drawing into PDF contexts.
     if (context.hasPlatformContext() && CGContextGetType(context.platformContext()) == kCGContextTypePDF)
         return SubsamplingLevel::Default;
+#else
+    UNUSED_PARAM(context);
+#endif
 
     float scale = std::min(float(1), std::max(scaleFactor.width(), scaleFactor.height()));
     if (!(scale > 0 && scale <= 1))
@@ -481,9 +481,11 @@ FontCache::PrewarmInformation FontCache::collectPrewarmInformation() const
     return { };
 }
 
+#if !PLATFORM(HAIKU)
 void FontCache::prewarmGlobally()
 {
 }
+#endif
 
 void FontCache::prewarm(PrewarmInformation&&)
 {
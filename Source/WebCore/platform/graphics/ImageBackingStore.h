@@ -69,6 +69,9 @@ public:
         buffer.grow(bufferSize);
         m_pixels = FragmentedSharedBuffer::DataSegment::create(WTFMove(buffer));
         m_pixelsPtr = reinterpret_cast<uint32_t*>(const_cast<uint8_t*>(m_pixels->span().data()));
+#if USE(HAIKU)
+        m_image = nullptr;
+#endif
         m_size = size;
         m_frameRect = IntRect(IntPoint(), m_size);
         clear();
@@ -237,6 +240,12 @@ private:
     // m_pixels type should be identical to the one set in ImageBackingStoreCairo.cpp
     RefPtr<FragmentedSharedBuffer::DataSegment> m_pixels;
     uint32_t* m_pixelsPtr { nullptr };
+#if USE(HAIKU)
+    // Progressive decodes call image() once per scan; keep the BBitmap so
+    // partial frames are upgraded in place instead of allocating a fresh
+    // app_server area each time. Reset when the store is resized.
+    mutable PlatformImagePtr m_image;
+#endif
     IntSize m_size;
     IntRect m_frameRect; // This will always just be the entire buffer except for GIF and PNG frames
     bool m_premultiplyAlpha { true };
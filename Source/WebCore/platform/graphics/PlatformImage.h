@@ -32,6 +32,7 @@ typedef struct CGImage* CGImageRef;
 #include "RefPtrCairo.h"
 #elif USE(HAIKU)
 #include <Bitmap.h>
+#include <wtf/ThreadSafeRefCounted.h>
 #elif USE(SKIA)
 #include <skia/core/SkImage.h>
 #endif
@@ -43,7 +44,9 @@ using PlatformImagePtr = RetainPtr<CGImageRef>;
 #elif USE(CAIRO)
 using PlatformImagePtr = RefPtr<cairo_surface_t>;
 #elif USE(HAIKU)
-class BitmapRef: public BBitmap, public RefCounted<BitmapRef>
+// Thread-safe refcounting because images cross threads: an OffscreenCanvas
+// rendered in a Worker hands its frames to the main thread for display.
+class BitmapRef: public BBitmap, public ThreadSafeRefCounted<BitmapRef>
 {
     public:
         BitmapRef(BRect r, uint32 f, color_space c, int32 b)
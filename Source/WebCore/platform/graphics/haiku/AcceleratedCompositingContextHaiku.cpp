@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "AcceleratedCompositingContextHaiku.h"
+
+#if USE(TEXTURE_MAPPER) && PLATFORM(HAIKU)
+
+#include "GraphicsLayerTextureMapper.h"
+#include "TextureMapper.h"
+#include "TextureMapperLayer.h"
+
+#include <GLView.h>
+#include <wtf/MonotonicTime.h>
+
+namespace WebCore {
+
+AcceleratedCompositingContextHaiku::AcceleratedCompositingContextHaiku(BGLView* view)
+    : m_view(view)
+{
+}
+
+AcceleratedCompositingContextHaiku::~AcceleratedCompositingContextHaiku()
+{
+    // The TextureMapper owns GL resources; destroy it with the context
+    // current so they are actually released.
+    if (m_textureMapper) {
+        m_view->LockGL();
+        m_textureMapper = nullptr;
+        m_view->UnlockGL();
+    }
+}
+
+void AcceleratedCompositingContextHaiku::setRootLayer(GraphicsLayer* rootLayer)
+{
+    m_rootLayer = rootLayer;
+}
+
+void AcceleratedCompositingContextHaiku::setViewportSize(const IntSize& size)
+{
+    m_viewportSize = size;
+}
+
+void AcceleratedCompositingContextHaiku::ensureTextureMapper()
+{
+    if (m_textureMapper)
+        return;
+
+    // Must be called with the GL context locked.
+    m_textureMapper = TextureMapper::create();
+}
+
+bool AcceleratedCompositingContextHaiku::flushAndRenderLayers()
+{
+    if (!m_rootLayer || m_viewportSize.isEmpty())
+        return false;
+
+    FloatRect visibleRect(FloatPoint(), m_viewportSize);
+    m_rootLayer->flushCompositingStateForThisLayerOnly();
+
+    m_view->LockGL();
+    ensureTextureMapper();
+
+    auto& rootLayer = downcast<GraphicsLayerTextureMapper>(*m_rootLayer);
+    rootLayer.updateBackingStoreIncludingSubLayers(*m_textureMapper);
+
+    bool needsAnotherFrame = rootLayer.layer().applyAnimationsRecursively(MonotonicTime::now());
+
+    m_textureMapper->beginPainting();
+    rootLayer.layer().paint(*m_textureMapper);
+    m_textureMapper->endPainting();
+
+    m_view->SwapBuffers();
+    m_view->UnlockGL();
+
+    return needsAnotherFrame;
+}
+
+} // namespace WebCore
+
+#endif
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#if USE(TEXTURE_MAPPER) && PLATFORM(HAIKU)
+
+#include "GraphicsLayer.h"
+#include "IntSize.h"
+
+#include <memory>
+
+class BGLView;
+
+namespace WebCore {
+
+class TextureMapper;
+
+// Renders a GraphicsLayerTextureMapper tree through the GPU into a BGLView.
+// The view embedder (BWebView) owns the BGLView; we drive state flushing,
+// backing store updates and the TextureMapper paint on each frame.
+class AcceleratedCompositingContextHaiku {
+    WTF_MAKE_NONCOPYABLE(AcceleratedCompositingContextHaiku);
+public:
+    explicit AcceleratedCompositingContextHaiku(BGLView*);
+    ~AcceleratedCompositingContextHaiku();
+
+    void setRootLayer(GraphicsLayer*);
+    void setViewportSize(const IntSize&);
+
+    // Commits pending layer state, uploads dirty backing stores and paints
+    // the tree. Returns true if another frame is needed (running animations).
+    bool flushAndRenderLayers();
+
+private:
+    void ensureTextureMapper();
+
+    BGLView* m_view;
+    GraphicsLayer* m_rootLayer { nullptr };
+    IntSize m_viewportSize;
+    std::unique_ptr<TextureMapper> m_textureMapper;
+};
+
+} // namespace WebCore
+
+#endif
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "BitmapPoolHaiku.h"
+
+#if PLATFORM(HAIKU)
+
+#include <wtf/NeverDestroyed.h>
+
+namespace WebCore {
+
+// A buffer idle longer than this is assumed to belong to a burst that has
+// ended (scroll stopped, tiles settled) and is given back to the OS.
+static const bigtime_t kIdleEvictionDelay = 3000000;
+
+// Upper bound on pooled bytes; with 512x512 RGBA tiles this is roomy
+// enough for a full screen of churn and small next to the tile buffers
+// themselves.
+static const size_t kMaxPooledBytes = 32 * 1024 * 1024;
+
+BitmapPoolHaiku& BitmapPoolHaiku::singleton()
+{
+    static NeverDestroyed<BitmapPoolHaiku> pool;
+    return pool;
+}
+
+std::unique_ptr<BBitmap> BitmapPoolHaiku::acquire(BRect bounds, color_space colorSpace, uint32 flags)
+{
+    {
+        Locker locker { m_lock };
+        evictStale();
+        for (size_t i = 0; i < m_pool.size(); i++) {
+            BBitmap* candidate = m_pool[i].bitmap.get();
+            if (candidate->Bounds() == bounds
+                && candidate->ColorSpace() == colorSpace
+                && candidate->Flags() == flags) {
+                auto bitmap = WTFMove(m_pool[i].bitmap);
+                m_pool.remove(i);
+                m_pooledBytes -= bitmap->BitsLength();
+                return bitmap;
+            }
+        }
+    }
+
+    auto bitmap = std::make_unique<BBitmap>(bounds, flags, colorSpace);
+    if (bitmap->InitCheck() != B_OK)
+        return nullptr;
+    return bitmap;
+}
+
+void BitmapPoolHaiku::release(std::unique_ptr<BBitmap> bitmap)
+{
+    if (!bitmap || bitmap->InitCheck() != B_OK)
+        return;
+
+    size_t bytes = bitmap->BitsLength();
+    if (bytes > kMaxPooledBytes)
+        return;
+
+    Locker locker { m_lock };
+    // Oldest entries go first when over budget; they are the least likely
+    // to match the next burst's geometry.
+    while (m_pooledBytes + bytes > kMaxPooledBytes && !m_pool.isEmpty()) {
+        m_pooledBytes -= m_pool.first().bitmap->BitsLength();
+        m_pool.remove(0);
+    }
+    m_pooledBytes += bytes;
+    m_pool.append({ WTFMove(bitmap), system_time() });
+    evictStale();
+}
+
+void BitmapPoolHaiku::evictAll()
+{
+    Locker locker { m_lock };
+    m_pool.clear();
+    m_pooledBytes = 0;
+}
+
+size_t BitmapPoolHaiku::memoryUsage() const
+{
+    Locker locker { m_lock };
+    return m_pooledBytes;
+}
+
+void BitmapPoolHaiku::evictStale()
+{
+    bigtime_t now = system_time();
+    while (!m_pool.isEmpty() && now - m_pool.first().pooledAt > kIdleEvictionDelay) {
+        m_pooledBytes -= m_pool.first().bitmap->BitsLength();
+        m_pool.remove(0);
+    }
+}
+
+} // namespace WebCore
+
+#endif // PLATFORM(HAIKU)
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#if PLATFORM(HAIKU)
+
+#include <Bitmap.h>
+#include <OS.h>
+
+#include <memory>
+#include <wtf/Lock.h>
+#include <wtf/Vector.h>
+
+namespace WebCore {
+
+// Recycles BBitmap buffers so repeated allocations of the same geometry --
+// tile back buffers churning during a scroll are the heavy user -- do not
+// round-trip to app_server every time. Buffers are matched on exact bounds,
+// color space and flags; a BBitmap's row layout is fixed at creation, so
+// unlike a malloc-style pool a larger buffer cannot stand in for a smaller
+// one. Returned buffers that sit unused for a few seconds are released back
+// to the OS on the next pool operation, and memory pressure empties the
+// pool outright.
+//
+// Thread-safe: tiles acquire on raster workers and release on the main
+// thread.
+class BitmapPoolHaiku {
+public:
+    static BitmapPoolHaiku& singleton();
+
+    std::unique_ptr<BBitmap> acquire(BRect bounds, color_space, uint32 flags);
+    void release(std::unique_ptr<BBitmap>);
+
+    // Frees every pooled buffer immediately. Called under memory pressure.
+    void evictAll();
+
+    size_t memoryUsage() const;
+
+private:
+    struct PooledBitmap {
+        std::unique_ptr<BBitmap> bitmap;
+        bigtime_t pooledAt;
+    };
+
+    void evictStale() WTF_REQUIRES_LOCK(m_lock);
+
+    mutable Lock m_lock;
+    Vector<PooledBitmap, 16> m_pool WTF_GUARDED_BY_LOCK(m_lock);
+    size_t m_pooledBytes WTF_GUARDED_BY_LOCK(m_lock) { 0 };
+};
+
+} // namespace WebCore
+
+#endif // PLATFORM(HAIKU)
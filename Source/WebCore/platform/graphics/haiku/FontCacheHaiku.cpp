@@ -34,12 +34,16 @@
 #include "FontCache.h"
 
 #include "Font.h"
+#include "FontDescription.h"
 #include "FontPlatformData.h"
 #include "NotImplemented.h"
 #include "Font.h"
 #include <Font.h>
 #include <String.h>
 #include <interface/Font.h>
+#include <unicode/uchar.h>
+#include <wtf/HashMap.h>
+#include <wtf/NeverDestroyed.h>
 
 namespace WebCore {
 
@@ -50,12 +54,49 @@ void FontCache::platformInit()
 
 RefPtr<Font> FontCache::systemFallbackForCharacterCluster(const FontDescription& description,
 	const Font& /*originalFontData*/, WebCore::IsForPlatformFont,
-	WebCore::FontCache::PreferColoredFont, StringView)
+	WebCore::FontCache::PreferColoredFont, StringView stringView)
 {
-    FontPlatformData data(description, AtomString::fromUTF8("Sans"));
-        // FIXME check that the requested characters are actually available,
-        // and try to use the other info in the arguments (should this be
-        // monospace, etc)
+    // Pick a family whose coverage, as reported by app_server, includes the
+    // cluster's base character. The answer is memoized per Unicode block, so
+    // pages mixing scripts resolve fallback with a hash lookup instead of
+    // re-querying app_server for every run.
+    char32_t character = ' ';
+    for (char32_t codePoint : stringView.codePoints()) {
+        character = codePoint;
+        break;
+    }
+
+    static NeverDestroyed<HashMap<uint32_t, AtomString>> fallbackFamilyByBlock;
+    uint32_t blockKey = static_cast<uint32_t>(ublock_getCode(character)) + 1;
+
+    const AtomString& family = fallbackFamilyByBlock.get().ensure(blockKey, [&]() -> AtomString {
+        // Prefer the default family so common blocks keep consistent
+        // rendering with the rest of the page.
+        font_family haikuFamily;
+        font_style haikuStyle;
+        be_plain_font->GetFamilyAndStyle(&haikuFamily, &haikuStyle);
+        BFont font;
+        if (font.SetFamilyAndStyle(haikuFamily, NULL) == B_OK
+            && font.IncludesBlock(character, character))
+            return AtomString::fromUTF8(haikuFamily);
+
+        int32 numFamilies = count_font_families();
+        for (int32 i = 0; i < numFamilies; i++) {
+            uint32 flags;
+            if (get_font_family(i, &haikuFamily, &flags) != B_OK)
+                continue;
+            if (font.SetFamilyAndStyle(haikuFamily, NULL) != B_OK)
+                continue;
+            if (font.IncludesBlock(character, character))
+                return AtomString::fromUTF8(haikuFamily);
+        }
+
+        // Nothing covers this block; fall back to the default family and let
+        // it render the missing-glyph box.
+        return AtomString::fromUTF8("Sans");
+    }).iterator->value;
+
+    FontPlatformData data(description, family);
     return fontForPlatformData(data);
 }
 
@@ -123,6 +164,21 @@ std::optional<ASCIILiteral> FontCache::platformAlternateFamilyName(const String&
     return std::nullopt;
 }
 
+void FontCache::prewarmGlobally()
+{
+    // Walking the family list makes app_server cache the font metadata, and
+    // instantiating the fallback font pulls its glyph tables in, so the
+    // first real layout in a prewarmed process does not stall on either.
+    int32 count = count_font_families();
+    font_family family;
+    for (int32 index = 0; index < count; index++)
+        get_font_family(index, &family);
+
+    FontDescription description;
+    description.setComputedSize(16);
+    FontCache::forCurrentThread().lastResortFallbackFont(description);
+}
+
 void FontCache::platformInvalidate()
 {
 }
@@ -33,6 +33,8 @@
 #include "GraphicsContext.h"
 #include "TextEncoding.h"
 #include "NotImplemented.h"
+#include <wtf/Hasher.h>
+#include <wtf/Lock.h>
 #include <wtf/text/CString.h>
 #include <Font.h>
 #include <String.h>
@@ -49,6 +51,83 @@ struct hack {
     }
 } hack;
 
+// Converting a glyph buffer to UTF-8 and laying out the per-glyph offsets is
+// done for every drawGlyphs call, and the same runs (menu labels, repeated
+// words, animated text) come back frame after frame. Memoize the prepared
+// run in a small direct-mapped cache keyed on font, glyphs and advances;
+// only the absolute positions depend on the draw origin.
+struct GlyphRunCacheEntry {
+    uint64_t fontIdentifier { 0 };
+    Vector<Glyph, 32> glyphs;
+    Vector<float, 32> widths;
+
+    BString utf8;
+    Vector<BPoint, 32> relativeOffsets;
+
+    bool matches(uint64_t identifier, const GlyphBufferGlyph* bufferGlyphs, const GlyphBufferAdvance* advances, unsigned numGlyphs) const
+    {
+        if (fontIdentifier != identifier || glyphs.size() != numGlyphs)
+            return false;
+        for (unsigned i = 0; i < numGlyphs; i++) {
+            if (glyphs[i] != bufferGlyphs[i] || widths[i] != advances[i].width())
+                return false;
+        }
+        return true;
+    }
+};
+
+static constexpr unsigned glyphRunCacheSize = 256;
+
+static Lock glyphRunCacheLock;
+static GlyphRunCacheEntry* glyphRunCache()
+{
+    static GlyphRunCacheEntry* cache = new GlyphRunCacheEntry[glyphRunCacheSize];
+    return cache;
+}
+
+static unsigned glyphRunCacheSlot(uint64_t fontIdentifier, const GlyphBufferGlyph* glyphs, const GlyphBufferAdvance* advances, unsigned numGlyphs)
+{
+    Hasher hasher;
+    add(hasher, fontIdentifier);
+    for (unsigned i = 0; i < numGlyphs; i++) {
+        add(hasher, glyphs[i]);
+        add(hasher, advances[i].width());
+    }
+    return hasher.hash() % glyphRunCacheSize;
+}
+
+static void buildGlyphRun(GlyphRunCacheEntry& entry, const GlyphBufferGlyph* glyphs, const GlyphBufferAdvance* advances, unsigned numGlyphs)
+{
+    entry.glyphs.clear();
+    entry.widths.clear();
+    entry.utf8.SetTo("");
+    entry.relativeOffsets.clear();
+
+    char buffer[4];
+    float offset = 0;
+    for (unsigned i = 0; i < numGlyphs; i++) {
+        entry.glyphs.append(glyphs[i]);
+        entry.widths.append(advances[i].width());
+
+        Glyph glyph = glyphs[i];
+        if (glyph == 0) {
+            if (advances[i].width() == 0.0) {
+                // These are fake glyphs to keep GlyphBuffer vectors in sync with text runs
+                // when a surrogate pair is found (cf. addToGlyphBuffer in WidthIterator.cpp).
+                continue;
+            }
+            glyph = 0xfdd1;
+        }
+
+        entry.relativeOffsets.append(BPoint(offset, 0));
+        offset += advances[i].width();
+
+        char* tmp = buffer;
+        BUnicodeChar::ToUTF8(glyph, &tmp);
+        entry.utf8.Append(buffer, tmp - buffer);
+    }
+}
+
 
 bool FontCascade::canReturnFallbackFontsForComplexText()
 {
@@ -82,30 +161,26 @@ void FontCascade::drawGlyphs(GraphicsContext& graphicsContext, const Font& font,
         bfont.SetFlags(B_FORCE_ANTIALIASING);
     view->SetFont(&bfont);
 
-    BPoint offsets[numGlyphs];
-    char buffer[4];
+    uint64_t fontIdentifier = (&font == NULL) ? 0 : font.renderingResourceIdentifier().toUInt64();
+
     BString utf8;
-    int32 realGlyphCount = 0;
-    float offset = point.x();
-    for (unsigned i = 0; i < numGlyphs; i++) {
-        Glyph glyph = glyphs[i];
-        if (glyph == 0) {
-            if (advances[i].width() == 0.0) {
-                // These are fake glyphs to keep GlyphBuffer vectors in sync with text runs
-                // when a surrogate pair is found (cf. addToGlyphBuffer in WidthIterator.cpp).
-                continue;
-            }
-            glyph = 0xfdd1;
+    Vector<BPoint, 32> relativeOffsets;
+    {
+        Locker locker { glyphRunCacheLock };
+        GlyphRunCacheEntry& entry = glyphRunCache()[glyphRunCacheSlot(fontIdentifier, glyphs, advances, numGlyphs)];
+        if (!entry.matches(fontIdentifier, glyphs, advances, numGlyphs)) {
+            entry.fontIdentifier = fontIdentifier;
+            buildGlyphRun(entry, glyphs, advances, numGlyphs);
         }
+        utf8 = entry.utf8;
+        relativeOffsets = entry.relativeOffsets;
+    }
 
-        offsets[realGlyphCount].x = offset;
-        offsets[realGlyphCount].y = point.y();
-        offset += advances[i].width();
-
-        char* tmp = buffer;
-        BUnicodeChar::ToUTF8(glyph, &tmp);
-        utf8.Append(buffer, tmp - buffer);
-        realGlyphCount++;
+    int32 realGlyphCount = relativeOffsets.size();
+    BPoint offsets[realGlyphCount];
+    for (int32 i = 0; i < realGlyphCount; i++) {
+        offsets[i].x = relativeOffsets[i].x + point.x();
+        offsets[i].y = point.y();
     }
 
     view->DrawString(utf8, offsets, realGlyphCount);
@@ -32,11 +32,12 @@
 
 #include "AffineTransform.h"
 #include "Color.h"
-#include "DisplayListRecorder.h"
 #include "Gradient.h"
 #include "ImageBuffer.h"
 #include "NotImplemented.h"
 #include "Path.h"
+#include "PathHaiku.h"
+#include "PathRasterizerHaiku.h"
 #include "TransformationMatrix.h"
 
 #include <wtf/text/CString.h>
@@ -58,7 +59,7 @@
 namespace WebCore {
 
 
-GraphicsContextHaiku::GraphicsContextHaiku(BView* view)
+GraphicsContextHaiku::GraphicsContextHaiku(BView* view, BBitmap* targetBitmap)
     : GraphicsContext(IsDeferred::No, {
         GraphicsContextState::Change::StrokeThickness,
         GraphicsContextState::Change::StrokeBrush,
@@ -70,7 +71,10 @@ GraphicsContextHaiku::GraphicsContextHaiku(BView* view)
     })
     , m_view(view)
     , m_strokeStyle(B_SOLID_HIGH)
+    , m_targetBitmap(targetBitmap)
 {
+    if (m_targetBitmap)
+        m_trackedClip = FloatRect(m_targetBitmap->Bounds());
     didUpdateState(m_state);
 }
 
@@ -104,7 +108,13 @@ void GraphicsContextHaiku::drawBitmap(BBitmap* image, const FloatRect& destRect,
 {
     HGTRACE(("drawBitmap:  src([%f:%f] [%f:%f])\n", srcRect.x(), srcRect.y(), srcRect.width(), srcRect.height()));
     HGTRACE(("            dest([%f:%f] [%f:%f])\n", destRect.x(), destRect.y(), destRect.width(), destRect.height()));
-    m_view->PushState();
+    // Only the drawing and blending modes change here, so save and restore
+    // just those instead of pushing a full state.
+    drawing_mode oldMode = m_view->DrawingMode();
+    source_alpha oldAlpha;
+    alpha_function oldFunction;
+    m_view->GetBlendingMode(&oldAlpha, &oldFunction);
+
     setCompositeOperation(options.compositeOperator());
 
     // Test using example site at
@@ -119,7 +129,8 @@ void GraphicsContextHaiku::drawBitmap(BBitmap* image, const FloatRect& destRect,
 
     m_view->DrawBitmapAsync(image, BRect(srcRect), BRect(destRect), flags);
 
-    m_view->PopState();
+    m_view->SetDrawingMode(oldMode);
+    m_view->SetBlendingMode(oldAlpha, oldFunction);
 }
 
 // This is only used to draw borders.
@@ -299,9 +310,50 @@ void GraphicsContextHaiku::fillRoundedRectImpl(const FloatRoundedRect& roundRect
     m_view->SetHighColor(oldColor);
 }
 
+// Charting workloads fill many retained paths per frame, and submitting
+// each one to app_server rasterizes its geometry server-side on every
+// draw. When the fill is a plain source-over solid color into a bitmap we
+// have mapped anyway, rasterize it here instead, reusing the path's cached
+// device-space edge list across frames.
+bool GraphicsContextHaiku::fillPathInProcess(const Path& path)
+{
+    if (!m_targetBitmap || m_complexClip)
+        return false;
+    // Inside a layer the view draws into a server-side temporary, not into
+    // the target bitmap.
+    if (isInTransparencyLayer())
+        return false;
+    if (m_state.fillBrush().pattern() || m_state.fillBrush().gradient())
+        return false;
+    if (compositeOperation() != CompositeOperator::SourceOver
+        || blendMode() != BlendMode::Normal)
+        return false;
+
+    rgb_color color = m_state.fillBrush().color();
+    color.alpha *= m_state.alpha();
+    if (!color.alpha)
+        return true;
+
+    IntRect clip = intersection(enclosingIntRect(m_trackedClip),
+        IntRect(m_targetBitmap->Bounds()));
+    if (clip.isEmpty())
+        return true;
+
+    const PathHaiku& impl = const_cast<Path&>(path).ensurePlatformPathImpl();
+
+    // Drawing already queued on the view must land before we write to the
+    // bits, or app_server would overwrite our fill when it catches up.
+    m_view->Sync();
+    return PathRasterizerHaiku::fill(*m_targetBitmap, impl, getCTM(),
+        fillRule(), color, clip);
+}
+
 void GraphicsContextHaiku::fillPath(const Path& path)
 {
     HGTRACE(("fillPath: (--todo print values)\n"));
+    if (fillPathInProcess(path))
+        return;
+
     m_view->SetFillRule(fillRule() == WindRule::NonZero ? B_NONZERO : B_EVEN_ODD);
     m_view->MovePenTo(B_ORIGIN);
 
@@ -328,6 +380,16 @@ void GraphicsContextHaiku::clip(const FloatRect& rect)
 {
     HGTRACE(("clip: [%f:%f] [%f:%f]\n", rect.x(), rect.y(), rect.width(), rect.height()));
     m_view->ClipToRect(rect);
+
+    if (m_targetBitmap) {
+        AffineTransform ctm = getCTM();
+        // A rotated or sheared rect clip is no longer a rect in device
+        // space; stop tracking rather than over-approximate it.
+        if (ctm.b() || ctm.c())
+            m_complexClip = true;
+        else
+            m_trackedClip.intersect(ctm.mapRect(rect));
+    }
 }
 
 void GraphicsContextHaiku::clipPath(const Path& path, WindRule windRule)
@@ -339,6 +401,9 @@ void GraphicsContextHaiku::clipPath(const Path& path, WindRule windRule)
     m_view->ClipToShape(path.platformPath());
 
     m_view->SetFillRule(fillRule);
+
+    if (m_targetBitmap)
+        m_complexClip = true;
 }
 
 void GraphicsContextHaiku::clipToImageBuffer(WebCore::ImageBuffer&, WebCore::FloatRect const&)
@@ -410,12 +475,18 @@ void GraphicsContextHaiku::clipOut(const Path& path)
         return;
 
     m_view->ClipToInverseShape(path.platformPath());
+
+    if (m_targetBitmap)
+        m_complexClip = true;
 }
 
 void GraphicsContextHaiku::clipOut(const FloatRect& rect)
 {
     HGTRACE(("clipOut: [%f:%f] [%f:%f]\n", rect.x(), rect.y(), rect.width(), rect.height()));
     m_view->ClipToInverseRect(rect);
+
+    if (m_targetBitmap)
+        m_complexClip = true;
 }
 
 void GraphicsContextHaiku::drawFocusRing(const Path& path, float width, const Color& color)
@@ -455,9 +526,20 @@ void GraphicsContextHaiku::drawFocusRing(const Vector<FloatRect>& rects, float /
 
     m_view->SetHighColor(color);
     m_view->SetPenSize(width);
-    // FIXME: maybe we should implement this with BShape?
-    for (unsigned i = 0; i < rectCount; ++i)
-        m_view->StrokeRect(rects[i], B_SOLID_HIGH);
+
+    // Collect all the rects into one shape so the ring goes out as a single
+    // stroke command instead of one per rect.
+    BShape shape;
+    for (unsigned i = 0; i < rectCount; ++i) {
+        const FloatRect& ring = rects[i];
+        shape.MoveTo(BPoint(ring.x(), ring.y()));
+        shape.LineTo(BPoint(ring.maxX(), ring.y()));
+        shape.LineTo(BPoint(ring.maxX(), ring.maxY()));
+        shape.LineTo(BPoint(ring.x(), ring.maxY()));
+        shape.Close();
+    }
+    m_view->MovePenTo(B_ORIGIN);
+    m_view->StrokeShape(&shape, B_SOLID_HIGH);
 
     m_view->PopState();
 }
@@ -482,13 +564,17 @@ void GraphicsContextHaiku::drawLinesForText(const FloatPoint& point,
     float oldSize = m_view->PenSize();
     m_view->SetPenSize(bounds.height());
 
-    // TODO would be faster to use BeginLineArray/EndLineArray here
+    // Submit all the segments as a single line array instead of one
+    // StrokeLine message per segment.
+    m_view->BeginLineArray(widths.size() / 2);
     for (size_t i = 0; i < widths.size(); i += 2)
     {
-        m_view->StrokeLine(
+        m_view->AddLine(
 			BPoint(bounds.x() + widths[i], y),
-			BPoint(bounds.x() + widths[i+1], y));
+			BPoint(bounds.x() + widths[i+1], y),
+			m_view->HighColor());
     }
+    m_view->EndLineArray();
 
     m_view->SetPenSize(oldSize);
 }
@@ -504,11 +590,15 @@ void GraphicsContextHaiku::drawDotsForDocumentMarker(WebCore::FloatRect const&,
 void GraphicsContextHaiku::clearRect(const FloatRect& rect)
 {
     HGTRACE(("clearRect: [%f:%f] [%f:%f]\n", rect.x(), rect.y(), rect.width(), rect.height()));
-    m_view->PushState();
+    // Save and restore only the two values we touch; a full PushState makes
+    // app_server allocate and later tear down a complete state snapshot.
+    rgb_color oldColor = m_view->HighColor();
+    drawing_mode oldMode = m_view->DrawingMode();
     m_view->SetHighColor(0, 0, 0, 0);
     m_view->SetDrawingMode(B_OP_COPY);
     m_view->FillRect(rect);
-    m_view->PopState();
+    m_view->SetDrawingMode(oldMode);
+    m_view->SetHighColor(oldColor);
 }
 
 void GraphicsContextHaiku::setLineCap(LineCap lineCap)
@@ -807,6 +897,8 @@ void GraphicsContextHaiku::save(GraphicsContextState::Purpose)
 {
     HGTRACE(("save: no values\n"));
     m_view->PushState();
+    if (m_targetBitmap)
+        m_clipStack.push({ m_trackedClip, m_complexClip });
     GraphicsContext::save();
 }
 
@@ -815,6 +907,11 @@ void GraphicsContextHaiku::restore(GraphicsContextState::Purpose)
     HGTRACE(("restore: no values\n"));
     GraphicsContext::restore();
     m_view->PopState();
+    if (m_targetBitmap && !m_clipStack.empty()) {
+        m_trackedClip = m_clipStack.top().first;
+        m_complexClip = m_clipStack.top().second;
+        m_clipStack.pop();
+    }
 }
 
 
@@ -41,7 +41,9 @@ namespace WebCore {
 
 class GraphicsContextHaiku: public GraphicsContext {
 public:
-    GraphicsContextHaiku(BView* view);
+    // targetBitmap is the bitmap the view draws into, when the caller knows
+    // it (ImageBuffer contexts); it enables in-process path filling.
+    GraphicsContextHaiku(BView* view, BBitmap* targetBitmap = nullptr);
     ~GraphicsContextHaiku();
 
     bool hasPlatformContext() const { return m_view != nullptr; }
@@ -93,6 +95,20 @@ public:
     void drawBitmap(BBitmap*, const FloatSize& imageSize, const FloatRect& destRect, const FloatRect& tileRect, const AffineTransform& patternTransform, const FloatPoint& phase, const FloatSize& spacing, const ImagePaintingOptions& = { });
     BView* m_view;
     pattern m_strokeStyle;
+
+private:
+    bool fillPathInProcess(const Path&);
+
+    BBitmap* m_targetBitmap;
+
+    // The clip region lives in app_server and asking for it back is a
+    // synchronous round-trip, so mirror rectangular clips here for the
+    // in-process rasterizer. Once a non-rectangular clip is set the
+    // rasterizer is bypassed until the state is restored. Only maintained
+    // when m_targetBitmap is known.
+    FloatRect m_trackedClip;
+    bool m_complexClip { false };
+    std::stack<std::pair<FloatRect, bool>> m_clipStack;
 };
 
 };
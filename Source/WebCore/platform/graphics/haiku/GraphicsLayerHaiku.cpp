@@ -29,6 +29,10 @@
 #include "GraphicsLayerFactory.h"
 #include "NotImplemented.h"
 
+#if USE(TEXTURE_MAPPER)
+#include "GraphicsLayerTextureMapper.h"
+#endif
+
 
 namespace WebCore {
 
@@ -64,9 +68,15 @@ void GraphicsLayerHaiku::setNeedsDisplayInRect(const FloatRect&, ShouldClipToLay
 
 Ref<GraphicsLayer> GraphicsLayer::create(GraphicsLayerFactory* factory, GraphicsLayerClient& client, Type type)
 {
-    if (!factory)
-        return adoptRef(* new GraphicsLayerHaiku(type, client));
-    return factory->createGraphicsLayer(type, client);
+    if (factory)
+        return factory->createGraphicsLayer(type, client);
+#if USE(TEXTURE_MAPPER)
+    // Composite through TextureMapper so transforms, opacity and video
+    // layers are handled on the GPU (see AcceleratedCompositingContextHaiku).
+    return adoptRef(*new GraphicsLayerTextureMapper(type, client));
+#else
+    return adoptRef(* new GraphicsLayerHaiku(type, client));
+#endif
 }
 
 }
@@ -48,6 +48,13 @@ public:
     GraphicsContext* m_context;
 
     PlatformImagePtr m_image;
+
+    // The bitmap pixels live in an app_server-created area. Exposing it lets
+    // pixel access be served by mapping, and lets the WebKit2 port hand the
+    // area to the UI process without serializing the surface.
+    area_id area() const { return m_image->Area(); }
+    uint8_t* bits() const { return static_cast<uint8_t*>(m_image->Bits()); }
+    size_t bitsLength() const { return m_image->BitsLength(); }
 };
 
 } // namespace WebCore
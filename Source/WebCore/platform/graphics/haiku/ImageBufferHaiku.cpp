@@ -33,6 +33,8 @@
 #include "IntRect.h"
 #include "MIMETypeRegistry.h"
 #include "NotImplemented.h"
+#include "PixelBuffer.h"
+#include "PixelConversionsHaiku.h"
 #include "JavaScriptCore/JSCInlines.h"
 #include "JavaScriptCore/TypedArrayInlines.h"
 
@@ -53,7 +55,12 @@ ImageBufferData::ImageBufferData(const IntSize& size)
     , m_context(NULL)
     , m_image(adoptRef(new BitmapRef(BRect(0, 0, size.width() - 1, size.height() - 1), B_RGBA32, true)))
 {
-    // Always keep the bitmap locked, we are the only client.
+    // Always keep the bitmap locked, we are the only client. This also
+    // confines the buffer to the creating thread (the looper lock is owned
+    // by it), which is what OffscreenCanvas needs: a canvas rendered in a
+    // Worker creates, draws and reads its buffer on the worker thread, and
+    // only BView-less BitmapRef copies of the pixels cross to the main
+    // thread for display.
     m_image->Lock();
     if(size.isEmpty())
         return;
@@ -73,7 +80,7 @@ ImageBufferData::ImageBufferData(const IntSize& size)
     m_view->SetLineMode(B_BUTT_CAP, B_MITER_JOIN, 10);
     m_view->SetDrawingMode(B_OP_ALPHA);
     m_view->SetBlendingMode(B_PIXEL_ALPHA, B_ALPHA_COMPOSITE);
-    m_context = new GraphicsContextHaiku(m_view);
+    m_context = new GraphicsContextHaiku(m_view, m_image.get());
 }
 
 
@@ -155,12 +162,64 @@ GraphicsContext& ImageBufferHaikuSurfaceBackend::context()
 void ImageBufferHaikuSurfaceBackend::getPixelBuffer(
     const IntRect& srcRect, PixelBuffer& destination)
 {
-    return ImageBufferBackend::getPixelBuffer(srcRect, (const uint8_t*)m_data.m_image->Bits(), destination);
+    // Flush pending drawing so the mapped pixels are current, then read the
+    // requested rect straight out of the area-backed bits.
+    if (m_data.m_view)
+        m_data.m_view->Sync();
+
+    // getImageData in the common case: unpremultiplied RGBA out of a fully
+    // covered source rect, converted row by row with the vectorized kernels.
+    IntRect backendRect(IntPoint(), size());
+    if (destination.format().pixelFormat == PixelFormat::RGBA8
+        && destination.format().alphaFormat == AlphaPremultiplication::Unpremultiplied
+        && backendRect.contains(srcRect)) {
+        unsigned sourceBytesPerRow = bytesPerRow();
+        unsigned destinationBytesPerRow = 4u * srcRect.width();
+        const uint8_t* sourceRow = m_data.bits() + srcRect.y() * sourceBytesPerRow + srcRect.x() * 4;
+        uint8_t* destinationRow = destination.bytes().data();
+        for (int y = 0; y < srcRect.height(); y++) {
+            convertBGRAPremultipliedToRGBAUnpremultiplied(sourceRow, destinationRow, srcRect.width());
+            sourceRow += sourceBytesPerRow;
+            destinationRow += destinationBytesPerRow;
+        }
+        return;
+    }
+
+    return ImageBufferBackend::getPixelBuffer(srcRect, m_data.bits(), destination);
 }
 
 void ImageBufferHaikuSurfaceBackend::putPixelBuffer(const PixelBuffer& imageData, const IntRect& sourceRect, const IntPoint& destPoint, AlphaPremultiplication premultiplication)
 {
-    ImageBufferBackend::putPixelBuffer(imageData, sourceRect, destPoint, premultiplication, (uint8_t*)m_data.m_image->Bits());
+    // Writes land directly in the shared area; app_server draws from the
+    // same memory, so no upload or serialization step is needed. Drawing
+    // already queued on the view must be flushed first so it does not
+    // overwrite the pixels we are about to store.
+    if (m_data.m_view)
+        m_data.m_view->Sync();
+
+    // putImageData in the common case: unpremultiplied RGBA rows converted
+    // and swizzled into the surface with the vectorized kernels.
+    IntRect backendRect(IntPoint(), size());
+    IntRect destinationRect = sourceRect;
+    destinationRect.moveBy(destPoint);
+    if (imageData.format().pixelFormat == PixelFormat::RGBA8
+        && imageData.format().alphaFormat == AlphaPremultiplication::Unpremultiplied
+        && premultiplication == AlphaPremultiplication::Premultiplied
+        && IntRect(IntPoint(), imageData.size()).contains(sourceRect)
+        && backendRect.contains(destinationRect)) {
+        unsigned sourceBytesPerRow = 4u * imageData.size().width();
+        unsigned destinationBytesPerRow = bytesPerRow();
+        const uint8_t* sourceRow = imageData.bytes().data() + sourceRect.y() * sourceBytesPerRow + sourceRect.x() * 4;
+        uint8_t* destinationRow = m_data.bits() + destinationRect.y() * destinationBytesPerRow + destinationRect.x() * 4;
+        for (int y = 0; y < sourceRect.height(); y++) {
+            convertRGBAUnpremultipliedToBGRAPremultiplied(sourceRow, destinationRow, sourceRect.width());
+            sourceRow += sourceBytesPerRow;
+            destinationRow += destinationBytesPerRow;
+        }
+        return;
+    }
+
+    ImageBufferBackend::putPixelBuffer(imageData, sourceRect, destPoint, premultiplication, m_data.bits());
 }
 
 unsigned ImageBufferHaikuSurfaceBackend::bytesPerRow() const
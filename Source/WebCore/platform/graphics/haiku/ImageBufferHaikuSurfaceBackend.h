@@ -55,6 +55,11 @@ public:
     unsigned bytesPerRow() const override;
     bool canMapBackingStore() const override { return true; }
 
+    // Area holding the surface pixels, for zero-copy handoff to another
+    // process (the receiving side wraps it with SharedMemory::wrapMap or a
+    // BitmapRef adopting the area).
+    area_id sharedArea() const { return m_data.area(); }
+
     static size_t calculateMemoryCost(const Parameters&);
 
     String debugDescription() const override { return ASCIILiteral::fromLiteralUnsafe("haiku image"); }
@@ -24,6 +24,11 @@
 
 #include "GraphicsContext.h"
 #include "NotImplemented.h"
+
+#if USE(TEXTURE_MAPPER)
+#include "BitmapTexture.h"
+#include "TextureMapper.h"
+#endif
 #include "wtf/text/CString.h"
 #include "wtf/NeverDestroyed.h"
 
@@ -77,6 +82,10 @@ MediaPlayerPrivate::MediaPlayerPrivate(MediaPlayer* player)
     , m_videoTrack(nullptr)
     , m_soundPlayer(nullptr)
     , m_frameBuffer(nullptr)
+    , m_decodeBuffer(nullptr)
+#if USE(TEXTURE_MAPPER)
+    , m_frameNeedsUpload(false)
+#endif
     , m_player(player)
     , m_networkState(MediaPlayer::NetworkState::Empty)
     , m_readyState(MediaPlayer::ReadyState::HaveNothing)
@@ -88,12 +97,18 @@ MediaPlayerPrivate::MediaPlayerPrivate(MediaPlayer* player)
 
 MediaPlayerPrivate::~MediaPlayerPrivate()
 {
+#if USE(TEXTURE_MAPPER)
+    if (client())
+        client()->platformLayerWillBeDestroyed();
+#endif
+
     delete m_soundPlayer;
 
     m_mediaLock.Lock();
 
     cancelLoad();
     delete m_frameBuffer;
+    delete m_decodeBuffer;
     m_mediaLock.Unlock();
 }
 
@@ -189,17 +204,31 @@ void MediaPlayerPrivate::playCallback(void* cookie, void* buffer,
         if (player->m_videoTrack->CurrentTime()
             < player->m_audioTrack->CurrentTime())
         {
-            // Decode a video frame and show it on screen
+            // Decode a video frame into the back buffer and flip it to the
+            // front, so the main thread never draws a partially decoded frame
+            // and the decoder does not stall on a DrawBitmap() in progress.
             int64 count;
-            if (player->m_videoTrack->ReadFrames(player->m_frameBuffer->Bits(),
+            if (player->m_videoTrack->ReadFrames(player->m_decodeBuffer->Bits(),
                 &count) != B_OK) {
                 player->m_videoTrack = nullptr;
+            } else {
+                std::swap(player->m_frameBuffer, player->m_decodeBuffer);
+#if USE(TEXTURE_MAPPER)
+                player->m_frameNeedsUpload = true;
+#endif
             }
 
             WeakPtr<MediaPlayerPrivate> p = WeakPtr(player);
             callOnMainThread([p] {
                 if (!p)
                     return;
+#if USE(TEXTURE_MAPPER)
+                // When composited, only the video plane needs to redraw.
+                if (p->client()) {
+                    p->client()->setPlatformLayerNeedsDisplay();
+                    return;
+                }
+#endif
                 p->m_player->repaint();
             });
         }
@@ -326,12 +355,41 @@ void MediaPlayerPrivate::paint(GraphicsContext& context, const FloatRect& r)
     if (context.paintingDisabled())
         return;
 
+    if (!m_mediaLock.Lock())
+        return;
     if (m_frameBuffer) {
         BView* target = context.platformContext();
         target->SetDrawingMode(B_OP_COPY);
         target->DrawBitmap(m_frameBuffer, r);
     }
+    m_mediaLock.Unlock();
+}
+
+#if USE(TEXTURE_MAPPER)
+void MediaPlayerPrivate::paintToTextureMapper(TextureMapper& textureMapper, const FloatRect& targetRect, const TransformationMatrix& matrix, float opacity)
+{
+    if (!m_mediaLock.Lock())
+        return;
+
+    if (m_frameBuffer) {
+        BRect bounds = m_frameBuffer->Bounds();
+        IntSize size(bounds.IntegerWidth() + 1, bounds.IntegerHeight() + 1);
+        if (!m_texture || m_texture->size() != size) {
+            m_texture = BitmapTexture::create(size);
+            m_frameNeedsUpload = true;
+        }
+        // Frames only get uploaded when the decoder produced a new one; the
+        // compositor can redraw the layer any number of times in between.
+        if (m_frameNeedsUpload) {
+            m_texture->updateContents(m_frameBuffer->Bits(), IntRect(IntPoint(), size), IntPoint(), m_frameBuffer->BytesPerRow());
+            m_frameNeedsUpload = false;
+        }
+        textureMapper.drawTexture(*m_texture, targetRect, matrix, opacity);
+    }
+
+    m_mediaLock.Unlock();
 }
+#endif
 
 // #pragma mark - private methods
 
@@ -358,6 +416,9 @@ void MediaPlayerPrivate::IdentifyTracks(const String& url)
                 m_frameBuffer = new BBitmap(
                     BRect(0, 0, format.Width() - 1, format.Height() - 1),
                     B_RGB32);
+                m_decodeBuffer = new BBitmap(
+                    BRect(0, 0, format.Width() - 1, format.Height() - 1),
+                    B_RGB32);
 
                 if (m_audioTrack)
                     break;
@@ -23,6 +23,10 @@
 
 #include "MediaPlayerPrivate.h"
 
+#if USE(TEXTURE_MAPPER)
+#include "TextureMapperPlatformLayer.h"
+#endif
+
 #include <wtf/WeakPtr.h>
 
 #include <Locker.h>
@@ -40,10 +44,15 @@ namespace WebCore {
 
 class MediaPlayerFactoryHaiku;
 
+class BitmapTexture;
+
 class MediaPlayerPrivate
     : public MediaPlayerPrivateInterface
     , public CanMakeWeakPtr<MediaPlayerPrivate>
     , public RefCounted<MediaPlayerPrivate>
+#if USE(TEXTURE_MAPPER)
+    , public TextureMapperPlatformLayer
+#endif
 {
     WTF_MAKE_FAST_ALLOCATED;
 public:
@@ -96,6 +105,14 @@ public:
         void paint(GraphicsContext&, const FloatRect&) override;
         DestinationColorSpace colorSpace() override;
 
+#if USE(TEXTURE_MAPPER)
+        // Video renders on its own composited plane, so pages around a
+        // playing video do not repaint for every frame.
+        PlatformLayer* platformLayer() const override { return const_cast<MediaPlayerPrivate*>(this); }
+        bool supportsAcceleratedRendering() const override { return true; }
+        void paintToTextureMapper(TextureMapper&, const FloatRect&, const TransformationMatrix&, float opacity) override;
+#endif
+
     private:
         void IdentifyTracks(const String& url);
 
@@ -111,7 +128,15 @@ public:
         BMediaTrack* m_audioTrack;
         BMediaTrack* m_videoTrack;
         BSoundPlayer* m_soundPlayer;
+        // Decoded frames are double buffered: the decoder writes into
+        // m_decodeBuffer and flips it to m_frameBuffer under m_mediaLock, so
+        // paint() always draws a complete frame.
         BBitmap* m_frameBuffer;
+        BBitmap* m_decodeBuffer;
+#if USE(TEXTURE_MAPPER)
+        RefPtr<BitmapTexture> m_texture;
+        bool m_frameNeedsUpload;
+#endif
         BLocker m_mediaLock;
 
         MediaPlayer* m_player;
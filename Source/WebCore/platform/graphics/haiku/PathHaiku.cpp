@@ -35,12 +35,15 @@
 #include "FloatRect.h"
 #include "GraphicsContextHaiku.h"
 #include "NotImplemented.h"
+#include "PathRasterizerHaiku.h"
 #include "TransformationMatrix.h"
 #include <Bitmap.h>
 #include <Shape.h>
 #include <View.h>
 #include <math.h>
 #include <stdio.h>
+#include <wtf/Lock.h>
+#include <wtf/ThreadSafeRefCounted.h>
 
 namespace WebCore {
 
@@ -63,6 +66,7 @@ public:
 
     void addReference()
     {
+        Locker locker { m_lock };
         m_referenceCount++;
     }
 
@@ -74,15 +78,15 @@ public:
         // execution of global destructors, at which point the BApplication
         // is already gone, and deleting BBitmaps without a BApplication
         // invokes the debugger.
+        Locker locker { m_lock };
         m_referenceCount--;
 
         if (!m_referenceCount) {
-            // m_bitmap being 0 simply means WebCore never performed any 
+            // m_bitmap being 0 simply means WebCore never performed any
             // hit-tests on Paths.
             if (!m_bitmap)
                 return;
 
-            m_bitmap->Unlock();
             // Will also delete the BView attached to the bitmap:
             delete m_bitmap;
             m_bitmap = 0;
@@ -92,18 +96,21 @@ public:
 
     void init()
     {
+        Locker locker { m_lock };
         if (m_bitmap)
             return;
 
         m_bitmap = new BBitmap(BRect(0, 0, 0, 0), B_RGB32, true);
-        // Keep the dummmy window locked at all times, so we don't need
-        // to worry about it anymore.
         m_bitmap->Lock();
         // Add a BView which does any rendering.
         m_view = new BView(m_bitmap->Bounds(), "WebCore hi-test view", 0, 0);
         m_bitmap->AddChild(m_view);
 
         clearToWhite();
+        // The looper lock is owned by whichever thread acquired it, so it
+        // cannot be held permanently now that hit tests may come from
+        // OffscreenCanvas worker threads; each test locks around drawing.
+        m_bitmap->Unlock();
     }
 
     void clearToWhite()
@@ -124,6 +131,8 @@ public:
 
     bool hitTest(const BShape* shape, float x, float y, WindRule rule)
     {
+        Locker locker { m_lock };
+        m_bitmap->Lock();
         prepareHitTest(x, y);
 
         int32 oldRule = m_view->FillRule();
@@ -131,18 +140,24 @@ public:
         m_view->FillShape(const_cast<BShape*>(shape));
         m_view->SetFillRule(oldRule);
 
-        return hitTestPixel();
+        bool hit = hitTestPixel();
+        m_bitmap->Unlock();
+        return hit;
     }
 
     bool hitTest(const BShape* shape, float x, float y, const Function<void(GraphicsContext&)>& applier)
     {
+        Locker locker { m_lock };
+        m_bitmap->Lock();
         prepareHitTest(x, y);
 
         GraphicsContextHaiku context(m_view);
         applier(context);
         m_view->StrokeShape(const_cast<BShape*>(shape));
 
-        return hitTestPixel();
+        bool hit = hitTestPixel();
+        m_bitmap->Unlock();
+        return hit;
     }
 
     bool hitTestPixel() const
@@ -159,18 +174,56 @@ public:
     }
 
 private:
+    Lock m_lock;
     BBitmap* m_bitmap;
     BView* m_view;
     int m_referenceCount;
 };
 
 // Reuse the same hit test bitmap for all paths. Initialization is lazy, and
-// needs to be, since BBitmaps need a running BApplication. If WebCore ever
-// runs each Document in it's own thread, we shall re-use the internal bitmap's
-// lock to synchronize access. Since the pointer is likely only sitting above
-// one document at a time, it seems unlikely to be a problem anyway.
+// needs to be, since BBitmaps need a running BApplication. Paths are hit
+// tested from OffscreenCanvas worker threads as well as the main thread
+// (isPointInPath), so the bitmap serializes its users with m_lock.
 static HitTestBitmap gHitTestBitmap;
 
+// Repainting transformed SVG content makes a fresh copy of the same
+// retained path and transforms it point by point every frame. Copies share
+// this cache, so each (geometry, matrix) pair is only transformed once;
+// mutating any sharer clears it. A handful of entries is enough since a
+// given path is rarely drawn under more than a few transforms at a time.
+class PathTransformCache : public ThreadSafeRefCounted<PathTransformCache> {
+public:
+    static constexpr size_t maxEntries = 4;
+
+    std::optional<BShape> lookup(const AffineTransform& transform)
+    {
+        Locker locker { m_lock };
+        for (auto& entry : m_entries) {
+            if (entry.first == transform)
+                return entry.second;
+        }
+        return std::nullopt;
+    }
+
+    void store(const AffineTransform& transform, const BShape& shape)
+    {
+        Locker locker { m_lock };
+        if (m_entries.size() == maxEntries)
+            m_entries.remove(0);
+        m_entries.append({ transform, shape });
+    }
+
+    void invalidate()
+    {
+        Locker locker { m_lock };
+        m_entries.clear();
+    }
+
+private:
+    Lock m_lock;
+    Vector<std::pair<AffineTransform, BShape>, maxEntries> m_entries;
+};
+
 // #pragma mark - Path
 
 PathHaiku::PathHaiku()
@@ -227,7 +280,36 @@ Ref<PathImpl> PathHaiku::copy() const
 {
     auto elementsStream = m_elementsStream ? RefPtr<PathImpl> { m_elementsStream->copy() } : nullptr;
 
-    return PathHaiku::create(m_platformPath, downcast<PathStream>(WTFMove(elementsStream)));
+    auto pathCopy = PathHaiku::create(m_platformPath, downcast<PathStream>(WTFMove(elementsStream)));
+
+    // Copies share the transform cache with their source; it is created
+    // lazily on the first copy since only copied paths benefit from it.
+    if (!m_transformCache)
+        m_transformCache = adoptRef(new PathTransformCache);
+    pathCopy->m_transformCache = m_transformCache;
+    pathCopy->m_edgeCache = m_edgeCache;
+
+    return pathCopy;
+}
+
+void PathHaiku::invalidateTransformCache()
+{
+    if (m_transformCache) {
+        m_transformCache->invalidate();
+        m_transformCache = nullptr;
+    }
+    if (m_edgeCache) {
+        m_edgeCache->invalidate();
+        m_edgeCache = nullptr;
+    }
+    m_locallyMutated = true;
+}
+
+PathEdgeCache& PathHaiku::ensureEdgeCache() const
+{
+    if (!m_edgeCache)
+        m_edgeCache = adoptRef(new PathEdgeCache);
+    return *m_edgeCache;
 }
 
 PlatformPathPtr PathHaiku::platformPath() const
@@ -242,6 +324,14 @@ FloatPoint PathHaiku::currentPoint() const
 
 bool PathHaiku::contains(const FloatPoint& point, WindRule rule) const
 {
+    // Pointer hit tests on dense documents probe many paths per event. Try
+    // the winding test over the cached flattened edges first: its bounds
+    // pre-check rejects most paths outright and repeated probes of the
+    // same path reuse the cached edges. Only shapes that fail to flatten
+    // fall back to rendering into the shared one-pixel bitmap.
+    if (auto hit = PathRasterizerHaiku::contains(*this, point, rule))
+        return *hit;
+
     gHitTestBitmap.init();
     return gHitTestBitmap.hitTest(&m_platformPath, point.x(), point.y(), rule);
 }
@@ -322,16 +412,19 @@ FloatRect PathHaiku::boundingRect() const
 
 void PathHaiku::add(PathMoveTo p)
 {
+    invalidateTransformCache();
     m_platformPath.MoveTo(p.point);
 }
 
 void PathHaiku::add(PathLineTo p)
 {
+    invalidateTransformCache();
     m_platformPath.LineTo(p.point);
 }
 
 void PathHaiku::add(PathQuadCurveTo p)
 {
+    invalidateTransformCache();
     BPoint control = p.controlPoint;
 
     BPoint points[3];
@@ -349,6 +442,7 @@ void PathHaiku::add(PathQuadCurveTo p)
 
 void PathHaiku::add(PathBezierCurveTo p)
 {
+    invalidateTransformCache();
     BPoint points[3];
     points[0] = p.controlPoint1;
     points[1] = p.controlPoint2;
@@ -363,6 +457,7 @@ static inline float areaOfTriangleFormedByPoints(const FloatPoint& p1, const Flo
 
 void PathHaiku::add(PathArcTo arcTo)
 {
+    invalidateTransformCache();
     // FIXME: Why do we return if the path is empty? Can't a path start with an arc?
     if (isEmpty())
         return;
@@ -443,12 +538,14 @@ void PathHaiku::add(PathArcTo arcTo)
 
 void PathHaiku::addPath(const PathHaiku&, const AffineTransform&)
 {
+    invalidateTransformCache();
     // FIXME: This should probably be very similar to Path::transform.
     notImplemented();
 }
 
 void PathHaiku::add(PathArc arc)
 {
+    invalidateTransformCache();
     // Compute start and end positions
     float startX = arc.center.x() + arc.radius * cos(arc.startAngle);
     float startY = arc.center.y() + arc.radius * sin(arc.startAngle);
@@ -486,6 +583,7 @@ void PathHaiku::add(PathArc arc)
 
 void PathHaiku::add(PathClosedArc arc)
 {
+    invalidateTransformCache();
     // TODO what's special about a "closed" arc?
     add(arc.arc);
 }
@@ -493,6 +591,7 @@ void PathHaiku::add(PathClosedArc arc)
 
 void PathHaiku::add(PathRect r)
 {
+    invalidateTransformCache();
     m_platformPath.MoveTo(BPoint(r.rect.x(), r.rect.y()));
     m_platformPath.LineTo(BPoint(r.rect.maxX(), r.rect.y()));
     m_platformPath.LineTo(BPoint(r.rect.maxX(), r.rect.maxY()));
@@ -503,6 +602,7 @@ void PathHaiku::add(PathRect r)
 
 void PathHaiku::add(PathRoundedRect roundedRect)
 {
+    invalidateTransformCache();
     const auto& roundRect = roundedRect.roundedRect;
     const FloatRect& rect = roundRect.rect();
     const FloatSize& topLeft = roundRect.radii().topLeft();
@@ -557,18 +657,21 @@ void PathHaiku::add(PathRoundedRect roundedRect)
 
 void PathHaiku::add(PathCloseSubpath)
 {
+    invalidateTransformCache();
     m_platformPath.Close();
 }
 
 
 void PathHaiku::add(PathEllipse)
 {
+    invalidateTransformCache();
     notImplemented();
 }
 
 
 void PathHaiku::add(PathEllipseInRect ellipseInRect)
 {
+    invalidateTransformCache();
     const auto& r = ellipseInRect.rect;
     BPoint points[3];
     const float radiusH = r.width() / 2;
@@ -722,6 +825,21 @@ bool PathHaiku::applyElements(const PathElementApplier& function) const
 
 bool PathHaiku::transform(const AffineTransform& transform)
 {
+    // Only the first transform of a pristine copy can be served from (or
+    // stored into) the shared cache: after that our geometry no longer
+    // matches the cache's base geometry.
+    bool canUseCache = m_transformCache && !m_locallyMutated;
+    if (canUseCache) {
+        if (auto cached = m_transformCache->lookup(transform)) {
+            m_platformPath = *cached;
+            m_locallyMutated = true;
+            // Our geometry no longer matches the edge lists shared with the
+            // source path; drop the reference, other sharers keep theirs.
+            m_edgeCache = nullptr;
+            return true;
+        }
+    }
+
     // BShapeIterator allows us to modify the path data "in place"
     class TransformIterator : public BShapeIterator {
     public:
@@ -776,6 +894,12 @@ bool PathHaiku::transform(const AffineTransform& transform)
     } transformIterator(transform);
 
     transformIterator.Iterate(&m_platformPath);
+
+    if (canUseCache)
+        m_transformCache->store(transform, m_platformPath);
+    m_locallyMutated = true;
+    m_edgeCache = nullptr;
+
     return true;
 }
 
@@ -35,6 +35,8 @@
 namespace WebCore {
 
 class GraphicsContext;
+class PathEdgeCache;
+class PathTransformCache;
 
 class PathHaiku final: public PathImpl {
 public:
@@ -60,6 +62,8 @@ public:
 
     FloatRect strokeBoundingRect(const Function<void(GraphicsContext&)>& strokeStyleApplier) const;
 
+    PathEdgeCache& ensureEdgeCache() const;
+
 private:
     Ref<PathImpl> copy() const final;
 
@@ -90,8 +94,22 @@ private:
 
     bool definitelyEqual(const WebCore::PathImpl& other) const { return m_platformPath == ((PathHaiku&)other).m_platformPath; }
 
+    void invalidateTransformCache();
+
     BShape m_platformPath;
     RefPtr<PathStream> m_elementsStream;
+
+    // Shared between this path and its copies; caches the result of
+    // transform() per matrix so repainting the same retained path does not
+    // re-transform the geometry every frame. See PathTransformCache.
+    mutable RefPtr<PathTransformCache> m_transformCache;
+
+    // Edge lists for the in-process scanline rasterizer, one per linear
+    // part of the CTM (translation is applied at scan time); also shared
+    // with copies and cleared when the geometry mutates. See
+    // PathRasterizerHaiku.
+    mutable RefPtr<PathEdgeCache> m_edgeCache;
+    bool m_locallyMutated { false };
 };
 
 };
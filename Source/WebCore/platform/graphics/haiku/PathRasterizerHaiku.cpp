@@ -0,0 +1,471 @@
+/*
+ * Copyright (C) 2026 Haiku, Inc.
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE COMPUTER, INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE COMPUTER, INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "PathRasterizerHaiku.h"
+
+#include "FloatPoint.h"
+#include "PathHaiku.h"
+
+#include <Bitmap.h>
+#include <Shape.h>
+
+#include <algorithm>
+#include <math.h>
+#include <string.h>
+
+namespace WebCore {
+
+// Vertical oversampling; horizontal coverage is computed analytically from
+// the fractional span ends, so 4 subscanlines already give smooth edges.
+static const int kSubScanlines = 4;
+
+// Maximum distance between a curve and its polyline approximation, in
+// device pixels.
+static const float kFlattenTolerance = 0.25f;
+
+// Walks a BShape, transforms it to device space and flattens curves and
+// arcs into RasterEdges. BShape arcs only ever come from PathHaiku's
+// canvas arc() support, so they are circular; the full elliptical endpoint
+// parameterization is handled anyway since it is barely more code.
+class FlattenIterator : public BShapeIterator {
+public:
+    FlattenIterator(const AffineTransform& transform, RasterEdgeList& list)
+        : m_transform(transform)
+        , m_list(list)
+    {
+        // The flattening step size for curves depends on the device-space
+        // size of the geometry, so estimate the scale once up front.
+        m_scale = std::max(std::hypot(transform.a(), transform.b()),
+            std::hypot(transform.c(), transform.d()));
+        if (m_scale <= 0)
+            m_scale = 1;
+    }
+
+    virtual status_t IterateMoveTo(BPoint* point)
+    {
+        closeSubpath();
+        m_current = FloatPoint(*point);
+        m_start = m_current;
+        m_deviceCurrent = m_transform.mapPoint(m_current);
+        m_deviceStart = m_deviceCurrent;
+        return B_OK;
+    }
+
+    virtual status_t IterateLineTo(int32 lineCount, BPoint* linePts)
+    {
+        while (lineCount--) {
+            lineTo(FloatPoint(*linePts));
+            linePts++;
+        }
+        return B_OK;
+    }
+
+    virtual status_t IterateBezierTo(int32 bezierCount, BPoint* bezierPts)
+    {
+        while (bezierCount--) {
+            FloatPoint p0 = m_deviceCurrent;
+            FloatPoint p1 = m_transform.mapPoint(FloatPoint(bezierPts[0]));
+            FloatPoint p2 = m_transform.mapPoint(FloatPoint(bezierPts[1]));
+            FloatPoint p3 = m_transform.mapPoint(FloatPoint(bezierPts[2]));
+            flattenCubic(p0, p1, p2, p3, 0);
+            m_current = FloatPoint(bezierPts[2]);
+            m_deviceCurrent = p3;
+            bezierPts += 3;
+        }
+        return B_OK;
+    }
+
+    virtual status_t IterateArcTo(float& rx, float& ry,
+        float& angle, bool largeArc, bool counterClockWise, BPoint& point)
+    {
+        flattenArc(rx, ry, angle, largeArc, counterClockWise, FloatPoint(point));
+        return B_OK;
+    }
+
+    virtual status_t IterateClose()
+    {
+        closeSubpath();
+        return B_OK;
+    }
+
+    // Filling treats every subpath as closed, so the last one must be
+    // closed explicitly once iteration is over.
+    void finish()
+    {
+        closeSubpath();
+    }
+
+private:
+    void deviceLineTo(const FloatPoint& device)
+    {
+        addEdge(m_deviceCurrent, device);
+        m_deviceCurrent = device;
+    }
+
+    void lineTo(const FloatPoint& user)
+    {
+        deviceLineTo(m_transform.mapPoint(user));
+        m_current = user;
+    }
+
+    void closeSubpath()
+    {
+        if (m_deviceCurrent != m_deviceStart)
+            deviceLineTo(m_deviceStart);
+        m_current = m_start;
+    }
+
+    void addEdge(FloatPoint from, FloatPoint to)
+    {
+        int8_t winding = 1;
+        if (from.y() > to.y()) {
+            std::swap(from, to);
+            winding = -1;
+        } else if (from.y() == to.y())
+            return; // Horizontal edges never cross a scanline.
+
+        RasterEdge edge;
+        edge.yTop = from.y();
+        edge.yBottom = to.y();
+        edge.xTop = from.x();
+        edge.dxdy = (to.x() - from.x()) / (to.y() - from.y());
+        edge.winding = winding;
+        m_list.edges.append(edge);
+
+        // A default FloatRect sits at the origin, so extending it directly
+        // would wrongly include (0, 0) in the bounds.
+        if (!m_hasBounds) {
+            m_list.bounds.setLocation(from);
+            m_hasBounds = true;
+        }
+        m_list.bounds.extend(from);
+        m_list.bounds.extend(to);
+    }
+
+    // Recursive de Casteljau subdivision until the control points are
+    // within tolerance of the chord. All points are in device space.
+    void flattenCubic(const FloatPoint& p0, const FloatPoint& p1,
+        const FloatPoint& p2, const FloatPoint& p3, int depth)
+    {
+        float dx = p3.x() - p0.x();
+        float dy = p3.y() - p0.y();
+        float d1 = fabsf((p1.x() - p3.x()) * dy - (p1.y() - p3.y()) * dx);
+        float d2 = fabsf((p2.x() - p3.x()) * dy - (p2.y() - p3.y()) * dx);
+        float d = d1 + d2;
+        if (depth >= 10 || d * d <= kFlattenTolerance * (dx * dx + dy * dy)) {
+            addEdge(p0, p3);
+            return;
+        }
+
+        FloatPoint p01 = midpoint(p0, p1);
+        FloatPoint p12 = midpoint(p1, p2);
+        FloatPoint p23 = midpoint(p2, p3);
+        FloatPoint p012 = midpoint(p01, p12);
+        FloatPoint p123 = midpoint(p12, p23);
+        FloatPoint p0123 = midpoint(p012, p123);
+        flattenCubic(p0, p01, p012, p0123, depth + 1);
+        flattenCubic(p0123, p123, p23, p3, depth + 1);
+    }
+
+    static FloatPoint midpoint(const FloatPoint& a, const FloatPoint& b)
+    {
+        return FloatPoint((a.x() + b.x()) / 2, (a.y() + b.y()) / 2);
+    }
+
+    // Endpoint-to-center conversion of an SVG-style arc (following the SVG
+    // implementation notes, F.6.5), then sampling the sweep at an angular
+    // step small enough to stay within tolerance at the device scale.
+    void flattenArc(float rx, float ry, float rotation, bool largeArc,
+        bool counterClockWise, const FloatPoint& end)
+    {
+        FloatPoint start = m_current;
+        if (start == end)
+            return;
+
+        rx = fabsf(rx);
+        ry = fabsf(ry);
+        if (!rx || !ry) {
+            lineTo(end);
+            return;
+        }
+
+        float cosR = cosf(rotation);
+        float sinR = sinf(rotation);
+
+        // Midpoint of the endpoints, in the rotated frame.
+        float dx2 = (start.x() - end.x()) / 2;
+        float dy2 = (start.y() - end.y()) / 2;
+        float x1 = cosR * dx2 + sinR * dy2;
+        float y1 = -sinR * dx2 + cosR * dy2;
+
+        // Grow the radii when they cannot span the endpoints.
+        float lambda = (x1 * x1) / (rx * rx) + (y1 * y1) / (ry * ry);
+        if (lambda > 1) {
+            float s = sqrtf(lambda);
+            rx *= s;
+            ry *= s;
+        }
+
+        float sign = (largeArc != counterClockWise) ? 1 : -1;
+        float num = rx * rx * ry * ry - rx * rx * y1 * y1 - ry * ry * x1 * x1;
+        float den = rx * rx * y1 * y1 + ry * ry * x1 * x1;
+        float coefficient = sign * sqrtf(std::max(0.f, num / den));
+        float cx1 = coefficient * rx * y1 / ry;
+        float cy1 = -coefficient * ry * x1 / rx;
+
+        float cx = cosR * cx1 - sinR * cy1 + (start.x() + end.x()) / 2;
+        float cy = sinR * cx1 + cosR * cy1 + (start.y() + end.y()) / 2;
+
+        float startAngle = atan2f((y1 - cy1) / ry, (x1 - cx1) / rx);
+        float endAngle = atan2f((-y1 - cy1) / ry, (-x1 - cx1) / rx);
+        float sweep = endAngle - startAngle;
+        if (counterClockWise && sweep > 0)
+            sweep -= 2 * M_PI;
+        else if (!counterClockWise && sweep < 0)
+            sweep += 2 * M_PI;
+
+        // A chord of angular extent 2*acos(1 - tolerance / r) deviates from
+        // the circle by exactly the tolerance.
+        float deviceRadius = std::max(rx, ry) * m_scale;
+        float step = 2 * acosf(std::max(0.f, 1 - kFlattenTolerance / std::max(deviceRadius, 1.f)));
+        step = std::min(std::max(step, (float)M_PI / 64), (float)M_PI / 4);
+        int segments = (int)ceilf(fabsf(sweep) / step);
+
+        for (int i = 1; i <= segments; i++) {
+            float theta = startAngle + sweep * i / segments;
+            float px = cosf(theta) * rx;
+            float py = sinf(theta) * ry;
+            lineTo(FloatPoint(cx + cosR * px - sinR * py,
+                cy + sinR * px + cosR * py));
+        }
+        lineTo(end);
+    }
+
+    const AffineTransform& m_transform;
+    RasterEdgeList& m_list;
+    float m_scale;
+    bool m_hasBounds { false };
+    FloatPoint m_current; // In path (user) space, needed for arcs.
+    FloatPoint m_start;
+    FloatPoint m_deviceCurrent;
+    FloatPoint m_deviceStart;
+};
+
+static RefPtr<RasterEdgeList> buildEdgeList(const BShape& shape, const AffineTransform& transform)
+{
+    RefPtr<RasterEdgeList> list = adoptRef(new RasterEdgeList);
+
+    FlattenIterator iterator(transform, *list);
+    if (iterator.Iterate(const_cast<BShape*>(&shape)) != B_OK)
+        return nullptr;
+    iterator.finish();
+
+    std::sort(list->edges.begin(), list->edges.end(),
+        [](const RasterEdge& a, const RasterEdge& b) {
+            return a.yTop < b.yTop;
+        });
+
+    return list;
+}
+
+// Accumulates the span [from, to] (in columns relative to the coverage
+// buffer) into the row's coverage, with analytic fractional ends. A fully
+// covered subscanline contributes 256 / kSubScanlines.
+static void accumulateSpan(uint16_t* coverage, int width, float from, float to)
+{
+    const int full = 256 / kSubScanlines;
+
+    from = std::max(from, 0.f);
+    to = std::min(to, (float)width);
+    if (from >= to)
+        return;
+
+    int first = (int)from;
+    int last = (int)to;
+    if (first == last) {
+        coverage[first] += (uint16_t)((to - from) * full);
+        return;
+    }
+
+    coverage[first] += (uint16_t)((first + 1 - from) * full);
+    for (int i = first + 1; i < last; i++)
+        coverage[i] += full;
+    if (last < width)
+        coverage[last] += (uint16_t)((to - last) * full);
+}
+
+std::optional<bool> PathRasterizerHaiku::contains(const PathHaiku& path,
+    const FloatPoint& point, WindRule windRule)
+{
+    // Hit tests happen in path (user) space, so the identity edge list is
+    // used; a path that is also filled under an identity CTM shares it.
+    AffineTransform identity;
+    PathEdgeCache& cache = path.ensureEdgeCache();
+    RefPtr<RasterEdgeList> list = cache.lookup(identity);
+    if (!list) {
+        list = buildEdgeList(*path.platformPath(), identity);
+        if (!list)
+            return std::nullopt;
+        cache.store(identity, list);
+    }
+
+    // Most paths of a dense document are nowhere near the pointer; the
+    // bounds check rejects them without touching their geometry.
+    if (!list->bounds.contains(point))
+        return false;
+
+    // Winding number of the ray running from the point towards +x.
+    int winding = 0;
+    for (const RasterEdge& edge : list->edges) {
+        if (edge.yTop > point.y())
+            break; // Edges are sorted by yTop; none further down can span.
+        if (edge.yBottom <= point.y())
+            continue;
+        float x = edge.xTop + (point.y() - edge.yTop) * edge.dxdy;
+        if (x > point.x())
+            winding += edge.winding;
+    }
+    return windRule == WindRule::NonZero ? winding != 0 : (winding & 1);
+}
+
+bool PathRasterizerHaiku::fill(BBitmap& target, const PathHaiku& path,
+    const AffineTransform& transform, WindRule windRule, rgb_color color,
+    const IntRect& deviceClip)
+{
+    if (target.ColorSpace() != B_RGBA32 && target.ColorSpace() != B_RGB32)
+        return false;
+
+    // Flatten under the linear part of the CTM only and shift by the
+    // translation while scanning; that way panning the same geometry hits
+    // the same cache entry for every offset.
+    AffineTransform linear(transform.a(), transform.b(), transform.c(),
+        transform.d(), 0, 0);
+    const float tx = transform.e();
+    const float ty = transform.f();
+
+    PathEdgeCache& cache = path.ensureEdgeCache();
+    RefPtr<RasterEdgeList> list = cache.lookup(linear);
+    if (!list) {
+        list = buildEdgeList(*path.platformPath(), linear);
+        if (!list)
+            return false;
+        cache.store(linear, list);
+    }
+
+    FloatRect deviceBounds = list->bounds;
+    deviceBounds.move(tx, ty);
+    IntRect rect = intersection(enclosingIntRect(deviceBounds), deviceClip);
+    if (rect.isEmpty() || list->edges.isEmpty())
+        return true;
+
+    const int width = rect.width();
+    Vector<uint16_t> coverage(width);
+    Vector<const RasterEdge*> active;
+    size_t nextEdge = 0;
+
+    uint8_t* bits = (uint8_t*)target.Bits();
+    int32 bytesPerRow = target.BytesPerRow();
+
+    // Premultiplied source pixel for the fully covered, fully opaque case.
+    uint32_t solid = color.blue | (color.green << 8) | (color.red << 16)
+        | (255u << 24);
+
+    Vector<std::pair<float, int8_t>> crossings;
+
+    for (int y = rect.y(); y < rect.maxY(); y++) {
+        memset(coverage.data(), 0, width * sizeof(uint16_t));
+
+        for (int sub = 0; sub < kSubScanlines; sub++) {
+            // Sample in the untranslated space the edges were built in.
+            float sy = y + (sub + 0.5f) / kSubScanlines - ty;
+
+            // Edges are sorted by yTop, so activation is a single pass.
+            while (nextEdge < list->edges.size() && list->edges[nextEdge].yTop <= sy) {
+                const RasterEdge& edge = list->edges[nextEdge++];
+                if (edge.yBottom > sy)
+                    active.append(&edge);
+            }
+            active.removeAllMatching([sy](const RasterEdge* edge) {
+                return edge->yBottom <= sy;
+            });
+            if (active.isEmpty())
+                continue;
+
+            crossings.resize(0);
+            for (const RasterEdge* edge : active)
+                crossings.append({ edge->xTop + (sy - edge->yTop) * edge->dxdy, edge->winding });
+            std::sort(crossings.begin(), crossings.end(),
+                [](const std::pair<float, int8_t>& a, const std::pair<float, int8_t>& b) {
+                    return a.first < b.first;
+                });
+
+            int winding = 0;
+            float spanStart = 0;
+            bool inside = false;
+            for (auto& crossing : crossings) {
+                winding += crossing.second;
+                bool nowInside = windRule == WindRule::NonZero
+                    ? winding : (winding & 1);
+                if (nowInside == inside)
+                    continue;
+                if (nowInside)
+                    spanStart = crossing.first;
+                else
+                    accumulateSpan(coverage.data(), width, spanStart + tx - rect.x(), crossing.first + tx - rect.x());
+                inside = nowInside;
+            }
+        }
+
+        uint8_t* pixel = bits + y * bytesPerRow + rect.x() * 4;
+        for (int x = 0; x < width; x++, pixel += 4) {
+            uint32_t rowCoverage = coverage[x];
+            if (!rowCoverage)
+                continue;
+            rowCoverage -= rowCoverage >> 8; // Map 256 to 255.
+
+            uint32_t alpha = (color.alpha * rowCoverage + 127) / 255;
+            if (!alpha)
+                continue;
+            if (alpha == 255) {
+                *(uint32_t*)pixel = solid;
+                continue;
+            }
+
+            // Source-over into the premultiplied BGRA surface.
+            uint32_t inverse = 255 - alpha;
+            pixel[0] = (color.blue * alpha + 127) / 255 + (pixel[0] * inverse + 127) / 255;
+            pixel[1] = (color.green * alpha + 127) / 255 + (pixel[1] * inverse + 127) / 255;
+            pixel[2] = (color.red * alpha + 127) / 255 + (pixel[2] * inverse + 127) / 255;
+            pixel[3] = alpha + (pixel[3] * inverse + 127) / 255;
+        }
+    }
+
+    return true;
+}
+
+} // namespace WebCore
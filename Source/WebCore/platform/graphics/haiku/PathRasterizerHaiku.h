@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 Haiku, Inc.
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE COMPUTER, INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE COMPUTER, INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#if USE(HAIKU)
+
+#include "AffineTransform.h"
+#include "FloatRect.h"
+#include "IntRect.h"
+#include "WindRule.h"
+
+#include <GraphicsDefs.h>
+
+#include <wtf/Lock.h>
+#include <wtf/ThreadSafeRefCounted.h>
+#include <wtf/Vector.h>
+
+class BBitmap;
+
+namespace WebCore {
+
+class PathHaiku;
+
+// One device-space polygon edge, produced by flattening a path's curves
+// under a given CTM. Edges always run top to bottom; the winding sign
+// remembers the original direction for the non-zero fill rule.
+struct RasterEdge {
+    float yTop;
+    float yBottom;
+    float xTop; // x at yTop
+    float dxdy;
+    int8_t winding; // +1 if the path ran downward here, -1 if upward
+};
+
+// The flattened form of one (path, CTM) pair, sorted by yTop and ready to
+// feed the scanline fill. Refcounted so a cache hit hands it out without
+// copying the edge vector.
+class RasterEdgeList : public ThreadSafeRefCounted<RasterEdgeList> {
+public:
+    Vector<RasterEdge> edges;
+    FloatRect bounds; // Device-space bounds of the edges.
+};
+
+// Chart redraws fill the same retained paths frame after frame, usually
+// under an unchanged CTM. Like PathTransformCache, each PathHaiku and its
+// copies share one of these so flattening and transforming only happens
+// when the geometry or the matrix actually changes; mutating the path
+// clears it. A handful of entries suffices for the same reason.
+//
+// Entries are keyed on the linear part of the CTM only (translation
+// removed): translating a flattened path just shifts it, so the fill
+// applies the translation at scan time and panning or scrolling the same
+// geometry keeps hitting one entry instead of rebuilding it per offset.
+class PathEdgeCache : public ThreadSafeRefCounted<PathEdgeCache> {
+public:
+    static constexpr size_t maxEntries = 4;
+
+    RefPtr<RasterEdgeList> lookup(const AffineTransform& transform)
+    {
+        Locker locker { m_lock };
+        for (auto& entry : m_entries) {
+            if (entry.first == transform)
+                return entry.second;
+        }
+        return nullptr;
+    }
+
+    void store(const AffineTransform& transform, RefPtr<RasterEdgeList> edges)
+    {
+        Locker locker { m_lock };
+        if (m_entries.size() == maxEntries)
+            m_entries.remove(0);
+        m_entries.append({ transform, WTFMove(edges) });
+    }
+
+    void invalidate()
+    {
+        Locker locker { m_lock };
+        m_entries.clear();
+    }
+
+private:
+    Lock m_lock;
+    Vector<std::pair<AffineTransform, RefPtr<RasterEdgeList>>, maxEntries> m_entries;
+};
+
+// Fills paths directly into a bitmap's pixels instead of submitting the
+// geometry to app_server, which rasterizes it server-side on every draw.
+// Used by GraphicsContextHaiku for canvas ImageBuffers, where the target
+// pixels are mapped in-process anyway.
+class PathRasterizerHaiku {
+public:
+    // Scanline fill of the path, transformed by the CTM and clipped to
+    // deviceClip, blending the color source-over into the premultiplied
+    // BGRA target. Returns false when the path cannot be handled here and
+    // the caller should fall back to BView::FillShape.
+    static bool fill(BBitmap& target, const PathHaiku&, const AffineTransform&,
+        WindRule, rgb_color, const IntRect& deviceClip);
+
+    // Point-in-path test over the cached edge lists, with a cheap bounds
+    // pre-check. Returns nullopt when the shape could not be flattened and
+    // the caller should fall back to the bitmap hit test.
+    static std::optional<bool> contains(const PathHaiku&, const FloatPoint&,
+        WindRule);
+};
+
+} // namespace WebCore
+
+#endif // USE(HAIKU)
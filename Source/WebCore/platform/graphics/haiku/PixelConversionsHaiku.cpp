@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE COMPUTER, INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE COMPUTER, INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "PixelConversionsHaiku.h"
+
+#if USE(HAIKU)
+
+#include <algorithm>
+
+#if CPU(X86_64)
+#include <emmintrin.h>
+#elif CPU(ARM64)
+#include <arm_neon.h>
+#endif
+
+namespace WebCore {
+
+void convertBGRAPremultipliedToRGBAUnpremultiplied(const uint8_t* source, uint8_t* destination, unsigned pixelCount)
+{
+    // Unpremultiplying needs a per-pixel division, which does not vectorize
+    // exactly; keep the division but shortcut opaque and fully transparent
+    // pixels, which dominate real content.
+    for (unsigned i = 0; i < pixelCount; i++) {
+        uint8_t b = source[0];
+        uint8_t g = source[1];
+        uint8_t r = source[2];
+        uint8_t a = source[3];
+
+        if (a == 255 || !a) {
+            destination[0] = r;
+            destination[1] = g;
+            destination[2] = b;
+        } else {
+            destination[0] = std::min(255u, (r * 255u + a / 2) / a);
+            destination[1] = std::min(255u, (g * 255u + a / 2) / a);
+            destination[2] = std::min(255u, (b * 255u + a / 2) / a);
+        }
+        destination[3] = a;
+
+        source += 4;
+        destination += 4;
+    }
+}
+
+void unpremultiplyPreservingByteOrder(const uint8_t* source, uint8_t* destination, unsigned pixelCount)
+{
+    for (unsigned i = 0; i < pixelCount; i++) {
+        uint8_t a = source[3];
+
+        if (a == 255 || !a) {
+            destination[0] = source[0];
+            destination[1] = source[1];
+            destination[2] = source[2];
+        } else {
+            destination[0] = std::min(255u, (source[0] * 255u + a / 2) / a);
+            destination[1] = std::min(255u, (source[1] * 255u + a / 2) / a);
+            destination[2] = std::min(255u, (source[2] * 255u + a / 2) / a);
+        }
+        destination[3] = a;
+
+        source += 4;
+        destination += 4;
+    }
+}
+
+#if CPU(X86_64)
+
+// (x * alpha) / 255 with rounding, on 16-bit lanes holding x * alpha.
+static inline __m128i divideBy255(__m128i product)
+{
+    product = _mm_add_epi16(product, _mm_set1_epi16(128));
+    product = _mm_add_epi16(product, _mm_srli_epi16(product, 8));
+    return _mm_srli_epi16(product, 8);
+}
+
+// Premultiplies and swizzles two pixels unpacked to 16-bit lanes
+// ([R,G,B,A, R,G,B,A] words) into BGRA order.
+static inline __m128i premultiplyAndSwizzleWide(__m128i wide)
+{
+    // Word mask selecting the alpha lane of each pixel.
+    const __m128i alphaLaneMask = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+
+    // RGBA -> BGRA: swap words 0 and 2 of each 4-word pixel.
+    wide = _mm_shufflelo_epi16(wide, _MM_SHUFFLE(3, 0, 1, 2));
+    wide = _mm_shufflehi_epi16(wide, _MM_SHUFFLE(3, 0, 1, 2));
+
+    // Broadcast each pixel's alpha to all four lanes and multiply.
+    __m128i alpha = _mm_shufflelo_epi16(wide, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+    __m128i premultiplied = divideBy255(_mm_mullo_epi16(wide, alpha));
+
+    // Restore the untouched alpha lane.
+    return _mm_or_si128(_mm_andnot_si128(alphaLaneMask, premultiplied),
+        _mm_and_si128(alphaLaneMask, wide));
+}
+
+void convertRGBAUnpremultipliedToBGRAPremultiplied(const uint8_t* source, uint8_t* destination, unsigned pixelCount)
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    unsigned vectorPixels = pixelCount & ~3u;
+    for (unsigned i = 0; i < vectorPixels; i += 4) {
+        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+
+        __m128i low = premultiplyAndSwizzleWide(_mm_unpacklo_epi8(pixels, zero));
+        __m128i high = premultiplyAndSwizzleWide(_mm_unpackhi_epi8(pixels, zero));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm_packus_epi16(low, high));
+        source += 16;
+        destination += 16;
+    }
+    pixelCount -= vectorPixels;
+
+#elif CPU(ARM64)
+
+void convertRGBAUnpremultipliedToBGRAPremultiplied(const uint8_t* source, uint8_t* destination, unsigned pixelCount)
+{
+    unsigned vectorPixels = pixelCount & ~7u;
+    for (unsigned i = 0; i < vectorPixels; i += 8) {
+        uint8x8x4_t pixels = vld4_u8(source);
+        uint8x8_t alpha = pixels.val[3];
+
+        uint8x8x4_t result;
+        // Store as BGRA while premultiplying with rounding (x * a + 127) / 255.
+        for (int channel = 0; channel < 3; channel++) {
+            uint16x8_t product = vmull_u8(pixels.val[channel], alpha);
+            product = vaddq_u16(product, vdupq_n_u16(128));
+            product = vaddq_u16(product, vshrq_n_u16(product, 8));
+            result.val[2 - channel] = vshrn_n_u16(product, 8);
+        }
+        result.val[3] = alpha;
+
+        vst4_u8(destination, result);
+        source += 32;
+        destination += 32;
+    }
+    pixelCount -= vectorPixels;
+
+#else
+
+void convertRGBAUnpremultipliedToBGRAPremultiplied(const uint8_t* source, uint8_t* destination, unsigned pixelCount)
+{
+
+#endif
+
+    // Scalar tail (and the whole row on architectures without a kernel).
+    for (unsigned i = 0; i < pixelCount; i++) {
+        uint8_t r = source[0];
+        uint8_t g = source[1];
+        uint8_t b = source[2];
+        uint8_t a = source[3];
+
+        destination[0] = (b * a + 127) / 255;
+        destination[1] = (g * a + 127) / 255;
+        destination[2] = (r * a + 127) / 255;
+        destination[3] = a;
+
+        source += 4;
+        destination += 4;
+    }
+}
+
+} // namespace WebCore
+
+#endif
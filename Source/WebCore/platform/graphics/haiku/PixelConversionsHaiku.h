@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE COMPUTER, INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE COMPUTER, INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#if USE(HAIKU)
+
+#include <stdint.h>
+
+namespace WebCore {
+
+// Row kernels converting between app_server's B_RGBA32 layout (BGRA,
+// premultiplied) and the unpremultiplied RGBA that canvas pixel access
+// expects. The premultiply direction is vectorized (SSE2 on x86_64, NEON
+// on ARM64); the unpremultiply direction keeps exact integer division but
+// shortcuts the dominant opaque-pixel case.
+void convertBGRAPremultipliedToRGBAUnpremultiplied(const uint8_t* source, uint8_t* destination, unsigned pixelCount);
+void convertRGBAUnpremultipliedToBGRAPremultiplied(const uint8_t* source, uint8_t* destination, unsigned pixelCount);
+
+// Order-preserving unpremultiply, for decoded frames whose channel layout
+// already matches B_RGBA32.
+void unpremultiplyPreservingByteOrder(const uint8_t* source, uint8_t* destination, unsigned pixelCount);
+
+} // namespace WebCore
+
+#endif
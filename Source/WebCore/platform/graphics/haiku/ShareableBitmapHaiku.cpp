@@ -50,25 +50,30 @@ std::unique_ptr<GraphicsContext> ShareableBitmap::createGraphicsContext()
 
 void ShareableBitmap::paint(GraphicsContext& context, const IntPoint& dstPoint, const IntRect& srcRect)
 {
-    BBitmap bitmap(BRect(B_ORIGIN, size()), B_RGBA32, true);
-    bitmap.ImportBits(span().data(), size().width() * size().height() * 4, 4 * size().width(), 0, B_RGBA32);
+    paint(context, 1, dstPoint, srcRect);
+}
+
+void ShareableBitmap::paint(GraphicsContext& context, float scaleFactor, const IntPoint& dstPoint, const IntRect& srcRect)
+{
+    // The platform image aliases the shared area (see createPlatformImage),
+    // so no pixel data is copied here: app_server reads straight out of the
+    // memory the bitmap was rendered into, clipped to the requested rect.
+    PlatformImagePtr image = createPlatformImage(DontCopyBackingStore);
+    if (!image || !image->IsValid())
+        return;
+
+    FloatRect destRect(dstPoint, srcRect.size());
+    FloatRect sourceRect(srcRect);
+    sourceRect.scale(scaleFactor);
 
     BView* viewSurface = context.platformContext();
 
     viewSurface->LockLooper();
-    viewSurface->DrawBitmap(&bitmap);
+    viewSurface->DrawBitmap(image.get(), sourceRect, destRect);
     viewSurface->Sync();
     viewSurface->UnlockLooper();
 }
 
-void ShareableBitmap::paint(GraphicsContext& context, float scaleFactor, const IntPoint& dstPoint, const IntRect& srcRect)
-{
-    FloatRect destRect(dstPoint, srcRect.size());
-    FloatRect srcRectScaled(srcRect);
-    srcRectScaled.scale(scaleFactor);
-    notImplemented();
-}
-
 WebCore::PlatformImagePtr ShareableBitmap::createPlatformImage(WebCore::BackingStoreCopy, WebCore::ShouldInterpolate)
 {
     return WebCore::PlatformImagePtr(new BitmapRef(m_sharedMemory->area(), 0, bounds(), 0, /*m_configuration.platformColorSpace()*/ B_RGBA32, bytesPerRow()));
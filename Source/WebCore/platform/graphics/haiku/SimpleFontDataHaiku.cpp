@@ -114,15 +114,35 @@ float Font::platformWidthForGlyph(Glyph glyph) const
     if (!platformData().size())
         return 0;
 
-    if (glyph == 0)
-        glyph = 0xfdd1;
-
-    float escapements[1];
-    char string[5] = { 0 };
-    char* ptr = string;
-    BUnicodeChar::ToUTF8((uint32)glyph, &ptr);
-    m_platformData.font()->GetEscapements(string, 1, escapements);
-    return escapements[0] * m_platformData.font()->Size();
+    // Every GetEscapements() call is a synchronous app_server round trip,
+    // and each web process pays it again for every distinct glyph it
+    // measures. Fetch the escapements for the whole 16-glyph metrics page
+    // this glyph lives on in one call and prime the width cache with the
+    // neighbors, so measuring a run of text costs a handful of round trips
+    // instead of one per glyph.
+    const unsigned glyphsPerBlock = 16; // Matches the GlyphMetricsMap page size.
+    Glyph base = glyph - (glyph % glyphsPerBlock);
+
+    char characters[glyphsPerBlock * 4 + 1] = { 0 };
+    char* ptr = characters;
+    for (unsigned i = 0; i < glyphsPerBlock; i++) {
+        uint32 character = base + i;
+        // The replacement character used for glyph 0 also stands in for the
+        // surrogate range, which cannot be encoded as UTF-8.
+        if (!character || (character >= 0xD800 && character <= 0xDFFF))
+            character = 0xfdd1;
+        BUnicodeChar::ToUTF8(character, &ptr);
+    }
+
+    float escapements[glyphsPerBlock];
+    m_platformData.font()->GetEscapements(characters, glyphsPerBlock, escapements);
+
+    float size = m_platformData.font()->Size();
+    for (unsigned i = 0; i < glyphsPerBlock; i++) {
+        if (base + i != glyph)
+            m_glyphToWidthMap.setMetricsForGlyph(base + i, escapements[i] * size);
+    }
+    return escapements[glyph - base] * size;
 }
 
 bool Font::platformSupportsCodePoint(char32_t character, std::optional<char32_t> variation) const
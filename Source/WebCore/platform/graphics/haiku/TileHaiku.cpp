@@ -1,5 +1,6 @@
 /*
  * Copyright (C) 2014 Haiku, inc.
+ * Copyright (C) 2026 Haiku, inc.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -28,64 +29,340 @@
 
 #if USE(TILED_BACKING_STORE) && PLATFORM(HAIKU)
 
-#include "NotImplemented.h"
+#include "BitmapPoolHaiku.h"
+#include "ControlFactory.h"
+#include "DisplayListItem.h"
+#include "DisplayListRecorderImpl.h"
+#include "GraphicsContextHaiku.h"
+#include "TileRasterPool.h"
+#include "TiledBackingStore.h"
+#include "TiledBackingStoreClient.h"
+
+#include <Font.h>
+#include <View.h>
+#include <stdio.h>
+#include <wtf/SystemTracing.h>
 
 namespace WebCore {
 
-TileHaiku::TileHaiku(TiledBackingStore*, const Coordinate&)
-    : m_buffer(BRect(0,0,0,0), B_RGBA32)
+// Preview rasters cover a quarter of the pixels; coarse enough to be fast,
+// fine enough that stretched text stays legible during the scroll burst.
+static const float previewResolutionScale = 0.5f;
+
+bool TileHaiku::s_lowResolutionPreview = false;
+bool TileHaiku::s_debugOverlay = false;
+
+// Rasters completed across all tiles, and a one-second sampling window for
+// the rate shown in the overlay. There is no per-frame hook in the tile
+// itself, so the rate is a rolling rasters-per-second figure instead of a
+// rasters-per-frame one.
+static std::atomic<uint32> totalRasterCount { 0 };
+static uint32 rasterRateWindowStart = 0;
+static bigtime_t rasterRateWindowTime = 0;
+static uint32 rasterRate = 0;
+
+// Bytes held in tile buffers process-wide; buffers are allocated on raster
+// workers and dropped on the main thread, hence the atomic.
+static std::atomic<size_t> tileBufferBytes { 0 };
+
+static void unaccountBuffer(const std::unique_ptr<BBitmap>& buffer)
+{
+    if (buffer)
+        tileBufferBytes.fetch_sub(buffer->BitsLength(), std::memory_order_relaxed);
+}
+
+/*static*/ size_t TileHaiku::memoryUsage()
+{
+    return tileBufferBytes.load(std::memory_order_relaxed);
+}
+
+static std::atomic<int64_t> checkerboardArea { 0 };
+
+/*static*/ void TileHaiku::addCheckerboardArea(int64_t area)
+{
+    checkerboardArea.fetch_add(area, std::memory_order_relaxed);
+}
+
+/*static*/ int64_t TileHaiku::takeCheckerboardArea()
+{
+    return checkerboardArea.exchange(0, std::memory_order_relaxed);
+}
+
+void TileHaiku::setLowResolutionPreviewEnabled(bool enabled)
+{
+    s_lowResolutionPreview = enabled;
+}
+
+void TileHaiku::setDebugOverlayEnabled(bool enabled)
+{
+    s_debugOverlay = enabled;
+}
+
+TileHaiku::TileHaiku(TiledBackingStore* backingStore, const Coordinate& tileCoordinate)
+    : m_backingStore(backingStore)
+    , m_coordinate(tileCoordinate)
+    , m_rect(backingStore->tileRectForCoordinate(tileCoordinate))
 {
-    puts("create");
-    notImplemented();
+    m_dirtyRegion.Include(BRect(m_rect));
 }
 
 TileHaiku::~TileHaiku()
 {
-    puts("destroy");
+    // A worker may still be replaying into our back buffer; wait for it so
+    // the BBitmap is not torn down under the replay.
+    if (m_rasterPending)
+        TileRasterPool::singleton().waitForCompletion();
+
+    unaccountBuffer(m_frontBuffer);
+    unaccountBuffer(m_backBuffer);
+
+    // Tiles die in batches as the scroll moves on; their buffers almost
+    // always fit the tiles about to be created, so recycle them.
+    BitmapPoolHaiku::singleton().release(WTFMove(m_frontBuffer));
+    BitmapPoolHaiku::singleton().release(WTFMove(m_backBuffer));
 }
 
 bool TileHaiku::isDirty() const
 {
-    puts("isdirty");
-    notImplemented();
-    return false;
+    return m_dirtyRegion.CountRects() > 0;
 }
 
-void TileHaiku::invalidate(const IntRect&)
+void TileHaiku::invalidate(const IntRect& dirtyRect)
 {
-    puts("invalidate");
-    notImplemented();
+    IntRect tileDirtyRect = intersection(dirtyRect, m_rect);
+    if (tileDirtyRect.isEmpty())
+        return;
+
+    m_dirtyRegion.Include(BRect(tileDirtyRect));
 }
 
 Vector<IntRect> TileHaiku::updateBackBuffer()
 {
-    puts("update");
-    notImplemented();
+    if (!isDirty() || m_rasterPending)
+        return { };
+
+    // BRegion already keeps the accumulated damage as disjoint, coalesced
+    // rects; take a snapshot of it so only the union is repainted instead
+    // of the whole tile.
+    BRegion damage = m_dirtyRegion;
+    IntRect paintRect = enclosingIntRect(FloatRect(damage.Frame()));
+    paintRect.intersect(m_rect);
+    m_dirtyRegion.MakeEmpty();
+
+    // Tiles are sized in device pixels; the client paints in contents
+    // coordinates and the replay applies the contents scale below, so on
+    // scaled displays text and images are rasterized at device resolution
+    // instead of being rendered at 1x and magnified.
+    IntRect contentsPaintRect = m_backingStore->mapToContents(paintRect);
+
+    // Record the client paint on the main thread; only the replay is moved
+    // off to a worker. The display list keeps all referenced resources
+    // alive through its resource heap.
+    auto displayList = makeUnique<DisplayList::DisplayList>();
+    {
+        GraphicsContextState state;
+        DisplayList::RecorderImpl recorder(*displayList, state, FloatRect(contentsPaintRect), AffineTransform());
+        m_backingStore->client()->tiledBackingStorePaint(&recorder, contentsPaintRect);
+    }
+
+    Vector<IntRect> paintedRects;
+    paintedRects.reserveInitialCapacity(damage.CountRects());
+    for (int32 i = 0; i < damage.CountRects(); i++)
+        paintedRects.append(enclosingIntRect(FloatRect(damage.RectAt(i))));
+
+    auto priority = m_rect.intersects(m_backingStore->visibleRect())
+        ? TileRasterPool::Priority::Visible
+        : TileRasterPool::Priority::Prefetch;
+
+    // A visible tile that has never been rastered is about to checkerboard;
+    // while the preview mode is on, give it a cheap half-resolution pass
+    // first and leave it dirty so the full-resolution raster follows as
+    // soon as the pool catches up.
+    bool preview = s_lowResolutionPreview && !m_frontBuffer
+        && priority == TileRasterPool::Priority::Visible;
+    if (preview)
+        m_dirtyRegion.Include(BRect(paintRect));
+
+    m_rasterPending = true;
+    TileRasterPool::singleton().dispatch(priority,
+        [this, displayList = WTFMove(displayList), damage, contentsPaintRect, preview]() mutable {
+            rasterizeDisplayListIntoBackBuffer(*displayList, damage, contentsPaintRect, preview);
+        },
+        [tile = RefPtr<Tile>(this), this] {
+            m_rasterPending = false;
+        });
+
+    return paintedRects;
+}
+
+void TileHaiku::rasterizeDisplayListIntoBackBuffer(const DisplayList::DisplayList& displayList, BRegion& damage, const IntRect& contentsPaintRect, bool preview)
+{
+    TraceScope tracingScope(TileRasterStart, TileRasterEnd);
+    bigtime_t rasterStart = system_time();
+    float resolutionScale = preview ? previewResolutionScale : 1;
+    IntSize bufferSize = m_rect.size();
+    bufferSize.scale(resolutionScale);
+    BRect bufferBounds(0, 0, bufferSize.width() - 1, bufferSize.height() - 1);
+
+    if (!m_backBuffer || m_backBuffer->Bounds() != bufferBounds) {
+        unaccountBuffer(m_backBuffer);
+        BitmapPoolHaiku::singleton().release(WTFMove(m_backBuffer));
+        m_backBuffer = BitmapPoolHaiku::singleton().acquire(bufferBounds,
+            B_RGBA32, B_BITMAP_ACCEPTS_VIEWS);
+        if (!m_backBuffer)
+            return;
+        tileBufferBytes.fetch_add(m_backBuffer->BitsLength(), std::memory_order_relaxed);
+    } else if (m_frontBuffer && !m_frontBufferIsPreview && !preview) {
+        // Carry the still-valid pixels over so we only replay the dirty part.
+        m_backBuffer->ImportBits(m_frontBuffer.get());
+    }
+
+    BView* view = new BView(m_backBuffer->Bounds(), "TileRaster", 0, 0);
+    m_backBuffer->Lock();
+    m_backBuffer->AddChild(view);
+
+    // Constrain the replay to the damaged sub-tile region so pixels outside
+    // the coalesced dirty rects are left untouched. Preview rasters always
+    // cover the whole tile, and their buffer is in preview coordinates, so
+    // the device-pixel damage region does not apply to them.
+    if (!preview) {
+        damage.OffsetBy(-m_rect.x(), -m_rect.y());
+        view->ConstrainClippingRegion(&damage);
+    }
+
+    GraphicsContextHaiku context(view);
+    if (preview)
+        context.scale(resolutionScale);
+    context.translate(-m_rect.x(), -m_rect.y());
+    context.scale(m_backingStore->contentsScale());
+    context.clip(FloatRect(contentsPaintRect));
+
+    auto& controlFactory = ControlFactory::shared();
+    for (auto& item : displayList.items())
+        applyItem(context, displayList.resourceHeap(), controlFactory, item);
+
+    view->Sync();
+    view->RemoveSelf();
+    m_backBuffer->Unlock();
+    delete view;
+
+    m_lastRasterFinished = system_time();
+    m_lastRasterDuration = m_lastRasterFinished - rasterStart;
+    m_rasterCount++;
+    totalRasterCount.fetch_add(1, std::memory_order_relaxed);
+
+    m_backBufferIsPreview = preview;
+    m_backBufferReady.store(true, std::memory_order_release);
 }
 
 void TileHaiku::swapBackBufferToFront()
 {
-    puts("swap");
-    notImplemented();
+    if (!m_backBufferReady.load(std::memory_order_acquire))
+        return;
+
+    std::swap(m_frontBuffer, m_backBuffer);
+    std::swap(m_frontBufferIsPreview, m_backBufferIsPreview);
+    m_backBufferReady.store(false, std::memory_order_relaxed);
 }
 
 bool TileHaiku::isReadyToPaint() const
 {
-    puts("ready");
-    notImplemented();
-    return false;
+    return m_frontBuffer != nullptr;
 }
 
-void TileHaiku::paint(GraphicsContext*, const IntRect&)
+void TileHaiku::paint(GraphicsContext* context, const IntRect& rect)
 {
-    puts("paint");
-    notImplemented();
+    if (!isReadyToPaint())
+        return;
+
+    IntRect target = intersection(rect, m_rect);
+    FloatRect source(target.x() - m_rect.x(), target.y() - m_rect.y(),
+        target.width(), target.height());
+
+    BView* view = context->platformContext();
+    if (m_frontBufferIsPreview) {
+        // Stretch the half-resolution preview; the crisp raster replaces it
+        // on the next buffer swap.
+        source.scale(previewResolutionScale);
+        view->DrawBitmap(m_frontBuffer.get(), BRect(source), BRect(target),
+            B_FILTER_BITMAP_BILINEAR);
+    } else {
+        view->DrawBitmap(m_frontBuffer.get(), BRect(source), BRect(target));
+    }
+
+    if (s_debugOverlay)
+        paintDebugOverlay(view, target);
 }
 
-void TileHaiku::resize(const WebCore::IntSize&)
+void TileHaiku::paintDebugOverlay(BView* view, const IntRect& paintedRect)
 {
-    puts("resize");
-    notImplemented();
+    bigtime_t now = system_time();
+
+    // Refresh the rolling raster rate once per second.
+    if (now - rasterRateWindowTime >= 1000000) {
+        uint32 total = totalRasterCount.load(std::memory_order_relaxed);
+        rasterRate = total - rasterRateWindowStart;
+        rasterRateWindowStart = total;
+        rasterRateWindowTime = now;
+    }
+
+    view->PushState();
+    view->SetDrawingMode(B_OP_ALPHA);
+
+    // Tint freshly rastered pixels red, fading out so repaint storms show
+    // up as solid red areas and settled content fades back to normal.
+    static const bigtime_t tintDuration = 300000;
+    bigtime_t age = now - m_lastRasterFinished;
+    if (age < tintDuration) {
+        view->SetHighColor(255, 0, 0, 120 - 120 * age / tintDuration);
+        view->FillRect(BRect(paintedRect));
+    }
+
+    view->SetHighColor(0, 160, 0, 160);
+    view->StrokeRect(BRect(m_rect));
+
+    // Last raster duration, age of the front buffer, per-tile raster count
+    // and the global raster rate. Drawn at the tile origin; the context
+    // clip takes care of partially visible tiles.
+    char label[64];
+    snprintf(label, sizeof(label), "%.1f ms  %.1f s  #%" B_PRIu32 "  %" B_PRIu32 "/s",
+        m_lastRasterDuration / 1000.0, age / 1000000.0, m_rasterCount, rasterRate);
+
+    BFont font(be_fixed_font);
+    font.SetSize(10);
+    view->SetFont(&font);
+    float labelWidth = font.StringWidth(label);
+
+    view->SetHighColor(255, 255, 255, 180);
+    view->FillRect(BRect(m_rect.x(), m_rect.y(),
+        m_rect.x() + labelWidth + 6, m_rect.y() + 14));
+    view->SetHighColor(0, 0, 0, 255);
+    view->DrawString(label, BPoint(m_rect.x() + 3, m_rect.y() + 11));
+
+    view->PopState();
+}
+
+void TileHaiku::resize(const WebCore::IntSize& newSize)
+{
+    IntRect newRect(m_rect.location(), newSize);
+    if (m_rect == newRect)
+        return;
+
+    m_rect = newRect;
+
+    // The buffers no longer match the tile geometry; drop them and repaint
+    // the whole tile on the next update.
+    if (m_rasterPending)
+        TileRasterPool::singleton().waitForCompletion();
+    unaccountBuffer(m_frontBuffer);
+    unaccountBuffer(m_backBuffer);
+    m_frontBuffer = nullptr;
+    m_backBuffer = nullptr;
+    m_frontBufferIsPreview = false;
+    m_backBufferIsPreview = false;
+    m_backBufferReady.store(false, std::memory_order_relaxed);
+    m_dirtyRegion.MakeEmpty();
+    m_dirtyRegion.Include(BRect(m_rect));
 }
 
 }
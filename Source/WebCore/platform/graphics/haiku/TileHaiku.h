@@ -1,5 +1,6 @@
 /*
  * Copyright (C) 2014 Haiku, inc.
+ * Copyright (C) 2026 Haiku, inc.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -28,23 +29,30 @@
 
 #if USE(TILED_BACKING_STORE) && PLATFORM(HAIKU)
 
+#include "DisplayList.h"
 #include "IntPoint.h"
 #include "IntRect.h"
 #include "Tile.h"
 
 #include <Bitmap.h>
 #include <Region.h>
-#include <wtf/PassRefPtr.h>
+#include <atomic>
+#include <memory>
 #include <wtf/RefCounted.h>
+#include <wtf/RefPtr.h>
 
+class BView;
 
 namespace WebCore {
 
 class TiledBackingStore;
 
+// A double-buffered tile. The dirty part of the tile is recorded into a
+// display list on the main thread, replayed into the back buffer on a
+// TileRasterPool worker, and swapped to the front once the replay is done.
 class TileHaiku : public Tile {
 public:
-    static PassRefPtr<Tile> create(TiledBackingStore* backingStore, const Coordinate& tileCoordinate)
+    static RefPtr<Tile> create(TiledBackingStore* backingStore, const Coordinate& tileCoordinate)
     {
         return adoptRef(new TileHaiku(backingStore, tileCoordinate));
     }
@@ -61,18 +69,64 @@ public:
     virtual const IntRect& rect() const { return m_rect; }
     virtual void resize(const WebCore::IntSize&) override;
 
+    // While enabled, freshly exposed visible tiles take a quick
+    // half-resolution raster pass first and are stretched at paint time;
+    // the full-resolution raster replaces them on the next update. The
+    // scrolling fast path turns this on when rasterization falls behind
+    // the scroll position.
+    static void setLowResolutionPreviewEnabled(bool);
+
+    // While enabled, paint() draws a diagnostic overlay on top of each
+    // blitted tile: a red tint fading out over the moments after a raster
+    // (so repaint storms light up), the tile border, and a label with the
+    // last raster duration, the raster count, and the global raster rate.
+    // The overlay is drawn after the front buffer blit, so recorded tile
+    // content is never affected.
+    static void setDebugOverlayEnabled(bool);
+
+    // Total bytes currently held in tile front and back buffers across all
+    // tiles; feeds the Layers category of the resource usage thread.
+    static size_t memoryUsage();
+
+    // Checkerboard accounting for the scroll benchmark: the backing store
+    // reports the area (in px²) of every checker pattern it paints, and
+    // the harness drains the accumulated figure once per sample.
+    static void addCheckerboardArea(int64_t area);
+    static int64_t takeCheckerboardArea();
+
 protected:
     TileHaiku(TiledBackingStore*, const Coordinate&);
 
+    void rasterizeDisplayListIntoBackBuffer(const DisplayList::DisplayList&, BRegion& damage, const IntRect& contentsPaintRect, bool preview);
+    void paintDebugOverlay(BView*, const IntRect& paintedRect);
+
     TiledBackingStore* m_backingStore;
     Coordinate m_coordinate;
     IntRect m_rect;
 
-    BBitmap m_buffer;
+    std::unique_ptr<BBitmap> m_frontBuffer;
+    std::unique_ptr<BBitmap> m_backBuffer;
     BRegion m_dirtyRegion;
+
+    // Set by the raster worker once the back buffer holds the latest paint;
+    // consumed on the main thread by swapBackBufferToFront().
+    std::atomic<bool> m_backBufferReady { false };
+    bool m_rasterPending { false };
+
+    // Whether the respective buffer holds a low-resolution preview raster.
+    bool m_frontBufferIsPreview { false };
+    bool m_backBufferIsPreview { false };
+
+    // Written by the raster worker, read by paint() for the debug overlay.
+    // A torn read only garbles one overlay label for one frame.
+    bigtime_t m_lastRasterDuration { 0 };
+    bigtime_t m_lastRasterFinished { 0 };
+    uint32 m_rasterCount { 0 };
+
+    static bool s_lowResolutionPreview;
+    static bool s_debugOverlay;
 };
 
 }
 #endif
 #endif
-
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "TileRasterPool.h"
+
+#if USE(TILED_BACKING_STORE) && PLATFORM(HAIKU)
+
+#include <wtf/NeverDestroyed.h>
+#include <wtf/NumberOfCores.h>
+#include <wtf/RunLoop.h>
+
+namespace WebCore {
+
+TileRasterPool& TileRasterPool::singleton()
+{
+    static NeverDestroyed<TileRasterPool> pool;
+    return pool;
+}
+
+TileRasterPool::TileRasterPool()
+    : m_pool(WorkerPool::create("TileRaster"_s, std::max(1, WTF::numberOfProcessorCores())))
+{
+}
+
+void TileRasterPool::dispatch(Priority priority, Function<void()>&& job, Function<void()>&& completionHandler)
+{
+    auto wrappedJob = [job = WTFMove(job), completionHandler = WTFMove(completionHandler)]() mutable {
+        job();
+
+        if (completionHandler)
+            RunLoop::main().dispatch(WTFMove(completionHandler));
+    };
+
+    {
+        Locker locker { m_lock };
+        m_pendingJobs++;
+        if (priority == Priority::Visible)
+            m_visibleJobs.append(WTFMove(wrappedJob));
+        else
+            m_prefetchJobs.append(WTFMove(wrappedJob));
+    }
+
+    // The posted task is a generic drain step: each worker wake-up takes
+    // whatever is currently the most urgent job, so visible tiles recorded
+    // after prefetch tiles still jump the queue.
+    m_pool->postTask([this] {
+        auto job = takeNextJob();
+        job();
+
+        Locker locker { m_lock };
+        if (!--m_pendingJobs)
+            m_condition.notifyAll();
+    });
+}
+
+Function<void()> TileRasterPool::takeNextJob()
+{
+    Locker locker { m_lock };
+    if (!m_visibleJobs.isEmpty())
+        return m_visibleJobs.takeFirst();
+    return m_prefetchJobs.takeFirst();
+}
+
+void TileRasterPool::waitForCompletion()
+{
+    Locker locker { m_lock };
+    m_condition.wait(m_lock, [this] {
+        return !m_pendingJobs;
+    });
+}
+
+} // namespace WebCore
+
+#endif
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#if USE(TILED_BACKING_STORE) && PLATFORM(HAIKU)
+
+#include <wtf/Condition.h>
+#include <wtf/Deque.h>
+#include <wtf/Function.h>
+#include <wtf/Lock.h>
+#include <wtf/WorkerPool.h>
+
+namespace WebCore {
+
+// Fans tile rasterization out to one worker thread per core. A job replays
+// a paint recorded on the main thread into a tile-owned BBitmap; the
+// optional completion handler is bounced back through the main RunLoop so
+// Tile state is only ever mutated there.
+class TileRasterPool {
+public:
+    // Tiles intersecting the visible viewport are rasterized before tiles
+    // that only cover the prefetch margin.
+    enum class Priority { Visible, Prefetch };
+
+    static TileRasterPool& singleton();
+
+    void dispatch(Priority, Function<void()>&& job, Function<void()>&& completionHandler = nullptr);
+
+    // Blocks the calling thread until every job dispatched so far has run.
+    // Used before swapping back buffers to the front.
+    void waitForCompletion();
+
+private:
+    TileRasterPool();
+
+    Function<void()> takeNextJob();
+
+    Ref<WorkerPool> m_pool;
+    Lock m_lock;
+    Condition m_condition;
+    Deque<Function<void()>> m_visibleJobs;
+    Deque<Function<void()>> m_prefetchJobs;
+    unsigned m_pendingJobs { 0 };
+};
+
+} // namespace WebCore
+
+#endif
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "TiledScrollingFastPathHaiku.h"
+
+#if USE(TILED_BACKING_STORE) && PLATFORM(HAIKU)
+
+#include "GraphicsContextHaiku.h"
+#include "TileHaiku.h"
+#include "TiledBackingStore.h"
+
+#include <View.h>
+
+namespace WebCore {
+
+TiledScrollingFastPathHaiku::TiledScrollingFastPathHaiku(TiledBackingStore* backingStore, BView* target)
+    : m_backingStore(backingStore)
+    , m_target(target)
+{
+}
+
+void TiledScrollingFastPathHaiku::setPrerenderMargin(float horizontal, float vertical)
+{
+    m_horizontalMargin = horizontal;
+    m_verticalMargin = vertical;
+    m_backingStore->setKeepAndCoverAreaMultipliers(
+        FloatSize(m_horizontalMargin + 1, m_verticalMargin + 1),
+        FloatSize(m_horizontalMargin, m_verticalMargin));
+}
+
+void TiledScrollingFastPathHaiku::setVisibleRect(const IntRect& rect)
+{
+    m_visibleRect = rect;
+}
+
+bool TiledScrollingFastPathHaiku::scrollBy(const FloatSize& delta)
+{
+    m_visibleRect.move(delta.width(), delta.height());
+
+    // Bias future prerendering along the direction we are moving so the
+    // margin stays ahead of the user.
+    m_backingStore->coverWithTilesIfNeeded(delta);
+
+    // Blit whatever is already rasterized right away; this runs on the
+    // thread delivering the wheel event, without waiting for the main
+    // thread to schedule a paint.
+    if (!m_target->LockLooper())
+        return false;
+
+    GraphicsContextHaiku context(m_target);
+    context.save(GraphicsContextState::Purpose::Initial);
+    context.translate(-m_visibleRect.x(), -m_visibleRect.y());
+
+    bool fullyCovered = paintTilesForRect(context, m_visibleRect);
+
+    context.restore(GraphicsContextState::Purpose::Initial);
+    m_target->Flush();
+    m_target->UnlockLooper();
+
+    // If rasterization is outrunning the scroll we just checkerboarded;
+    // let freshly exposed tiles take a quick half-resolution pass until
+    // coverage is restored, trading momentary sharpness for fluidity.
+    TileHaiku::setLowResolutionPreviewEnabled(!fullyCovered);
+
+    return fullyCovered;
+}
+
+bool TiledScrollingFastPathHaiku::paintTilesForRect(GraphicsContext& context, const IntRect& rect)
+{
+    Tile::Coordinate topLeft = m_backingStore->tileCoordinateForPoint(rect.location());
+    Tile::Coordinate bottomRight = m_backingStore->tileCoordinateForPoint(IntPoint(rect.maxX() - 1, rect.maxY() - 1));
+
+    bool fullyCovered = true;
+    for (int y = topLeft.y(); y <= bottomRight.y(); y++) {
+        for (int x = topLeft.x(); x <= bottomRight.x(); x++) {
+            Tile::Coordinate coordinate(x, y);
+            RefPtr<Tile> tile = m_backingStore->tileAt(coordinate);
+            if (tile && tile->isReadyToPaint()) {
+                tile->paint(&context, rect);
+                continue;
+            }
+
+            // Not prerendered yet: checkerboard until the raster pool and
+            // the main thread catch up.
+            IntRect holeRect = intersection(m_backingStore->tileRectForCoordinate(coordinate), rect);
+            TiledBackingStoreBackend::paintCheckerPattern(&context, FloatRect(holeRect));
+            fullyCovered = false;
+        }
+    }
+    return fullyCovered;
+}
+
+} // namespace WebCore
+
+#endif
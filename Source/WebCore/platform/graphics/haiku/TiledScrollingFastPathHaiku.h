@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#if USE(TILED_BACKING_STORE) && PLATFORM(HAIKU)
+
+#include "FloatSize.h"
+#include "IntRect.h"
+
+class BView;
+
+namespace WebCore {
+
+class GraphicsContext;
+class TiledBackingStore;
+
+// Scroll fast path: wheel deltas are applied here, on the delivering
+// thread, by blitting already-rasterized tiles from the prerendered margin
+// into the target view. Regions whose tiles have not arrived yet get the
+// checkerboard pattern; the main thread catches up asynchronously through
+// the normal coverage machinery, biased along the scroll trajectory.
+class TiledScrollingFastPathHaiku {
+public:
+    TiledScrollingFastPathHaiku(TiledBackingStore*, BView* target);
+
+    // Multiplier describing how far beyond the viewport tiles are kept
+    // prerendered (1.0 means no margin). Vertical margin is larger since
+    // pages overwhelmingly scroll vertically.
+    void setPrerenderMargin(float horizontal, float vertical);
+
+    // Returns true if the whole exposed area was served from prerendered
+    // tiles; false means some checkerboard was painted.
+    bool scrollBy(const FloatSize& delta);
+
+    const IntRect& visibleRect() const { return m_visibleRect; }
+    void setVisibleRect(const IntRect&);
+
+private:
+    bool paintTilesForRect(GraphicsContext&, const IntRect&);
+
+    TiledBackingStore* m_backingStore;
+    BView* m_target;
+    IntRect m_visibleRect;
+    float m_horizontalMargin { 1.0f };
+    float m_verticalMargin { 2.0f };
+};
+
+} // namespace WebCore
+
+#endif
@@ -30,9 +30,13 @@
 #include "CachedImage.h"
 #include "FontCascade.h"
 #include "Image.h"
+#include "NativeImage.h"
 
 #include "NotImplemented.h"
 
+#include <Bitmap.h>
+#include <View.h>
+
 
 namespace WebCore {
 
@@ -49,6 +53,107 @@ const float MaxDragLabelStringWidth = (MaxDragLabelWidth - 2 * DragLabelBorderX)
 const float DragLinkLabelFontsize = 11;
 const float DragLinkUrlFontSize = 10;
 
+IntSize dragImageSize(DragImageRef image)
+{
+    if (!image)
+        return { 0, 0 };
+
+    BRect bounds = image->Bounds();
+    return IntSize(bounds.IntegerWidth() + 1, bounds.IntegerHeight() + 1);
+}
+
+void deleteDragImage(DragImageRef image)
+{
+    delete image;
+}
+
+DragImageRef scaleDragImage(DragImageRef image, FloatSize scale)
+{
+    if (!image)
+        return nullptr;
+
+    IntSize imageSize = dragImageSize(image);
+    IntSize scaledSize(imageSize);
+    scaledSize.scale(scale.width(), scale.height());
+    if (imageSize == scaledSize || scaledSize.isEmpty())
+        return image;
+
+    BRect scaledBounds(0, 0, scaledSize.width() - 1, scaledSize.height() - 1);
+    BBitmap* scaled = new BBitmap(scaledBounds, B_RGBA32, true);
+    if (scaled->InitCheck() != B_OK) {
+        delete scaled;
+        return image;
+    }
+
+    BView* view = new BView(scaledBounds, "DragImageScale", 0, 0);
+    scaled->Lock();
+    scaled->AddChild(view);
+    view->SetDrawingMode(B_OP_COPY);
+    view->DrawBitmap(image, image->Bounds(), scaledBounds,
+        B_FILTER_BITMAP_BILINEAR);
+    view->Sync();
+    view->RemoveSelf();
+    scaled->Unlock();
+    delete view;
+
+    delete image;
+    return scaled;
+}
+
+DragImageRef dissolveDragImageToFraction(DragImageRef image, float fraction)
+{
+    if (!image)
+        return nullptr;
+
+    // The drag image owns its pixels (see createDragImageFromImage), so
+    // fade the alpha channel in place instead of recompositing through
+    // app_server.
+    uint8* bits = static_cast<uint8*>(image->Bits());
+    int32 length = image->BitsLength();
+    for (int32 i = 3; i < length; i += 4)
+        bits[i] = static_cast<uint8>(bits[i] * fraction);
+
+    return image;
+}
+
+DragImageRef createDragImageFromImage(Image* image, ImageOrientation)
+{
+    if (!image)
+        return nullptr;
+
+    // Hand out the frame the page already decoded for painting; letting
+    // the caller fall back to snapshotNode() would repaint the element
+    // synchronously on drag start.
+    RefPtr<NativeImage> nativeImage = image->currentNativeImage();
+    if (!nativeImage)
+        return nullptr;
+
+    const PlatformImagePtr& platformImage = nativeImage->platformImage();
+    if (!platformImage || !platformImage->IsValid())
+        return nullptr;
+
+    // Copy the pixels: the drag image gets scaled and faded by its owner,
+    // while the decoded frame stays in the image cache untouched.
+    BBitmap* copy = new BBitmap(*platformImage.get());
+    if (copy->InitCheck() != B_OK) {
+        delete copy;
+        return nullptr;
+    }
+    return copy;
+}
+
+DragImageRef createDragImageIconForCachedImageFilename(const String&)
+{
+    notImplemented();
+    return nullptr;
+}
+
+DragImageRef createDragImageForLink(Element&, URL&, const String&, TextIndicatorData&, float)
+{
+    notImplemented();
+    return nullptr;
+}
+
 DragImageRef createDragImageForColor(const Color&, const FloatRect&, float, Path&)
 {
     return nullptr;
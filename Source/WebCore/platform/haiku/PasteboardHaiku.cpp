@@ -184,9 +184,14 @@ void WebCore::Pasteboard::write(WebCore::PasteboardWebContent const& content)
     if (!data)
         return;
 
-    data->AddData("text/html", B_MIME_TYPE, content.markup.utf8().data(), content.markup.utf8().length());
+    // Convert each representation exactly once; the markup for a large
+    // selection can be many megabytes and re-encoding it just to take its
+    // length doubled the cost of a copy.
+    CString markup = content.markup.utf8();
+    data->AddData("text/html", B_MIME_TYPE, markup.data(), markup.length());
 
-    data->AddData("text/plain", B_MIME_TYPE, content.text.utf8().data(), content.text.utf8().length());
+    CString text = content.text.utf8();
+    data->AddData("text/plain", B_MIME_TYPE, text.data(), text.length());
 
     be_clipboard->Commit();
 }
@@ -354,13 +359,11 @@ String Pasteboard::readString(const String& type)
     if (be_clipboard->Lock()) {
         BMessage* data = be_clipboard->Data();
 
-        const char* buffer;
-        ssize_t bufferLength;
-        if (data) {
-            data->FindData(type.utf8().data(), B_MIME_TYPE, 
-                reinterpret_cast<const void**>(&buffer), &bufferLength);
-        }
-        result.SetTo(buffer, bufferLength);
+        const char* buffer = nullptr;
+        ssize_t bufferLength = 0;
+        if (data && data->FindData(type.utf8().data(), B_MIME_TYPE,
+                reinterpret_cast<const void**>(&buffer), &bufferLength) == B_OK)
+            result.SetTo(buffer, bufferLength);
 
         be_clipboard->Unlock();
     }
@@ -420,12 +423,30 @@ Vector<String> Pasteboard::typesSafeForBindings(const String&)
 
 void Pasteboard::writeCustomData(const WTF::Vector<PasteboardCustomData>& data)
 {
-	if (!data.isEmpty()) {
-		const auto& customData = data[0];
-		customData.forEachPlatformString([this] (auto& type, auto& string) {
-			writeString(type, string);
-		});
-	}
+	if (data.isEmpty())
+		return;
+
+	// Add all types under one lock and commit once; going through
+	// writeString() per type sent the whole clipboard message to the
+	// registrar again for every format.
+	AutoClipboardLocker locker(be_clipboard);
+	if (!locker.isLocked())
+		return;
+
+	BMessage* bdata = be_clipboard->Data();
+	if (!bdata)
+		return;
+
+	const auto& customData = data[0];
+	customData.forEachPlatformString([bdata] (auto& type, auto& string) {
+		CString typeUTF8 = type.utf8();
+		bdata->RemoveName(typeUTF8.data());
+
+		CString stringUTF8 = string.utf8();
+		bdata->AddData(typeUTF8.data(), B_MIME_TYPE,
+			stringUTF8.data(), stringUTF8.length());
+	});
+	be_clipboard->Commit();
 }
 
 void Pasteboard::read(WebCore::PasteboardFileReader&, std::optional<unsigned long>)
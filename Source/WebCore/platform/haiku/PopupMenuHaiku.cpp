@@ -41,36 +41,30 @@ namespace WebCore {
 
 static const uint32 kPopupResult = 'pmrs';
 static const uint32 kPopupHidden = 'pmhd';
+static const uint32 kPopupFill = 'pmfl';
+
+// Number of menu items materialized per pass. Huge <select> elements (ERP
+// style lists with thousands of options) are filled in chunks of this size
+// while the menu is already open, instead of stalling before it shows.
+static const int kPopupChunkSize = 256;
+
+class HaikuPopup;
 
 // This BHandler is added to the application (main) thread, so that we
 // invoke methods on the PopupMenuClient within the main thread.
 class PopupMenuHandler : public BHandler {
 public:
-    PopupMenuHandler(PopupMenuClient* popupClient)
+    PopupMenuHandler(PopupMenuClient* popupClient, HaikuPopup* popup)
         : m_popupClient(popupClient)
+        , m_popup(popup)
     {
     }
 
-    virtual void MessageReceived(BMessage* message)
-    {
-        switch (message->what) {
-        case kPopupResult: {
-            int32 index = 0;
-            message->FindInt32("index", &index);
-            m_popupClient->valueChanged(index);
-            break;
-        }
-        case kPopupHidden:
-            m_popupClient->popupDidHide();
-            break;
-
-        default:
-            BHandler::MessageReceived(message);
-        }
-    }
+    virtual void MessageReceived(BMessage* message);
 
 private:
     PopupMenuClient* m_popupClient;
+    HaikuPopup* m_popup;
 };
 
 class HaikuPopup : public BPopUpMenu {
@@ -78,7 +72,10 @@ public:
     HaikuPopup(PopupMenuClient* popupClient)
         : BPopUpMenu("WebCore Popup", true, false)
         , m_popupClient(popupClient)
-        , m_Handler(popupClient)
+        , m_Handler(popupClient, this)
+        , m_fillIndex(0)
+        , m_selectedIndex(-1)
+        , m_open(false)
     {
         if (be_app->Lock()) {
             be_app->AddHandler(&m_Handler);
@@ -101,25 +98,21 @@ public:
         for (int32 i = CountItems() - 1; i >= 0; i--)
             delete RemoveItem(i);
 
-        // Popuplate the menu from the client
+        // Populate the menu from the client. Only materialize enough items
+        // to open the menu with the selected one in place; the rest is
+        // appended chunk-wise while the menu is already on screen, so a
+        // 10000 entry <select> no longer stalls before showing anything.
+        // Everything up to the selection has to exist right away, since the
+        // item frames above it determine where the menu opens.
+        m_selectedIndex = index;
         int itemCount = m_popupClient->listSize();
-        for (int i = 0; i < itemCount; i++) {
-            if (m_popupClient->itemIsSeparator(i))
-                AddSeparatorItem();
-            else {
-                // NOTE: WebCore distinguishes between "Group" and "Label"
-                // here, but both types of item (radio or check mark) currently
-                // look the same on Haiku.
-                BString label(m_popupClient->itemText(i));
-                BMessage* message = new BMessage(kPopupResult);
-                message->AddInt32("index", i);
-                BMenuItem* item = new BMenuItem(label.String(), message);
-                AddItem(item);
-                item->SetTarget(BMessenger(&m_Handler));
-                item->SetEnabled(m_popupClient->itemIsEnabled(i));
-                item->SetMarked(i == index);
-            }
-        }
+        int end = std::min(std::max(index, 0) + kPopupChunkSize, itemCount);
+        for (m_fillIndex = 0; m_fillIndex < end; m_fillIndex++)
+            appendItem(m_fillIndex);
+
+        m_open = true;
+        if (m_fillIndex < itemCount)
+            be_app->PostMessage(kPopupFill, &m_Handler);
 
         // We need to force a layout now, or the item frames will not be
         // computed yet, so we cannot move the current item under the mouse.
@@ -143,17 +136,89 @@ public:
             Hide();
     }
 
+    void appendNextChunk()
+    {
+        if (!m_open)
+            return;
+
+        int itemCount = m_popupClient->listSize();
+        if (m_fillIndex >= itemCount)
+            return;
+
+        // The menu runs in its own window while open; lock it so appending
+        // does not race with the user scrolling through the items.
+        BWindow* window = Window();
+        if (window != NULL && !window->Lock())
+            return;
+
+        int end = std::min(m_fillIndex + kPopupChunkSize, itemCount);
+        for (; m_fillIndex < end; m_fillIndex++)
+            appendItem(m_fillIndex);
+
+        if (window != NULL) {
+            InvalidateLayout();
+            window->Unlock();
+        }
+
+        if (m_fillIndex < itemCount)
+            be_app->PostMessage(kPopupFill, &m_Handler);
+    }
+
 private:
+    void appendItem(int i)
+    {
+        if (m_popupClient->itemIsSeparator(i))
+            AddSeparatorItem();
+        else {
+            // NOTE: WebCore distinguishes between "Group" and "Label"
+            // here, but both types of item (radio or check mark) currently
+            // look the same on Haiku.
+            BString label(m_popupClient->itemText(i));
+            BMessage* message = new BMessage(kPopupResult);
+            message->AddInt32("index", i);
+            BMenuItem* item = new BMenuItem(label.String(), message);
+            AddItem(item);
+            item->SetTarget(BMessenger(&m_Handler));
+            item->SetEnabled(m_popupClient->itemIsEnabled(i));
+            item->SetMarked(i == m_selectedIndex);
+        }
+    }
+
     virtual void Hide()
     {
+        m_open = false;
         BPopUpMenu::Hide();
         be_app->PostMessage(kPopupHidden, &m_Handler);
     }
 
     PopupMenuClient* m_popupClient;
     PopupMenuHandler m_Handler;
+    int m_fillIndex;
+    int m_selectedIndex;
+    bool m_open;
 };
 
+void PopupMenuHandler::MessageReceived(BMessage* message)
+{
+    switch (message->what) {
+    case kPopupResult: {
+        int32 index = 0;
+        message->FindInt32("index", &index);
+        m_popupClient->valueChanged(index);
+        break;
+    }
+    case kPopupHidden:
+        m_popupClient->popupDidHide();
+        break;
+    case kPopupFill:
+        m_popup->appendNextChunk();
+        break;
+
+    default:
+        BHandler::MessageReceived(message);
+    }
+}
+
 PopupMenuHaiku::PopupMenuHaiku(PopupMenuClient* client)
     : m_popupClient(client)
     , m_menu(new HaikuPopup(client))
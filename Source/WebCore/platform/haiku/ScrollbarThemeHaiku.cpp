@@ -64,6 +64,31 @@ ScrollbarThemeHaiku::~ScrollbarThemeHaiku()
 {
 }
 
+bool ScrollbarThemeHaiku::usesOverlayScrollbars() const
+{
+    // Overlay scrollbars end up on their own composited layers (see
+    // RenderLayerCompositor::requiresHorizontalScrollbarLayer()), so thumb
+    // movement and fading no longer invalidate the page content below them.
+    // The fade animation is driven by ScrollbarsControllerGeneric.
+    return true;
+}
+
+bool ScrollbarThemeHaiku::paint(Scrollbar& scrollbar, GraphicsContext& context, const IntRect& damageRect)
+{
+    float opacity = usesOverlayScrollbars() ? scrollbar.opacity() : 1;
+    if (!opacity)
+        return true;
+
+    if (opacity < 1) {
+        context.beginTransparencyLayer(opacity);
+        ScrollbarThemeComposite::paint(scrollbar, context, damageRect);
+        context.endTransparencyLayer();
+        return true;
+    }
+
+    return ScrollbarThemeComposite::paint(scrollbar, context, damageRect);
+}
+
 int ScrollbarThemeHaiku::scrollbarThickness(ScrollbarWidth, ScrollbarExpansionState)
 {
     // FIXME: Should we make a distinction between a Small and a Regular Scrollbar?
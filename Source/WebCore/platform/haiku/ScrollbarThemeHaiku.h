@@ -37,6 +37,11 @@ public:
     ScrollbarThemeHaiku(bool drawOuterFrame);
     virtual ~ScrollbarThemeHaiku();
 
+    bool usesOverlayScrollbars() const override;
+    bool invalidateOnMouseEnterExit() override { return usesOverlayScrollbars(); }
+
+    bool paint(Scrollbar&, GraphicsContext&, const IntRect& damageRect) override;
+
     bool hasButtons(Scrollbar&) override;
     bool hasThumb(Scrollbar&) override;
 
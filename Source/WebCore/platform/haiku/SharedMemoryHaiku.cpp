@@ -51,14 +51,49 @@ RefPtr<SharedMemory> SharedMemory::allocate(size_t size)
         return memory;
 }
 
+static uint32 areaProtection(SharedMemory::Protection protection)
+{
+        switch (protection) {
+        case SharedMemory::Protection::ReadOnly:
+                return B_READ_AREA;
+        case SharedMemory::Protection::ReadWrite:
+                break;
+        }
+        return B_READ_AREA | B_WRITE_AREA;
+}
+
 RefPtr<SharedMemory> SharedMemory::map(Handle&& handle, Protection protection)
 {
-        RefPtr<SharedMemory> memory = adoptRef(new SharedMemory());
-        if(!memory)
+        // The handle carries the area_id of the creating team. area_ids are
+        // system-global, so cloning it gives us a mapping of the same
+        // physical pages in this team - the contents are never copied.
+        void* baseAddress;
+        area_id clonedArea = clone_area("WebKit-Shared-Memory", &baseAddress,
+                B_ANY_ADDRESS, areaProtection(protection), handle.m_handle);
+
+        if (clonedArea < 0)
                 return nullptr;
 
-        memory->m_areaid = handle.m_handle;
+        RefPtr<SharedMemory> memory = adoptRef(new SharedMemory());
         memory->m_size = handle.size();
+        memory->m_data = baseAddress;
+        memory->m_areaid = clonedArea;
+        return memory;
+}
+
+RefPtr<SharedMemory> SharedMemory::wrapMap(area_id area, size_t size, Protection protection)
+{
+        void* baseAddress;
+        area_id clonedArea = clone_area("WebKit-Shared-Memory", &baseAddress,
+                B_ANY_ADDRESS, areaProtection(protection), area);
+
+        if (clonedArea < 0)
+                return nullptr;
+
+        RefPtr<SharedMemory> memory = adoptRef(new SharedMemory());
+        memory->m_size = size;
+        memory->m_data = baseAddress;
+        memory->m_areaid = clonedArea;
         return memory;
 }
 
@@ -79,5 +114,5 @@ std::optional<SharedMemory::Handle> SharedMemory::createHandle(Protection)
         return SharedMemory::Handle(WTFMove(m_areaid), m_size);
 }
 
-} // namespace WebKit
+} // namespace WebCore
 
@@ -242,13 +242,21 @@ Seconds ScalableImageDecoder::frameDurationAtIndex(size_t index) const
     return duration;
 }
 
-PlatformImagePtr ScalableImageDecoder::createFrameImageAtIndex(size_t index, SubsamplingLevel, const DecodingOptions&)
+PlatformImagePtr ScalableImageDecoder::createFrameImageAtIndex(size_t index, SubsamplingLevel subsamplingLevel, const DecodingOptions&)
 {
     Locker locker { m_lock };
     // Zero-height images can cause problems for some ports. If we have an empty image dimension, just bail.
     if (size().isEmpty())
         return nullptr;
 
+    // When the caller asks for a different subsampling level than the cached
+    // frames were produced at, re-decode at the new scale (JPEG only; see
+    // supportsSubsampling()).
+    if (supportsSubsampling() && subsamplingLevel != m_subsamplingLevel) {
+        m_subsamplingLevel = subsamplingLevel;
+        subsamplingLevelChanged();
+    }
+
     auto* buffer = frameBufferAtIndex(index);
     if (!buffer || buffer->isInvalid() || !buffer->hasBackingStore())
         return nullptr;
@@ -106,11 +106,18 @@ public:
     // sizes. This does NOT differ from size() for GIF, since decoding GIFs
     // composites any smaller frames against previous frames to create full-
     // size frames.
-    IntSize frameSizeAtIndex(size_t, SubsamplingLevel) const override
+    IntSize frameSizeAtIndex(size_t, SubsamplingLevel subsamplingLevel) const override
     {
-        return size();
+        return scaledSize(subsamplingLevel);
     }
 
+    // Whether the codec can produce reduced-resolution frames directly,
+    // halving the output once per subsampling level. Currently only JPEG
+    // supports this, through libjpeg's DCT scaling.
+    virtual bool supportsSubsampling() const { return false; }
+
+    SubsamplingLevel subsamplingLevel() const { return m_subsamplingLevel; }
+
     // Returns whether the size is legal (i.e. not going to result in
     // overflow elsewhere). If not, marks decoding as failed.
     virtual bool setSize(const IntSize& size)
@@ -194,6 +201,25 @@ public:
     std::optional<IntPoint> hotSpot() const override { return std::nullopt; }
 
 protected:
+    // size() scaled down for the given subsampling level, rounding up like
+    // libjpeg does, or unchanged if this decoder cannot subsample.
+    IntSize scaledSize(SubsamplingLevel subsamplingLevel) const
+    {
+        if (subsamplingLevel == SubsamplingLevel::Default || !supportsSubsampling())
+            return size();
+        int divisor = 1 << static_cast<int>(subsamplingLevel);
+        IntSize size = this->size();
+        return IntSize((size.width() + divisor - 1) / divisor, (size.height() + divisor - 1) / divisor);
+    }
+
+    IntSize scaledSize() const { return scaledSize(m_subsamplingLevel); }
+
+    // Called with m_lock held when a frame is requested at a different
+    // subsampling level than the current one. Decoders that support
+    // subsampling must drop their decoded frames and restart decoding from
+    // the buffered data at the new scale.
+    virtual void subsamplingLevelChanged() { }
+
     RefPtr<const SharedBuffer> m_data;
     Vector<ScalableImageDecoderFrame, 1> m_frameBufferCache WTF_GUARDED_BY_LOCK(m_lock);
     mutable Lock m_lock;
@@ -201,6 +227,7 @@ protected:
     bool m_ignoreGammaAndColorProfile;
     ImageOrientation m_orientation;
     std::optional<IntSize> m_densityCorrectedSize;
+    SubsamplingLevel m_subsamplingLevel { SubsamplingLevel::Default };
 
 private:
     virtual void tryDecodeSize(bool) = 0;
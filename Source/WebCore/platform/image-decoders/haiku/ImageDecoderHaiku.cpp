@@ -27,51 +27,45 @@
 #include "config.h"
 #include "ImageBackingStore.h"
 #include "ImageDecoder.h"
+#include "PixelConversionsHaiku.h"
 
 #include <Bitmap.h>
 
 namespace WebCore {
 
+// Wraps a decoded frame into a BBitmap. Decoding itself is dispatched off
+// the main thread by ImageFrameWorkQueue (one queue per image source, so
+// separate images already decode in parallel); this conversion runs on that
+// queue as well and used to be the slow part, a scalar per-pixel divide.
 PlatformImagePtr ImageBackingStore::image() const
 {
-    int bytesPerRow = size().width() * sizeof(rgb_color);
-    RefPtr<BitmapRef> bitmap = adoptRef(new BitmapRef(BRect(0, 0, size().width() - 1, size().height() - 1), 0, B_RGBA32, bytesPerRow));
-    if (!bitmap || !bitmap->IsValid() || !m_pixelsPtr) {
+    if (!m_pixelsPtr)
         return nullptr;
-     }
+
+    // Progressive decoders (JPEG scans, WebP incremental rows) call this once
+    // per partial update. Reuse one BBitmap and rewrite its pixels, so the
+    // frame is upgraded in place rather than re-allocated per scan.
+    int bytesPerRow = size().width() * sizeof(rgb_color);
+    if (!m_image) {
+        m_image = adoptRef(new BitmapRef(BRect(0, 0, size().width() - 1, size().height() - 1), 0, B_RGBA32, bytesPerRow));
+        if (!m_image || !m_image->IsValid()) {
+            m_image = nullptr;
+            return nullptr;
+        }
+    }
 
     const uint8* source = reinterpret_cast<const uint8*>(m_pixelsPtr);
-    uint8* destination = reinterpret_cast<uint8*>(bitmap->Bits());
+    uint8* destination = reinterpret_cast<uint8*>(m_image->Bits());
     int h = size().height();
     int w = size().width();
     for (int y = 0; y < h; y++) {
-#if 0
-// FIXME: Enable this conversion once Haiku has B_RGBA32P[remultiplied]...
-        memcpy(dst, source, bytesPerRow);
-#else
-        const uint8* sourceHandle = source;
-        uint8* destinationHandle = destination;
-        for (int x = 0; x < w; x++) {
-            if (sourceHandle[3] == 255 || !sourceHandle[3]) {
-                destinationHandle[0] = sourceHandle[0];
-                destinationHandle[1] = sourceHandle[1];
-                destinationHandle[2] = sourceHandle[2];
-                destinationHandle[3] = sourceHandle[3];
-            } else {
-                destinationHandle[0] = static_cast<uint16>(sourceHandle[0]) * 255 / sourceHandle[3];
-                destinationHandle[1] = static_cast<uint16>(sourceHandle[1]) * 255 / sourceHandle[3];
-                destinationHandle[2] = static_cast<uint16>(sourceHandle[2]) * 255 / sourceHandle[3];
-                destinationHandle[3] = sourceHandle[3];
-            }
-            destinationHandle += 4;
-            sourceHandle += 4;
-        }
-#endif
+// FIXME: memcpy the whole frame once Haiku has B_RGBA32P[remultiplied]...
+        unpremultiplyPreservingByteOrder(source, destination, w);
         destination += bytesPerRow;
         source += bytesPerRow;
     }
 
-    return bitmap;
+    return m_image;
 }
 
 } // namespace WebCore
@@ -380,6 +380,13 @@ public:
             // image is a sequential JPEG.
             m_info.buffered_image = jpeg_has_multiple_scans(&m_info);
 
+            // Decode straight to the subsampled size when one was requested
+            // (thumbnails via createImageBitmap, images drawn scaled down):
+            // libjpeg then skips the corresponding share of the inverse DCT
+            // work instead of producing pixels we would throw away.
+            m_info.scale_num = 1;
+            m_info.scale_denom = 1 << static_cast<int>(m_decoder->subsamplingLevel());
+
             // Used to set up image size so arrays can be allocated.
             jpeg_calc_output_dimensions(&m_info);
 
@@ -568,6 +575,15 @@ ScalableImageDecoderFrame* JPEGImageDecoder::frameBufferAtIndex(size_t index)
     return &frame;
 }
 
+void JPEGImageDecoder::subsamplingLevelChanged()
+{
+    // The scale is fixed when the libjpeg decompressor reads the header, so
+    // drop the reader along with any decoded frame and restart decoding from
+    // the beginning of the buffered data.
+    m_frameBufferCache.clear();
+    clear();
+}
+
 void JPEGImageDecoder::clear()
 {
     m_reader = nullptr;
@@ -642,10 +658,13 @@ bool JPEGImageDecoder::outputScanlines()
     if (m_frameBufferCache.isEmpty())
         return false;
 
-    // Initialize the framebuffer if needed.
+    jpeg_decompress_struct* info = m_reader->info();
+
+    // Initialize the framebuffer if needed, at the (possibly subsampled)
+    // size libjpeg is actually producing.
     auto& buffer = m_frameBufferCache[0];
     if (buffer.isInvalid()) {
-        if (!buffer.initialize(size(), m_premultiplyAlpha))
+        if (!buffer.initialize(IntSize(info->output_width, info->output_height), m_premultiplyAlpha))
             return setFailed();
         buffer.setDecodingStatus(DecodingStatus::Partial);
         // The buffer is transparent outside the decoded area while the image is
@@ -653,8 +672,6 @@ bool JPEGImageDecoder::outputScanlines()
         buffer.setHasAlpha(true);
     }
 
-    jpeg_decompress_struct* info = m_reader->info();
-
 #if defined(TURBO_JPEG_RGB_SWIZZLE)
     if (turboSwizzled(info->out_color_space)) {
         while (info->output_scanline < info->output_height) {
@@ -58,6 +58,7 @@ namespace WebCore {
         // ScalableImageDecoder
         String filenameExtension() const override { return "jpg"_s; }
         ScalableImageDecoderFrame* frameBufferAtIndex(size_t index) override;
+        bool supportsSubsampling() const override { return true; }
         // CAUTION: setFailed() deletes |m_reader|.  Be careful to avoid
         // accessing deleted memory, especially when calling this from inside
         // JPEGImageReader!
@@ -86,6 +87,8 @@ namespace WebCore {
         template <J_COLOR_SPACE colorSpace, bool isScaled>
         bool outputScanlines(ScalableImageDecoderFrame& buffer);
 
+        void subsamplingLevelChanged() override;
+
         void clear();
 
         std::unique_ptr<JPEGImageReader> m_reader;
@@ -26,7 +26,7 @@
 
 #include "config.h"
 
-#if USE(CURL)
+#if USE(CURL) || PLATFORM(HAIKU)
 
 #include "CurlCacheManager.h"
 
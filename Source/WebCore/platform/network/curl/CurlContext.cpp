@@ -530,7 +530,10 @@ void CurlHandle::setHttpCustomRequest(const String& method)
 
 void CurlHandle::enableAcceptEncoding()
 {
-    // enable all supported built-in compressions (gzip and deflate) through Accept-Encoding:
+    // The empty string advertises every encoding this libcurl build
+    // supports (gzip and deflate always; also br and zstd when built
+    // against brotli/zstd) and lets curl decode the response in flight
+    // on its transfer thread.
     curl_easy_setopt(m_handle, CURLOPT_ACCEPT_ENCODING, "");
 }
 
@@ -21,11 +21,14 @@
 #include "config.h"
 #include "BUrlProtocolHandler.h"
 
+#include "BUrlRequestPool.h"
+#include "CurlCacheManager.h"
 #include "FormData.h"
 #include "HTTPParsers.h"
 #include "ImageData.h"
 #include "MIMETypeRegistry.h"
 #include "NetworkStorageSession.h"
+#include "NetworkWaterfall.h"
 #include "ProtectionSpace.h"
 #include "ResourceHandle.h"
 #include "ResourceHandleClient.h"
@@ -36,11 +39,17 @@
 #include "SharedBuffer.h"
 
 #include <wtf/CompletionHandler.h>
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
 #include <wtf/text/CString.h>
+#include <wtf/text/MakeString.h>
 
 #include <Autolock.h>
 #include <Debug.h>
+#include <Directory.h>
 #include <File.h>
+#include <FindDirectory.h>
+#include <Path.h>
 #include <Url.h>
 #include <UrlRequest.h>
 #include <HttpRequest.h>
@@ -51,6 +60,86 @@ static const int gMaxRecursionLimit = 10;
 
 namespace WebCore {
 
+// Fixed-size buffer backing a SharedBuffer segment, recycled through a
+// freelist. Received bytes are copied off the kit's transient buffer once,
+// straight into the segment the loader sees; streaming a large response
+// then churns through a bounded set of buffers instead of allocating a
+// fresh one per chunk.
+class NetworkChunkBuffer : public ThreadSafeRefCounted<NetworkChunkBuffer> {
+public:
+    static constexpr size_t chunkCapacity = 64 * 1024;
+
+    static Ref<NetworkChunkBuffer> take()
+    {
+        {
+            Locker locker { freeListLock };
+            if (!freeList().isEmpty())
+                return adoptRef(*new NetworkChunkBuffer(freeList().takeLast()));
+        }
+        return adoptRef(*new NetworkChunkBuffer(Vector<uint8_t>(chunkCapacity)));
+    }
+
+    ~NetworkChunkBuffer()
+    {
+        // The segment is done with us (the last SharedBuffer referencing it
+        // went away); hand the allocation to the next network chunk.
+        Locker locker { freeListLock };
+        if (freeList().size() < maxFreeBuffers)
+            freeList().append(WTFMove(m_buffer));
+    }
+
+    size_t fill(const uint8_t* data, size_t size)
+    {
+        m_size = std::min(size, chunkCapacity);
+        memcpy(m_buffer.data(), data, m_size);
+        return m_size;
+    }
+
+    const uint8_t* data() const { return m_buffer.data(); }
+    size_t size() const { return m_size; }
+
+private:
+    explicit NetworkChunkBuffer(Vector<uint8_t>&& buffer)
+        : m_buffer(WTFMove(buffer))
+    {
+    }
+
+    // Bounds idle pool memory to one megabyte.
+    static constexpr size_t maxFreeBuffers = 16;
+    static Lock freeListLock;
+    static Vector<Vector<uint8_t>>& freeList()
+    {
+        static NeverDestroyed<Vector<Vector<uint8_t>>> list;
+        return list;
+    }
+
+    Vector<uint8_t> m_buffer;
+    size_t m_size { 0 };
+};
+
+Lock NetworkChunkBuffer::freeListLock;
+
+// Shared with the curl backend: index + per-entry header/content files,
+// keyed by URL, revalidated through If-Modified-Since/If-None-Match. Lazily
+// pointed at the user cache directory on first use.
+static CurlCacheManager& diskCache()
+{
+    static bool initialized = false;
+    if (!initialized) {
+        initialized = true;
+
+        BPath path;
+        if (find_directory(B_USER_CACHE_DIRECTORY, &path) == B_OK
+            && path.Append("WebKit/NetworkCache") == B_OK) {
+            create_directory(path.Path(), 0755);
+            // The manager expects a trailing separator on the directory.
+            CurlCacheManager::singleton().setCacheDirectory(
+                makeString(String::fromUTF8(path.Path()), '/'));
+        }
+    }
+    return CurlCacheManager::singleton();
+}
+
 static bool shouldRedirectAsGET(const ResourceRequest& request, int statusCode, bool crossOrigin)
 {
     if (request.httpMethod() == ASCIILiteral::fromLiteralUnsafe("GET") || request.httpMethod() == ASCIILiteral::fromLiteralUnsafe("HEAD"))
@@ -76,6 +165,8 @@ RefPtr<BUrlRequestWrapper> BUrlRequestWrapper::create(BUrlProtocolHandler* handl
 BUrlRequestWrapper::BUrlRequestWrapper(BUrlProtocolHandler* handler, NetworkStorageSession* storageSession, ResourceRequest& request)
     : BUrlProtocolAsynchronousListener(true)
     , m_handler(handler)
+    , m_loadPriority(request.priority())
+    , m_isConditional(request.isConditional())
     , m_receiveMutex("http data locker")
 {
     ASSERT(isMainThread());
@@ -112,23 +203,45 @@ BUrlRequestWrapper::BUrlRequestWrapper(BUrlProtocolHandler* handler, NetworkStor
         return;
     }
 
+    // Block the receiving thread until headers are parsed.
+    m_receiveMutex.Lock();
+
+    m_fetchStart = MonotonicTime::now();
+
+    // The pool runs the request right away if the origin has a free
+    // connection slot, and queues it behind the in-flight ones otherwise,
+    // so completed requests hand their keep-alive connection to the next
+    // resource instead of racing it with a fresh TCP + TLS setup.
+    BUrlRequestPool::shared().schedule(*this);
+}
+
+bool BUrlRequestWrapper::startFromPool()
+{
+    ASSERT(isMainThread());
+
+    if (!m_handler)
+        return false;
+
     // Keep self alive while BUrlRequest is running as we hold
     // the main dispatcher.
     ref();
 
-    // Block the receiving thread until headers are parsed.
-    m_receiveMutex.Lock();
+    // The gap between m_fetchStart and this mark is time spent queued in
+    // the pool behind the origin's in-flight requests.
+    m_requestStart = MonotonicTime::now();
 
     if (m_request->Run() < B_OK) {
         deref();
 
         ResourceError error(ASCIILiteral::fromLiteralUnsafe("BUrlProtocol"), 42,
-            request.url(),
+            URL(m_request->Url()),
             ASCIILiteral::fromLiteralUnsafe("The service kit failed to start the request."));
         m_handler->didFail(error);
 
-        return;
+        return false;
     }
+
+    return true;
 }
 
 BUrlRequestWrapper::~BUrlRequestWrapper()
@@ -152,14 +265,36 @@ void BUrlRequestWrapper::abort()
     // become aware of the state change.
     m_receiveMutex.Unlock();
 
-    if (m_request)
+    if (m_request) {
+        // Give the connection slot back (or drop out of the pool queue if
+        // we never started). The extra notification from RequestCompleted
+        // after Stop() is a no-op.
+        BUrlRequestPool::shared().requestFinished(*this);
         m_request->Stop();
+    }
+}
+
+void BUrlRequestWrapper::HostnameResolved(BPrivate::Network::BUrlRequest*, const char* ip)
+{
+    ASSERT(isMainThread());
+
+    m_domainLookupEnd = MonotonicTime::now();
+    m_remoteAddress = String::fromUTF8(ip);
+}
+
+void BUrlRequestWrapper::ConnectionOpened(BPrivate::Network::BUrlRequest*)
+{
+    ASSERT(isMainThread());
+
+    m_connectEnd = MonotonicTime::now();
 }
 
 void BUrlRequestWrapper::HeadersReceived(BPrivate::Network::BUrlRequest* caller)
 {
     ASSERT(isMainThread());
 
+    m_responseStart = MonotonicTime::now();
+
     if (!m_handler)
         return;
 
@@ -178,13 +313,18 @@ void BUrlRequestWrapper::HeadersReceived(BPrivate::Network::BUrlRequest* caller)
         if (!suggestedFilename.isEmpty())
             response.setSuggestedFilename(suggestedFilename.toString());
 
+        m_httpStatusCode = httpResult->StatusCode();
         response.setHTTPStatusCode(httpResult->StatusCode());
         response.setHTTPStatusText(AtomString::fromUTF8(httpResult->StatusText().String()));
 
         // Add remaining headers.
         const BPrivate::Network::BHttpHeaders& resultHeaders = httpResult->Headers();
+        m_responseHeaderBytes = 0;
         for (int i = 0; i < resultHeaders.CountHeaders(); i++) {
             BPrivate::Network::BHttpHeader& headerPair = resultHeaders.HeaderAt(i);
+            // "Name: Value\r\n"; close enough for the inspector's header
+            // size figure, which the kit does not report directly.
+            m_responseHeaderBytes += strlen(headerPair.Name()) + strlen(headerPair.Value()) + 4;
             response.setHTTPHeaderField(String::fromUTF8(headerPair.Name()), String::fromUTF8(headerPair.Value()));
         }
 
@@ -206,6 +346,15 @@ void BUrlRequestWrapper::HeadersReceived(BPrivate::Network::BUrlRequest* caller)
     }
 }
 
+void BUrlRequestWrapper::DownloadProgress(BPrivate::Network::BUrlRequest*, off_t bytesReceived, off_t)
+{
+    ASSERT(isMainThread());
+
+    // The kit reports the raw body bytes taken off the socket, before
+    // dechunking and decompression; Write() sees the decoded stream.
+    m_bytesOnWire = bytesReceived;
+}
+
 void BUrlRequestWrapper::UploadProgress(BPrivate::Network::BUrlRequest*, off_t bytesSent, off_t bytesTotal)
 {
     ASSERT(isMainThread());
@@ -216,6 +365,49 @@ void BUrlRequestWrapper::UploadProgress(BPrivate::Network::BUrlRequest*, off_t b
     m_handler->didSendData(bytesSent, bytesTotal);
 }
 
+NetworkLoadMetrics BUrlRequestWrapper::networkLoadMetrics() const
+{
+    NetworkLoadMetrics metrics;
+
+    metrics.fetchStart = m_fetchStart;
+    metrics.domainLookupStart = m_requestStart;
+    // A request riding a kept-alive connection resolves nothing and
+    // connects nowhere; collapse the skipped phases to zero-length
+    // intervals so the waterfall stays monotonic.
+    metrics.domainLookupEnd = m_domainLookupEnd ? m_domainLookupEnd : metrics.domainLookupStart;
+    metrics.connectStart = metrics.domainLookupEnd;
+    metrics.connectEnd = m_connectEnd ? m_connectEnd : metrics.connectStart;
+    metrics.requestStart = metrics.connectEnd;
+    metrics.responseStart = m_responseStart ? m_responseStart : metrics.requestStart;
+    metrics.responseEnd = MonotonicTime::now();
+
+    metrics.protocol = ASCIILiteral::fromLiteralUnsafe("http/1.1");
+    metrics.isReusedConnection = !m_connectEnd;
+    metrics.responseBodyBytesReceived = m_bytesOnWire ? m_bytesOnWire : m_bytesDecoded;
+    metrics.responseBodyDecodedSize = m_bytesDecoded;
+    metrics.markComplete();
+
+    auto additionalMetrics = AdditionalNetworkLoadMetricsForWebInspector::create();
+    switch (m_loadPriority) {
+    case ResourceLoadPriority::VeryLow:
+    case ResourceLoadPriority::Low:
+        additionalMetrics->priority = NetworkLoadPriority::Low;
+        break;
+    case ResourceLoadPriority::Medium:
+        additionalMetrics->priority = NetworkLoadPriority::Medium;
+        break;
+    case ResourceLoadPriority::High:
+    case ResourceLoadPriority::VeryHigh:
+        additionalMetrics->priority = NetworkLoadPriority::High;
+        break;
+    }
+    additionalMetrics->remoteAddress = m_remoteAddress;
+    additionalMetrics->responseHeaderBytesReceived = m_responseHeaderBytes;
+    metrics.additionalNetworkLoadMetricsForWebInspector = WTFMove(additionalMetrics);
+
+    return metrics;
+}
+
 void BUrlRequestWrapper::RequestCompleted(BPrivate::Network::BUrlRequest* caller, bool success)
 {
     ASSERT(isMainThread());
@@ -227,13 +419,34 @@ void BUrlRequestWrapper::RequestCompleted(BPrivate::Network::BUrlRequest* caller
     // release itself after completion.
     auto releaseThis = adoptRef(*this);
 
+    // Hand our connection slot to the next request queued for this origin.
+    BUrlRequestPool::shared().requestFinished(*this);
+
     if (!m_handler)
         return;
 
     BPrivate::Network::BHttpRequest* httpRequest = dynamic_cast<BPrivate::Network::BHttpRequest*>(m_request);
+    bool treatAsSuccess = success || (httpRequest && m_didReceiveData);
+
+    if (NetworkWaterfall::isEnabled()) {
+        NetworkWaterfall::Entry entry;
+        entry.url = String::fromUTF8(caller->Url().UrlString().String());
+        entry.httpStatusCode = m_httpStatusCode;
+        entry.failed = !treatAsSuccess;
+        entry.conditional = m_isConditional;
+        entry.fetchStart = m_fetchStart;
+        entry.domainLookupStart = m_requestStart;
+        entry.domainLookupEnd = m_domainLookupEnd;
+        entry.connectEnd = m_connectEnd;
+        entry.responseStart = m_responseStart;
+        entry.responseEnd = MonotonicTime::now();
+        entry.bytesOnWire = m_bytesOnWire;
+        entry.bytesDecoded = m_bytesDecoded;
+        NetworkWaterfall::record(WTFMove(entry));
+    }
 
-    if (success || (httpRequest && m_didReceiveData)) {
-        m_handler->didFinishLoading();
+    if (treatAsSuccess) {
+        m_handler->didFinishLoading(networkLoadMetrics());
         return;
     } else if (httpRequest) {
         const BPrivate::Network::BHttpResult& result = static_cast<const BPrivate::Network::BHttpResult&>(httpRequest->Result());
@@ -274,13 +487,28 @@ ssize_t BUrlRequestWrapper::Write(const void* data, size_t size)
 
     if (size > 0) {
         m_didReceiveData = true;
-
-        auto buffer = SharedBuffer::create(reinterpret_cast<const char*>(data), size);
-
-        callOnMainThread([this, protectedThis = Ref{*this}, buffer = WTFMove(buffer)]() mutable {
-            if (m_handler)
-                m_handler->didReceiveBuffer(WTFMove(buffer));
-        });
+        m_bytesDecoded += size;
+
+        const uint8_t* remaining = reinterpret_cast<const uint8_t*>(data);
+        size_t remainingSize = size;
+        while (remainingSize > 0) {
+            RefPtr<NetworkChunkBuffer> chunk = NetworkChunkBuffer::take();
+            size_t copied = chunk->fill(remaining, remainingSize);
+            remaining += copied;
+            remainingSize -= copied;
+
+            // The segment references the pooled buffer directly; it returns
+            // to the freelist when the loader drops the last reference.
+            auto buffer = SharedBuffer::create(DataSegment::Provider {
+                [chunk] { return chunk->data(); },
+                [chunk] { return chunk->size(); }
+            });
+
+            callOnMainThread([this, protectedThis = Ref{*this}, buffer = WTFMove(buffer)]() mutable {
+                if (m_handler)
+                    m_handler->didReceiveBuffer(WTFMove(buffer));
+            });
+        }
     }
 
     return size;
@@ -294,6 +522,7 @@ BUrlProtocolHandler::BUrlProtocolHandler(ResourceHandle* handle)
         return;
 
     m_resourceRequest = m_resourceHandle->firstRequest();
+    addCacheValidationHeaders(m_resourceRequest);
     m_request = BUrlRequestWrapper::create(this,
         m_resourceHandle->context()->storageSession(),
         m_resourceRequest);
@@ -314,10 +543,38 @@ void BUrlProtocolHandler::abort()
     m_resourceHandle = nullptr;
 }
 
+void BUrlProtocolHandler::addCacheValidationHeaders(ResourceRequest& request)
+{
+    ASSERT(isMainThread());
+
+    ResourceHandleInternal* d = m_resourceHandle->getInternal();
+    d->m_addedCacheValidationHeaders = false;
+
+    bool hasCacheHeaders = request.httpHeaderFields().contains(HTTPHeaderName::IfModifiedSince)
+        || request.httpHeaderFields().contains(HTTPHeaderName::IfNoneMatch);
+    if (hasCacheHeaders)
+        return;
+
+    auto& cache = diskCache();
+    URL cacheUrl = request.url();
+    cacheUrl.removeFragmentIdentifier();
+
+    if (cache.isCached(cacheUrl.string())) {
+        cache.addCacheEntryClient(cacheUrl.string(), m_resourceHandle);
+
+        for (const auto& entry : cache.requestHeaders(cacheUrl.string()))
+            request.addHTTPHeaderField(entry.key, entry.value);
+
+        d->m_addedCacheValidationHeaders = true;
+    }
+}
+
 void BUrlProtocolHandler::didFail(const ResourceError& error)
 {
     ASSERT(isMainThread());
 
+    diskCache().didFail(*m_resourceHandle);
+
     ResourceHandleClient* client = m_resourceHandle->client();
     if (!client)
         return;
@@ -468,6 +725,23 @@ void BUrlProtocolHandler::didReceiveResponse(ResourceResponse&& response)
     // didReceiveResponse would crash. Keep a reference to it so it can be
     // deleted cleanly after the function returns.
     auto protectedHandle = Ref{*m_resourceHandle};
+
+    if (response.isNotModified()) {
+        URL cacheUrl = response.url();
+        cacheUrl.removeFragmentIdentifier();
+
+        // Serve the body from the disk cache; if the validation headers
+        // were ours rather than the page's, hide the revalidation and
+        // report a plain 200.
+        if (diskCache().getCachedResponse(cacheUrl.string(), response)) {
+            if (m_resourceHandle->getInternal()->m_addedCacheValidationHeaders) {
+                response.setHTTPStatusCode(200);
+                response.setHTTPStatusText(AtomString::fromUTF8("OK"));
+            }
+        }
+    }
+
+    diskCache().didReceiveResponse(*m_resourceHandle, response);
     protectedHandle->didReceiveResponse(WTFMove(response), [this/*, protectedThis = Ref{*this}*/] {
         //continueAfterDidReceiveResponse();
     });
@@ -480,6 +754,8 @@ void BUrlProtocolHandler::didReceiveBuffer(Ref<SharedBuffer>&& buffer)
     if (!m_resourceHandle || !m_resourceHandle->client())
         return;
 
+    diskCache().didReceiveData(*m_resourceHandle, buffer);
+
     m_resourceHandle->client()->didReceiveBuffer(m_resourceHandle, WTFMove(buffer), buffer->size());
 }
 
@@ -493,14 +769,15 @@ void BUrlProtocolHandler::didSendData(ssize_t bytesSent, ssize_t bytesTotal)
     m_resourceHandle->client()->didSendData(m_resourceHandle, bytesSent, bytesTotal);
 }
 
-void BUrlProtocolHandler::didFinishLoading()
+void BUrlProtocolHandler::didFinishLoading(const NetworkLoadMetrics& metrics)
 {
     ASSERT(isMainThread());
 
     if (!m_resourceHandle || !m_resourceHandle->client())
         return;
 
-    const WebCore::NetworkLoadMetrics metrics;
+    diskCache().didFinishLoading(*m_resourceHandle);
+
     m_resourceHandle->client()->didFinishLoading(m_resourceHandle, metrics);
 }
 
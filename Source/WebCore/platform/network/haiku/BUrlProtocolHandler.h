@@ -20,6 +20,7 @@
 #define BURLPROTOCOLHANDLER_H
 
 #include "HaikuFormDataStream.h"
+#include "NetworkLoadMetrics.h"
 #include "ResourceRequest.h"
 #include "ResourceError.h"
 
@@ -27,6 +28,7 @@
 #include <Messenger.h>
 #include <private/netservices/HttpRequest.h>
 #include <UrlProtocolAsynchronousListener.h>
+#include <wtf/MonotonicTime.h>
 
 class BFile;
 
@@ -49,8 +51,21 @@ public:
 
     bool isValid() const { return m_request; };
 
+    const BUrl& url() const { return m_request->Url(); }
+
+    // Used by BUrlRequestPool to order queued requests; sampled from the
+    // ResourceRequest when the wrapper is created.
+    ResourceLoadPriority loadPriority() const { return m_loadPriority; }
+
+    // Called by BUrlRequestPool once an origin slot is available. Returns
+    // false if the services kit failed to start the request.
+    bool startFromPool();
+
     // BUrlProtocolListener hooks
+    void HostnameResolved(BPrivate::Network::BUrlRequest* caller, const char* ip) override;
+    void ConnectionOpened(BPrivate::Network::BUrlRequest* caller) override;
     void HeadersReceived(BPrivate::Network::BUrlRequest* caller) override;
+    void DownloadProgress(BPrivate::Network::BUrlRequest* caller, off_t bytesReceived, off_t bytesTotal) override;
     void UploadProgress(BPrivate::Network::BUrlRequest* caller, off_t bytesSent, off_t bytesTotal) override;
     void RequestCompleted(BPrivate::Network::BUrlRequest* caller, bool success) override;
     bool CertificateVerificationFailed(BPrivate::Network::BUrlRequest* caller, BCertificate&, const char* message) override;
@@ -61,12 +76,44 @@ public:
 private:
     BUrlRequestWrapper(BUrlProtocolHandler*, NetworkStorageSession*, ResourceRequest&);
 
+private:
+    NetworkLoadMetrics networkLoadMetrics() const;
+
 private:
     BUrlProtocolHandler* m_handler { nullptr };
     BPrivate::Network::BUrlRequest* m_request { nullptr };
 
+    ResourceLoadPriority m_loadPriority { ResourceLoadPriority::Medium };
+
     bool m_didReceiveData { false };
 
+    // Whether the outgoing request carried cache validators
+    // (If-None-Match / If-Modified-Since); together with the status code
+    // this classifies the request as a revalidation hit (304) or miss.
+    bool m_isConditional { false };
+
+    // Request lifecycle phase marks, captured as the kit's progress
+    // notifications arrive on the main thread (delivery through the
+    // asynchronous listener adds sub-millisecond skew). A phase the
+    // request skips — e.g. hostname resolution and connect on a reused
+    // keep-alive connection — keeps its mark at zero. The TLS handshake
+    // happens inside the kit's Connect() and has no hook of its own, so
+    // it is part of the connect phase here.
+    MonotonicTime m_fetchStart;
+    MonotonicTime m_requestStart;
+    MonotonicTime m_domainLookupEnd;
+    MonotonicTime m_connectEnd;
+    MonotonicTime m_responseStart;
+
+    String m_remoteAddress;
+    int m_httpStatusCode { 0 };
+    uint64_t m_responseHeaderBytes { 0 };
+    // Body bytes as received from the socket vs. after dechunking and
+    // decompression; the latter is counted under m_receiveMutex in
+    // Write() on the receive thread.
+    uint64_t m_bytesOnWire { 0 };
+    uint64_t m_bytesDecoded { 0 };
+
     // This lock is in charge of two things:
     // - Whether data can be received.
     // - Synchronizing cancellation via m_handler.
@@ -83,6 +130,7 @@ public:
     bool isValid() const { return m_request && m_request->isValid(); }
 
 private:
+    void addCacheValidationHeaders(ResourceRequest& request);
     void didFail(const ResourceError& error);
     void willSendRequest(const ResourceResponse& response);
     void continueAfterWillSendRequest(ResourceRequest&& request);
@@ -90,7 +138,7 @@ private:
     void didReceiveResponse(ResourceResponse&& response);
     void didReceiveBuffer(Ref<SharedBuffer>&&);
     void didSendData(ssize_t bytesSent, ssize_t bytesTotal);
-    void didFinishLoading();
+    void didFinishLoading(const NetworkLoadMetrics&);
     bool didReceiveInvalidCertificate(BCertificate&, const char* message);
 
 private:
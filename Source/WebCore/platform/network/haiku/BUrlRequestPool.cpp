@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE COMPUTER, INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE COMPUTER, INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "config.h"
+#include "BUrlRequestPool.h"
+
+#include "BUrlProtocolHandler.h"
+
+#include <Url.h>
+#include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/text/MakeString.h>
+
+namespace WebCore {
+
+// Matches the per-host connection limit browsers conventionally use.
+static const unsigned gMaxRequestsPerOrigin = 6;
+static const unsigned gMaxTotalRequests = 32;
+
+// Slots only High and VeryHigh priority requests may take. Dispatch order
+// alone does not protect render-blocking work: a burst of subframe images
+// can occupy every slot for the whole length of the transfers, and a
+// stylesheet arriving a moment later would wait for one to finish. With
+// the reserve, lower priorities saturate at most the unreserved portion.
+static const unsigned gReservedHighPrioritySlots = 8;
+
+static String poolOriginForUrl(const BUrl& url)
+{
+    return makeString(String::fromUTF8(url.Protocol().String()), "://"_s,
+        String::fromUTF8(url.Host().String()), ':', url.Port());
+}
+
+BUrlRequestPool& BUrlRequestPool::shared()
+{
+    static NeverDestroyed<BUrlRequestPool> pool;
+    return pool;
+}
+
+void BUrlRequestPool::schedule(BUrlRequestWrapper& wrapper)
+{
+    ASSERT(isMainThread());
+
+    m_pendingRequests[static_cast<unsigned>(wrapper.loadPriority())].append(
+        { &wrapper, poolOriginForUrl(wrapper.url()) });
+    startQueuedRequests();
+}
+
+void BUrlRequestPool::requestFinished(BUrlRequestWrapper& wrapper)
+{
+    ASSERT(isMainThread());
+
+    String origin = m_activeRequests.take(&wrapper);
+    if (origin.isNull()) {
+        // Never started: still queued (or already released, since Stop()
+        // reports completion a second time after an abort).
+        for (auto& queue : m_pendingRequests) {
+            queue.removeAllMatching([&wrapper](const PendingRequest& pending) {
+                return pending.wrapper == &wrapper;
+            });
+        }
+        return;
+    }
+
+    auto it = m_activePerOrigin.find(origin);
+    ASSERT(it != m_activePerOrigin.end());
+    if (!--it->value)
+        m_activePerOrigin.remove(it);
+
+    startQueuedRequests();
+}
+
+void BUrlRequestPool::startQueuedRequests()
+{
+    // Drain the highest-priority queue first so render-blocking resources
+    // always get the next free slot ahead of images and prefetches.
+    for (unsigned priority = resourceLoadPriorityCount; priority-- > 0;) {
+        auto& queue = m_pendingRequests[priority];
+        Deque<PendingRequest> blocked;
+
+        unsigned totalLimit = priority >= static_cast<unsigned>(ResourceLoadPriority::High)
+            ? gMaxTotalRequests
+            : gMaxTotalRequests - gReservedHighPrioritySlots;
+
+        while (!queue.isEmpty()
+            && m_activeRequests.size() < totalLimit) {
+            PendingRequest pending = queue.takeFirst();
+
+            auto result = m_activePerOrigin.add(pending.origin, 0);
+            if (result.iterator->value >= gMaxRequestsPerOrigin) {
+                // This origin is saturated; try requests for other origins.
+                blocked.append(WTFMove(pending));
+                continue;
+            }
+            result.iterator->value++;
+
+            m_activeRequests.add(pending.wrapper, pending.origin);
+            if (!pending.wrapper->startFromPool()) {
+                // Run() failed synchronously; give the slot back right away.
+                requestFinished(*pending.wrapper);
+            }
+        }
+
+        // Keep the blocked requests in arrival order at the front of their
+        // queue.
+        while (!blocked.isEmpty())
+            queue.prepend(blocked.takeLast());
+
+        if (m_activeRequests.size() >= gMaxTotalRequests)
+            break;
+    }
+}
+
+}
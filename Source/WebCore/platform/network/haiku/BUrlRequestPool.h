@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE COMPUTER, INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE COMPUTER, INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef BURLREQUESTPOOL_H
+#define BURLREQUESTPOOL_H
+
+#include "ResourceLoadPriority.h"
+
+#include <wtf/Deque.h>
+#include <wtf/HashMap.h>
+#include <wtf/text/StringHash.h>
+#include <wtf/text/WTFString.h>
+
+namespace WebCore {
+
+class BUrlRequestWrapper;
+
+// The services kit gives every BUrlRequest its own thread and socket, so a
+// page with dozens of subresources would open (and TLS-handshake) one
+// connection per resource. This pool caps how many requests run against a
+// given origin at once and queues the rest; a finishing request hands its
+// slot to the next queued one for that origin, which then rides the kit's
+// keep-alive connection instead of opening a fresh one. The curl backend
+// gets the equivalent behavior (plus HTTP/2 stream multiplexing) from
+// CurlRequestScheduler and the shared multi handle.
+//
+// Queued requests are dispatched by ResourceLoadPriority, highest first,
+// so a burst of image loads can no longer starve the render-blocking
+// stylesheets and scripts queued behind them; within one priority level
+// dispatch stays in arrival order. The priority is sampled when the
+// request is scheduled (there is no re-prioritization path down to
+// ResourceHandle in this port).
+//
+// Everything here runs on the main thread, where the wrapper lifecycle
+// already lives, so no locking is needed.
+class BUrlRequestPool {
+public:
+    static BUrlRequestPool& shared();
+
+    void schedule(BUrlRequestWrapper&);
+
+    // Called both on completion and on cancellation; releases the origin
+    // slot (or drops the request from the queue) and starts queued work.
+    void requestFinished(BUrlRequestWrapper&);
+
+private:
+    BUrlRequestPool() = default;
+
+    void startQueuedRequests();
+
+    struct PendingRequest {
+        BUrlRequestWrapper* wrapper;
+        String origin;
+    };
+
+    // One queue per priority level, indexed by ResourceLoadPriority.
+    Deque<PendingRequest> m_pendingRequests[resourceLoadPriorityCount];
+    HashMap<BUrlRequestWrapper*, String> m_activeRequests;
+    HashMap<String, unsigned> m_activePerOrigin;
+};
+
+}
+
+#endif // BURLREQUESTPOOL_H
@@ -28,6 +28,14 @@
 
 namespace WebCore {
 
+// TLS session resumption: the curl backend already reuses sessions across
+// requests because CurlShareHandle shares CURL_LOCK_DATA_SSL_SESSION between
+// easy handles (see CurlContext.cpp), so repeat connections to the same host
+// skip the full handshake. Persisting sessions across runs is not exposed by
+// libcurl. The services-kit backend (BUrlProtocolHandler) cannot be configured
+// here at all: BSecureSocket owns its SSL context internally and offers no
+// session cache hook, so the per-origin pooling in BUrlRequestPool is the only
+// handshake mitigation available on that side.
 void CurlSSLHandle::platformInitialize()
 {
 #if 0
@@ -1,5 +1,6 @@
 /*
  * Copyright (C) 2008 Apple Computer, Inc.  All rights reserved.
+ * Copyright (C) 2026 Haiku, inc.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -20,35 +21,151 @@
  * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
  * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
- * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
 #include "config.h"
 #include "DNS.h"
 #include "DNSResolveQueueHaiku.h"
 
-#include "NotImplemented.h"
+#include <netdb.h>
+#include <sys/socket.h>
+
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
+#include <wtf/MainThread.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/WorkerPool.h>
+#include <wtf/text/CString.h>
+#include <wtf/text/StringHash.h>
 
 namespace WebCore {
 
+// getaddrinfo() exposes no per-record TTL, so cached results get a fixed
+// one, matching what the system resolver typically hands out for web
+// content. DNSResolveQueue::add() already drives speculative prefetch from
+// link hover and <link rel="dns-prefetch"> through platformResolve(); all
+// the port has to provide is the resolver itself and the cache.
+static constexpr Seconds dnsCacheTTL = 60_s;
+static constexpr unsigned dnsCacheCapacity = 256;
+static constexpr unsigned maxConcurrentResolves = 4;
+
+struct CachedDNSResult {
+    Vector<IPAddress> addresses;
+    MonotonicTime expires;
+};
+
+static Lock dnsCacheLock;
+
+static HashMap<String, CachedDNSResult>& dnsCache()
+{
+    static NeverDestroyed<HashMap<String, CachedDNSResult>> cache;
+    return cache;
+}
+
+static WorkerPool& dnsWorkerPool()
+{
+    static NeverDestroyed<Ref<WorkerPool>> pool(
+        WorkerPool::create("DNSResolver"_s, maxConcurrentResolves));
+    return pool.get();
+}
+
+static std::optional<Vector<IPAddress>> lookupDNSCache(const String& hostname)
+{
+    Locker locker { dnsCacheLock };
+
+    auto it = dnsCache().find(hostname);
+    if (it == dnsCache().end())
+        return std::nullopt;
+
+    if (MonotonicTime::now() > it->value.expires) {
+        dnsCache().remove(it);
+        return std::nullopt;
+    }
+
+    return it->value.addresses;
+}
+
+static void storeDNSCache(const String& hostname, const Vector<IPAddress>& addresses)
+{
+    Locker locker { dnsCacheLock };
+
+    if (dnsCache().size() >= dnsCacheCapacity)
+        dnsCache().clear();
+    dnsCache().set(hostname.isolatedCopy(), { addresses, MonotonicTime::now() + dnsCacheTTL });
+}
+
+// Blocking; runs on the resolver pool.
+static DNSAddressesOrError resolveHostname(const String& hostname)
+{
+    struct addrinfo hints = {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    struct addrinfo* results = nullptr;
+    if (getaddrinfo(hostname.utf8().data(), nullptr, &hints, &results) != 0)
+        return makeUnexpected(DNSError::CannotResolve);
+
+    Vector<IPAddress> addresses;
+    for (struct addrinfo* info = results; info; info = info->ai_next) {
+        if (info->ai_family == AF_INET)
+            addresses.append(IPAddress(reinterpret_cast<struct sockaddr_in*>(info->ai_addr)->sin_addr));
+        else if (info->ai_family == AF_INET6)
+            addresses.append(IPAddress(reinterpret_cast<struct sockaddr_in6*>(info->ai_addr)->sin6_addr));
+    }
+    freeaddrinfo(results);
+
+    if (addresses.isEmpty())
+        return makeUnexpected(DNSError::CannotResolve);
+
+    storeDNSCache(hostname, addresses);
+    return addresses;
+}
+
 void DNSResolveQueueHaiku::updateIsUsingProxy()
 {
-    notImplemented();
+    // The port does not support proxies, so prefetching is always safe.
+    m_isUsingProxy = false;
 }
 
-void DNSResolveQueueHaiku::platformResolve(const String& /* hostname */)
+void DNSResolveQueueHaiku::platformResolve(const String& hostname)
 {
-    notImplemented();
+    // Speculative prefetch: only the cache side effect matters.
+    dnsWorkerPool().postTask([hostname = hostname.isolatedCopy()] {
+        if (!lookupDNSCache(hostname))
+            resolveHostname(hostname);
+        DNSResolveQueue::singleton().decrementRequestCount();
+    });
 }
 
-void DNSResolveQueueHaiku::resolve(const String& /* hostname */, uint64_t /* identifier */, DNSCompletionHandler&& /* completionHandler */)
+void DNSResolveQueueHaiku::resolve(const String& hostname, uint64_t identifier, DNSCompletionHandler&& completionHandler)
 {
-    notImplemented();
+    ASSERT(isMainThread());
+
+    if (auto cached = lookupDNSCache(hostname)) {
+        completionHandler(WTFMove(*cached));
+        return;
+    }
+
+    m_pendingResolves.set(identifier, WTFMove(completionHandler));
+
+    dnsWorkerPool().postTask([this, hostname = hostname.isolatedCopy(), identifier] {
+        auto result = resolveHostname(hostname);
+        callOnMainThread([this, identifier, result = WTFMove(result)]() mutable {
+            // stopResolve() may have taken the handler already.
+            if (auto completionHandler = m_pendingResolves.take(identifier))
+                completionHandler(WTFMove(result));
+        });
+    });
 }
 
-void DNSResolveQueueHaiku::stopResolve(uint64_t /* identifier */)
+void DNSResolveQueueHaiku::stopResolve(uint64_t identifier)
 {
-    notImplemented();
+    ASSERT(isMainThread());
+
+    if (auto completionHandler = m_pendingResolves.take(identifier))
+        completionHandler(makeUnexpected(DNSError::Cancelled));
 }
 
 }
@@ -26,6 +26,7 @@
 #pragma once
 
 #include "DNSResolveQueue.h"
+#include <wtf/HashMap.h>
 
 namespace WebCore {
 
@@ -38,6 +39,9 @@ public:
 private:
     void updateIsUsingProxy() final;
     void platformResolve(const String&) final;
+
+    // Main thread only.
+    HashMap<uint64_t, DNSCompletionHandler, IntHash<uint64_t>, WTF::UnsignedWithZeroKeyHashTraits<uint64_t>> m_pendingResolves;
 };
 
 using DNSResolveQueuePlatform = DNSResolveQueueHaiku;
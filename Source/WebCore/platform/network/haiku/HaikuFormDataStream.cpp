@@ -29,6 +29,11 @@
 
 namespace WebCore {
 
+// Each chunk is one disk read; eight of them in flight keep about a
+// megabyte of the upload buffered ahead of the network position.
+static const size_t gReadAheadChunkSize = 128 * 1024;
+static const size_t gReadAheadChunkCount = 8;
+
 BFormDataIO::BFormDataIO(const FormData* formData, PAL::SessionID sessionID)
 	: m_sessionID(sessionID)
 {
@@ -45,6 +50,17 @@ BFormDataIO::BFormDataIO(const FormData* formData, PAL::SessionID sessionID)
 
 BFormDataIO::~BFormDataIO()
 {
+    if (m_readAheadThread) {
+        {
+            Locker locker { m_ringLock };
+            m_shuttingDown = true;
+            m_ringCondition.notifyAll();
+        }
+        m_readAheadThread->waitForCompletion();
+    }
+
+    if (FileSystem::isHandleValid(m_fileHandle))
+        FileSystem::closeFile(m_fileHandle);
 }
 
 ssize_t BFormDataIO::Size()
@@ -61,6 +77,83 @@ BFormDataIO::Read(void* buffer, size_t size)
     if (!m_formData)
         return -1;
 
+    ensureReadAheadThread();
+
+    Locker locker { m_ringLock };
+
+    // Wait until the reader thread has something for us (or is done).
+    while (m_readyChunks.isEmpty() && !m_producerDone && !m_producerFailed)
+        m_ringCondition.wait(m_ringLock);
+
+    if (m_readyChunks.isEmpty())
+        return m_producerFailed ? -1 : 0;
+
+    size_t totalReadBytes = 0;
+    while (totalReadBytes < size && !m_readyChunks.isEmpty()) {
+        const Vector<uint8_t>& chunk = m_readyChunks.first();
+        size_t copyBytes = std::min(size - totalReadBytes, chunk.size() - m_chunkOffset);
+        memcpy((char*)buffer + totalReadBytes, chunk.data() + m_chunkOffset, copyBytes);
+
+        totalReadBytes += copyBytes;
+        m_chunkOffset += copyBytes;
+        if (m_chunkOffset == chunk.size()) {
+            m_readyChunks.removeFirst();
+            m_chunkOffset = 0;
+            // A slot freed up; let the reader refill it.
+            m_ringCondition.notifyAll();
+        }
+    }
+
+    m_totalReadSize += totalReadBytes;
+
+    return totalReadBytes;
+}
+
+void
+BFormDataIO::ensureReadAheadThread()
+{
+    if (m_readAheadThread)
+        return;
+
+    m_readAheadThread = Thread::create("FormData read-ahead"_s, [this] {
+        readAheadLoop();
+    });
+}
+
+void
+BFormDataIO::readAheadLoop()
+{
+    while (true) {
+        Vector<uint8_t> chunk(gReadAheadChunkSize);
+        ssize_t produced = produceChunk((char*)chunk.data(), chunk.size());
+
+        Locker locker { m_ringLock };
+        if (m_shuttingDown)
+            return;
+
+        if (produced <= 0) {
+            if (produced < 0)
+                m_producerFailed = true;
+            else
+                m_producerDone = true;
+            m_ringCondition.notifyAll();
+            return;
+        }
+
+        chunk.shrink(produced);
+        m_readyChunks.append(WTFMove(chunk));
+        m_ringCondition.notifyAll();
+
+        while (m_readyChunks.size() >= gReadAheadChunkCount && !m_shuttingDown)
+            m_ringCondition.wait(m_ringLock);
+        if (m_shuttingDown)
+            return;
+    }
+}
+
+ssize_t
+BFormDataIO::produceChunk(char* buffer, size_t size)
+{
     const auto totalElementSize = m_formData->elements().size();
     if (m_elementPosition >= totalElementSize)
         return 0;
@@ -89,8 +182,6 @@ BFormDataIO::Read(void* buffer, size_t size)
         totalReadBytes += *readBytes;
     }
 
-    m_totalReadSize += totalReadBytes;
-
     return totalReadBytes;
 }
 
@@ -116,30 +207,54 @@ void BFormDataIO::computeContentLength()
 
 std::optional<size_t> BFormDataIO::readFromFile(const FormDataElement::EncodedFileData& fileData, char* buffer, size_t size)
 {
-    if (m_fileHandle == FileSystem::invalidPlatformFileHandle)
+    if (m_fileHandle == FileSystem::invalidPlatformFileHandle) {
+        // Refuse to upload a file that changed since the form data was
+        // created; the declared content length would no longer match.
+        if (!fileData.fileModificationTimeMatchesExpectation()) {
+            LOG(Network, "Haiku - %s was modified since the form data was created\n", fileData.filename.utf8().data());
+            return std::nullopt;
+        }
+
         m_fileHandle = FileSystem::openFile(fileData.filename, FileSystem::FileOpenMode::Read);
 
-    if (!FileSystem::isHandleValid(m_fileHandle)) {
-        LOG(Network, "Haiku - Failed while trying to open %s for upload\n", fileData.filename.utf8().data());
-        m_fileHandle = FileSystem::invalidPlatformFileHandle;
-        return std::nullopt;
+        if (!FileSystem::isHandleValid(m_fileHandle)) {
+            LOG(Network, "Haiku - Failed while trying to open %s for upload\n", fileData.filename.utf8().data());
+            m_fileHandle = FileSystem::invalidPlatformFileHandle;
+            return std::nullopt;
+        }
+
+        // A sliced blob resolves to a (path, offset, length) window into
+        // the backing file; position the handle on the window and count its
+        // length down instead of uploading the file from the beginning.
+        if (fileData.fileStart > 0
+                && FileSystem::seekFile(m_fileHandle, fileData.fileStart, FileSystem::FileSeekOrigin::Beginning) < 0) {
+            LOG(Network, "Haiku - Failed while trying to seek %s for upload\n", fileData.filename.utf8().data());
+            FileSystem::closeFile(m_fileHandle);
+            m_fileHandle = FileSystem::invalidPlatformFileHandle;
+            return std::nullopt;
+        }
+        m_fileBytesRemaining = fileData.fileLength == BlobDataItem::toEndOfFile
+            ? std::numeric_limits<uint64_t>::max() : static_cast<uint64_t>(fileData.fileLength);
     }
 
-	// Note: there is no management of a file offset, we just keep the file
-	// handle open and read from the current position.
-    auto readBytes = FileSystem::readFromFile(m_fileHandle, buffer, size);
-    if (readBytes < 0) {
-        LOG(Network, "Haiku - Failed while trying to read %s for upload\n", fileData.filename.utf8().data());
-        FileSystem::closeFile(m_fileHandle);
-        m_fileHandle = FileSystem::invalidPlatformFileHandle;
-        return std::nullopt;
+    size_t bytesToRead = static_cast<size_t>(std::min<uint64_t>(size, m_fileBytesRemaining));
+    int64_t readBytes = 0;
+    if (bytesToRead) {
+        readBytes = FileSystem::readFromFile(m_fileHandle, { byteCast<uint8_t>(buffer), bytesToRead });
+        if (readBytes < 0) {
+            LOG(Network, "Haiku - Failed while trying to read %s for upload\n", fileData.filename.utf8().data());
+            FileSystem::closeFile(m_fileHandle);
+            m_fileHandle = FileSystem::invalidPlatformFileHandle;
+            return std::nullopt;
+        }
     }
 
     if (!readBytes) {
         FileSystem::closeFile(m_fileHandle);
         m_fileHandle = FileSystem::invalidPlatformFileHandle;
         m_elementPosition++;
-    }
+    } else if (m_fileBytesRemaining != std::numeric_limits<uint64_t>::max())
+        m_fileBytesRemaining -= readBytes;
 
     return readBytes;
 }
@@ -176,8 +291,11 @@ std::optional<size_t> BFormDataIO::readFromBlob(const FormDataElement::EncodedBl
     switch (blobItem.type()) {
 		case BlobDataItem::Type::Data:
 		{
-			size_t elementSize = blobItem.data()->size() - m_dataOffset;
-			const uint8_t* elementBuffer = blobItem.data()->data() + m_dataOffset;
+			// The item addresses an (offset, length) window inside the
+			// shared segment; a slice of an in-memory blob keeps pointing at
+			// the original bytes.
+			size_t elementSize = static_cast<size_t>(blobItem.length()) - m_dataOffset;
+			const uint8_t* elementBuffer = blobItem.data()->data() + blobItem.offset() + m_dataOffset;
 
 			readBytes = elementSize > size ? size : elementSize;
 			memcpy(buffer, elementBuffer, readBytes);
@@ -199,8 +317,16 @@ std::optional<size_t> BFormDataIO::readFromBlob(const FormDataElement::EncodedBl
 					&& fileModificationTime == blobItem.file()->expectedModificationTime())
 				m_fileHandle = FileSystem::openFile(blobItem.file()->path(), FileSystem::FileOpenMode::Read);
 
-			// FIXME the blob can specify an offset and chunk size inside the file
-			// So we should seek there and make sure we stop at the right time.
+			// The item addresses an (offset, length) window inside the
+			// file; position the handle on the window and count its length
+			// down instead of uploading from the beginning to the end.
+			if (FileSystem::isHandleValid(m_fileHandle) && blobItem.offset() > 0
+					&& FileSystem::seekFile(m_fileHandle, blobItem.offset(), FileSystem::FileSeekOrigin::Beginning) < 0) {
+				FileSystem::closeFile(m_fileHandle);
+				m_fileHandle = FileSystem::invalidPlatformFileHandle;
+			}
+			m_fileBytesRemaining = blobItem.length() == BlobDataItem::toEndOfFile
+				? std::numeric_limits<uint64_t>::max() : static_cast<uint64_t>(blobItem.length());
 		}
 
 
@@ -209,12 +335,13 @@ std::optional<size_t> BFormDataIO::readFromBlob(const FormDataElement::EncodedBl
 			m_fileHandle = FileSystem::invalidPlatformFileHandle;
 			readBytes = -1;
 		} else {
-			// Note: there is no management of a file offset, we just keep the file
-			// handle open and read from the current position.
-			readBytes = FileSystem::readFromFile(m_fileHandle, buffer, size);
+			size_t bytesToRead = static_cast<size_t>(std::min<uint64_t>(size, m_fileBytesRemaining));
+			readBytes = bytesToRead
+				? FileSystem::readFromFile(m_fileHandle, { byteCast<uint8_t>(buffer), bytesToRead }) : 0;
 			if (readBytes < 0) {
 				LOG(Network, "Haiku - Failed while trying to read %s for upload\n", blobItem.file()->path().utf8().data());
-			}
+			} else if (readBytes > 0 && m_fileBytesRemaining != std::numeric_limits<uint64_t>::max())
+				m_fileBytesRemaining -= readBytes;
 		}
 
 		if (readBytes <= 0) {
@@ -227,7 +354,7 @@ std::optional<size_t> BFormDataIO::readFromBlob(const FormDataElement::EncodedBl
     }
 
 	// Should we advance to the next form element yet?
-	if (m_blobItemIndex > blobData->items().size())
+	if (m_blobItemIndex >= blobData->items().size())
 	{
 		m_elementPosition++;
 		m_blobItemIndex = 0;
@@ -27,6 +27,11 @@
 #include <DataIO.h>
 #include <File.h>
 
+#include <wtf/Condition.h>
+#include <wtf/Deque.h>
+#include <wtf/Lock.h>
+#include <wtf/Threading.h>
+
 namespace WebCore {
 
 class BFormDataIO : public BDataIO
@@ -34,14 +39,22 @@ class BFormDataIO : public BDataIO
 public:
 	BFormDataIO(const FormData* form, PAL::SessionID sessionID);
 	~BFormDataIO();
-	
+
 	ssize_t Size();
 	ssize_t Read(void* buffer, size_t size) override;
 	ssize_t Write(const void* buffer, size_t size) override;
-	
+
 private:
     void computeContentLength();
 
+	// Read-ahead: a reader thread walks the form elements and fills a
+	// bounded ring of chunks ahead of the upload position, so disk reads
+	// of large files overlap the network sends instead of alternating
+	// with them. Read() only ever copies out of the ring.
+	void ensureReadAheadThread();
+	void readAheadLoop();
+	ssize_t produceChunk(char* buffer, size_t size);
+
     std::optional<size_t> readFromFile(const FormDataElement::EncodedFileData&, char*, size_t);
     std::optional<size_t> readFromData(const Vector<uint8_t>&, char*, size_t);
 	std::optional<size_t> readFromBlob(const FormDataElement::EncodedBlobData&, char*, size_t);
@@ -57,7 +70,19 @@ private:
     size_t m_blobItemIndex { 0 };
 
     FileSystem::PlatformFileHandle m_fileHandle { FileSystem::invalidPlatformFileHandle };
+    // Bytes left in the (offset, length) window of the file segment the
+    // open handle belongs to; max() stands for "to the end of the file".
+    uint64_t m_fileBytesRemaining { 0 };
     size_t m_dataOffset { 0 };
+
+	RefPtr<Thread> m_readAheadThread;
+	Lock m_ringLock;
+	Condition m_ringCondition;
+	Deque<Vector<uint8_t>> m_readyChunks;
+	size_t m_chunkOffset { 0 };
+	bool m_producerDone { false };
+	bool m_producerFailed { false };
+	bool m_shuttingDown { false };
 };
 
 };
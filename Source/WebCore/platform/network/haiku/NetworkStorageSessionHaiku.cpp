@@ -40,13 +40,71 @@
 #include "ResourceHandle.h"
 #include "wtf/URL.h"
 
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
 #include <wtf/MainThread.h>
+#include <wtf/MonotonicTime.h>
 #include <wtf/NeverDestroyed.h>
+#include <wtf/text/MakeString.h>
+#include <wtf/text/StringHash.h>
 
 #define TRACE_COOKIE_JAR 0
 
 namespace WebCore {
 
+// Building a Cookie: header walks the jar's domain lists linearly, and pages
+// fire bursts of requests against the same few origins, so memoize the
+// computed header per URL. Entries expire quickly because the kit applies
+// Set-Cookie responses to the jar behind our back; mutations that do go
+// through us (setCookiesFromDOM) drop the cache immediately.
+static constexpr Seconds cookieHeaderCacheLifetime = 1_s;
+static constexpr unsigned cookieHeaderCacheCapacity = 64;
+
+struct CachedCookieHeader {
+    String value;
+    bool hasSecureCookies;
+    MonotonicTime timestamp;
+};
+
+static Lock cookieHeaderCacheLock;
+
+static HashMap<String, CachedCookieHeader>& cookieHeaderCache()
+{
+    static NeverDestroyed<HashMap<String, CachedCookieHeader>> cache;
+    return cache;
+}
+
+static std::optional<std::pair<String, bool>> lookupCookieHeaderCache(const String& key)
+{
+    Locker locker { cookieHeaderCacheLock };
+
+    auto it = cookieHeaderCache().find(key);
+    if (it == cookieHeaderCache().end())
+        return std::nullopt;
+
+    if (MonotonicTime::now() - it->value.timestamp > cookieHeaderCacheLifetime) {
+        cookieHeaderCache().remove(it);
+        return std::nullopt;
+    }
+
+    return std::make_pair(it->value.value, it->value.hasSecureCookies);
+}
+
+static void storeCookieHeaderCache(const String& key, const String& value, bool hasSecureCookies)
+{
+    Locker locker { cookieHeaderCacheLock };
+
+    if (cookieHeaderCache().size() >= cookieHeaderCacheCapacity)
+        cookieHeaderCache().clear();
+    cookieHeaderCache().set(key, { value, hasSecureCookies, MonotonicTime::now() });
+}
+
+static void invalidateCookieHeaderCache()
+{
+    Locker locker { cookieHeaderCacheLock };
+    cookieHeaderCache().clear();
+}
+
 NetworkStorageSession::NetworkStorageSession(PAL::SessionID sessionID)
     : m_sessionID(sessionID)
     , m_context(nullptr)
@@ -78,6 +136,7 @@ void NetworkStorageSession::setCookiesFromDOM(const URL& firstParty,
     printf("  from %s\n", value.utf8().data());
 #endif
     platformSession().GetCookieJar().AddCookie(heapCookie);
+    invalidateCookieHeaderCache();
 }
 
 HTTPCookieAcceptPolicy NetworkStorageSession::cookieAcceptPolicy() const
@@ -95,6 +154,11 @@ std::pair<String, bool> NetworkStorageSession::cookiesForDOM(const URL& firstPar
 	printf("CookieJar: Request for %s\n", url.string().utf8().data());
 #endif
 
+	String cacheKey = makeString(ASCIILiteral::fromLiteralUnsafe("dom|"),
+		includeSecureCookies == IncludeSecureCookies::Yes ? 's' : '-', '|', url.string());
+	if (auto cached = lookupCookieHeaderCache(cacheKey))
+		return *cached;
+
 	BString result;
 	BUrl hUrl(url);
 	bool secure = false;
@@ -115,12 +179,15 @@ std::pair<String, bool> NetworkStorageSession::cookiesForDOM(const URL& firstPar
             if (includeSecureCookies == IncludeSecureCookies::No)
 				continue;
 		}
-		
+
 		result << "; " << c->RawCookie(false);
 	}
 	result.Remove(0, 2);
 
-    return {String::fromUTF8(result), secure};
+	String value = String::fromUTF8(result);
+	storeCookieHeaderCache(cacheKey, value, secure);
+
+    return {value, secure};
 }
 
 void NetworkStorageSession::setCookies(const Vector<Cookie>&, const URL&, const URL&)
@@ -207,6 +274,11 @@ std::pair<String, bool> NetworkStorageSession::cookieRequestHeaderFieldValue(con
 	printf("CookieJar: RequestHeaderField for %s\n", url.string().utf8().data());
 #endif
 
+	String cacheKey = makeString(ASCIILiteral::fromLiteralUnsafe("hdr|"),
+		includeSecureCookies == IncludeSecureCookies::Yes ? 's' : '-', '|', url.string());
+	if (auto cached = lookupCookieHeaderCache(cacheKey))
+		return *cached;
+
 	BString result;
 	BUrl hUrl(url);
 	bool secure = false;
@@ -222,12 +294,15 @@ std::pair<String, bool> NetworkStorageSession::cookieRequestHeaderFieldValue(con
             if (includeSecureCookies == IncludeSecureCookies::No)
 				continue;
 		}
-		
+
 		result << "; " << c->RawCookie(false);
 	}
 	result.Remove(0, 2);
 
-    return {String::fromUTF8(result.String()), secure};
+	String value = String::fromUTF8(result.String());
+	storeCookieHeaderCache(cacheKey, value, secure);
+
+    return {value, secure};
 }
 
 std::pair<String, bool> NetworkStorageSession::cookieRequestHeaderFieldValue(
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE COMPUTER, INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE COMPUTER, INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "config.h"
+#include "NetworkWaterfall.h"
+
+#include <utility>
+#include <wtf/NeverDestroyed.h>
+
+namespace WebCore {
+
+// Bounds the log while nobody drains it; a busy page loads a few hundred
+// resources, so this holds several page loads worth of history.
+static const size_t gMaxEntries = 1024;
+
+static bool gEnabled = false;
+
+static Vector<NetworkWaterfall::Entry>& entries()
+{
+    static NeverDestroyed<Vector<NetworkWaterfall::Entry>> log;
+    return log;
+}
+
+void NetworkWaterfall::setEnabled(bool enabled)
+{
+    gEnabled = enabled;
+}
+
+bool NetworkWaterfall::isEnabled()
+{
+    return gEnabled;
+}
+
+void NetworkWaterfall::record(Entry&& entry)
+{
+    if (!gEnabled)
+        return;
+
+    // Drop the oldest entry once full; the recent history is the
+    // interesting part when the log is only drained on demand.
+    if (entries().size() >= gMaxEntries)
+        entries().remove(0);
+    entries().append(WTFMove(entry));
+}
+
+Vector<NetworkWaterfall::Entry> NetworkWaterfall::take()
+{
+    return std::exchange(entries(), { });
+}
+
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE COMPUTER, INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE COMPUTER, INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef NETWORKWATERFALL_H
+#define NETWORKWATERFALL_H
+
+#include <wtf/MonotonicTime.h>
+#include <wtf/Vector.h>
+#include <wtf/text/WTFString.h>
+
+namespace WebCore {
+
+// Opt-in log of completed network requests with the socket-level phase
+// timestamps BUrlRequestWrapper captures from the services kit listener
+// hooks. The figures are process-wide (in this port every page shares the
+// loader, and ResourceHandle does not know which page it loads for);
+// per-page attribution is available through the inspector's Network
+// domain, which rides the same NetworkLoadMetrics. BWebPage drains the
+// log for embedder telemetry.
+//
+// Everything here runs on the main thread, where the wrapper lifecycle
+// already lives, so no locking is needed.
+class NetworkWaterfall {
+public:
+    struct Entry {
+        String url;
+        int httpStatusCode { 0 };
+        bool failed { false };
+
+        // The request carried cache validators; with status 304 that is a
+        // revalidation hit (headers only), with 200 a revalidation miss.
+        bool conditional { false };
+
+        // Zero marks a phase the request did not go through (e.g. no
+        // hostname resolution or connect on a reused keep-alive
+        // connection). TLS handshake time is folded into the connect
+        // phase; the services kit completes it inside Connect() and
+        // offers no separate hook.
+        MonotonicTime fetchStart;
+        MonotonicTime domainLookupStart;
+        MonotonicTime domainLookupEnd;
+        MonotonicTime connectEnd;
+        MonotonicTime responseStart;
+        MonotonicTime responseEnd;
+
+        // Body bytes as received from the socket vs. after the kit's
+        // dechunking and decompression.
+        uint64_t bytesOnWire { 0 };
+        uint64_t bytesDecoded { 0 };
+    };
+
+    static void setEnabled(bool);
+    static bool isEnabled();
+
+    static void record(Entry&&);
+
+    // Returns the recorded entries, oldest first, and clears the log.
+    static Vector<Entry> take();
+};
+
+}
+
+#endif // NETWORKWATERFALL_H
@@ -187,10 +187,32 @@ bool SQLiteDatabase::open(const String& filename, OpenMode openMode, OptionSet<O
             LOG_ERROR("SQLite database could not set temp_store to memory");
     }
 
+#if OS(HAIKU)
+    {
+        // Read pages straight out of the page cache instead of copying them
+        // through read() on the storage work queues.
+        SQLiteTransactionInProgressAutoCounter transactionCounter;
+        if (!executeCommand("PRAGMA mmap_size = 268435456;"_s))
+            LOG_ERROR("SQLite database could not enable memory-mapped I/O");
+    }
+#endif
+
     if (filename != inMemoryPath()) {
         if (openMode != OpenMode::ReadOnly && !useWALJournalMode())
             return false;
 
+#if OS(HAIKU)
+        if (openMode != OpenMode::ReadOnly) {
+            // With the write-ahead log in place, NORMAL only syncs the
+            // database at checkpoints instead of fsync()ing the log on every
+            // commit, while the file stays consistent across crashes either
+            // way. SQLite defaults to FULL, which makes every localStorage
+            // and IndexedDB commit pay for two syncs.
+            SQLiteTransactionInProgressAutoCounter transactionCounter;
+            setSynchronous(SyncNormal);
+        }
+#endif
+
         auto shmFileName = makeString(filename, "-shm"_s);
         if (FileSystem::fileExists(shmFileName) && !FileSystem::isSafeToUseMemoryMapForPath(shmFileName)) {
             RELEASE_LOG_FAULT(SQLDatabase, "Opened an SQLite database with a Class A -shm file. This may trigger a crash when the user locks the device. (%s)", shmFileName.latin1().data());
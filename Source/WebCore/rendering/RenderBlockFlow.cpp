@@ -3808,6 +3808,7 @@ void RenderBlockFlow::layoutInlineContent(bool relayoutChildren, LayoutUnit& rep
 
     auto hasSimpleOutOfFlowContentOnly = !hasLineIfEmpty();
     auto hasSimpleStaticPositionForInlineLevelOutOfFlowContentByStyle = hasSimpleStaticPositionForInlineLevelOutOfFlowChildrenByStyle(style());
+    auto hasDirtyInlineContent = false;
 
     for (auto walker = InlineWalker(*this); !walker.atEnd(); walker.advance()) {
         auto& renderer = *walker.current();
@@ -3840,6 +3841,7 @@ void RenderBlockFlow::layoutInlineContent(bool relayoutChildren, LayoutUnit& rep
 
         if (!renderer.needsLayout() && !renderer.preferredLogicalWidthsDirty())
             continue;
+        hasDirtyInlineContent = true;
 
         if (auto* renderText = dynamicDowncast<RenderText>(renderer))
             setFullRepaintOnParentInlineBoxLayerIfNeeded(*renderText);
@@ -3899,6 +3901,22 @@ void RenderBlockFlow::layoutInlineContent(bool relayoutChildren, LayoutUnit& rep
         return contentBoxBottom + borderAndPaddingAfter() + scrollbarLogicalHeight();
     };
 
+    // When nothing inside the inline formatting context is dirty and the constraint space is
+    // unchanged (the ancestor resize only affected the block axis), the previous line layout
+    // result is still valid and rebuilding the lines would produce identical display content.
+    auto canReuseExistingInlineLayout = !relayoutChildren && !selfNeedsLayout() && !hasDirtyInlineContent
+        && !containsFloats()
+        && !layoutState.isPaginated()
+        && !layoutState.lineGrid()
+        && !layoutState.lineClamp()
+        && !layoutState.legacyLineClamp()
+        && !layoutState.textBoxTrim()
+        && layoutFormattingContextLineLayout.canReuseExistingLayout();
+    if (canReuseExistingInlineLayout) {
+        setLogicalHeight(computeBorderBoxBottom());
+        return;
+    }
+
     auto oldBorderBoxBottom = computeBorderBoxBottom();
     m_previousInlineLayoutContentBoxLogicalHeight = { };
 
@@ -32,6 +32,7 @@
 #include "ElementRareData.h"
 #include "ElementRuleCollector.h"
 #include "HTMLSlotElement.h"
+#include "Logging.h"
 #include "RuleSetBuilder.h"
 #include "SelectorMatchingState.h"
 #include "ShadowRoot.h"
@@ -111,7 +112,11 @@ Invalidator::Invalidator(const InvalidationRuleSetVector& ruleSets)
     ASSERT(m_ruleSets.size());
 }
 
-Invalidator::~Invalidator() = default;
+Invalidator::~Invalidator()
+{
+    if (m_elementsChecked)
+        LOG_WITH_STREAM(StyleInvalidation, stream << "Invalidator " << this << " checked " << m_elementsChecked << " elements, invalidated " << m_elementsInvalidated);
+}
 
 Invalidator::RuleInformation Invalidator::collectRuleInformation()
 {
@@ -165,11 +170,13 @@ Invalidator::CheckDescendants Invalidator::invalidateIfNeeded(Element& element,
     case Validity::Valid:
     case Validity::AnimationInvalid:
     case Validity::InlineStyleInvalid: {
+        ++m_elementsChecked;
         for (auto& ruleSet : m_ruleSets) {
             ElementRuleCollector ruleCollector(element, *ruleSet, selectorMatchingState);
             ruleCollector.setMode(SelectorChecker::Mode::CollectingRulesIgnoringVirtualPseudoElements);
 
             if (ruleCollector.matchesAnyAuthorRules()) {
+                ++m_elementsInvalidated;
                 element.invalidateStyleInternal();
                 break;
             }
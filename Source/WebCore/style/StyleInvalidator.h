@@ -94,6 +94,12 @@ private:
 
     RuleInformation m_ruleInformation;
 
+    // Diagnostics for the StyleInvalidation log channel: how many elements the
+    // pass checked against the invalidation rule sets and how many it actually
+    // marked for style recalculation.
+    uint64_t m_elementsChecked { 0 };
+    uint64_t m_elementsInvalidated { 0 };
+
     bool m_dirtiesAllStyle { false };
 };
 
@@ -62,6 +62,7 @@
 #include "WebAnimationTypes.h"
 #include "WebAnimationUtilities.h"
 #include "dom/EventTarget.h"
+#include <wtf/PerformanceCounter.h>
 
 namespace WebCore {
 
@@ -69,6 +70,10 @@ namespace Style {
 
 DEFINE_ALLOCATOR_WITH_HEAP_IDENTIFIER(TreeResolverScope);
 
+PERFORMANCE_COUNTER(elementsResolvedCounter, "style.elementsResolved");
+PERFORMANCE_COUNTER(stylesSharedCounter, "style.stylesShared");
+PERFORMANCE_COUNTER(fastPathInheritsCounter, "style.fastPathInherits");
+
 TreeResolver::TreeResolver(Document& document, std::unique_ptr<Update> update)
     : m_document(document)
     , m_update(WTFMove(update))
@@ -138,6 +143,8 @@ void TreeResolver::popScope()
 
 ResolvedStyle TreeResolver::styleForStyleable(const Styleable& styleable, ResolutionType resolutionType, const ResolutionContext& resolutionContext, const RenderStyle* existingStyle)
 {
+    PERFORMANCE_COUNTER_INCREMENT(elementsResolvedCounter);
+
     if (resolutionType == ResolutionType::AnimationOnly && styleable.lastStyleChangeEventStyle() && !styleable.hasPropertiesOverridenAfterAnimation())
         return { RenderStyle::clonePtr(*styleable.lastStyleChangeEventStyle()) };
 
@@ -155,13 +162,16 @@ ResolvedStyle TreeResolver::styleForStyleable(const Styleable& styleable, Resolu
 
     if (resolutionType == ResolutionType::FastPathInherit) {
         // If the only reason we are computing the style is that some parent inherited properties changed, we can just copy them.
+        PERFORMANCE_COUNTER_INCREMENT(fastPathInheritsCounter);
         auto style = RenderStyle::clonePtr(*existingStyle);
         style->fastPathInheritFrom(parent().style);
         return { WTFMove(style) };
     }
 
-    if (auto style = scope().sharingResolver.resolve(styleable, *m_update))
+    if (auto style = scope().sharingResolver.resolve(styleable, *m_update)) {
+        PERFORMANCE_COUNTER_INCREMENT(stylesSharedCounter);
         return { WTFMove(style) };
+    }
 
     if (resolutionType == ResolutionType::FullWithMatchResultCache) {
         if (auto cachedMatchResult = m_document.styleScope().cachedMatchResult(element))
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019 Haiku, Inc.
+ * Copyright (C) 2024 Haiku, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -24,17 +24,9 @@
  */
 
 #include "config.h"
-#include "AuxiliaryProcessMain.h"
+#include "NetworkProcessMain.h"
 
-#include "NotImplemented.h"
-
-
-namespace WebKit {
-
-bool AuxiliaryProcessMainBase::parseCommandLine(int argc, char** argv)
+int main(int argc, char** argv)
 {
-	notImplemented();
-    return true;
+    return WebKit::NetworkProcessMain(argc, argv);
 }
-
-} // namespace WebKit
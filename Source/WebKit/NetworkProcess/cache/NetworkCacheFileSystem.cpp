@@ -53,6 +53,29 @@
 namespace WebKit {
 namespace NetworkCache {
 
+#if OS(HAIKU)
+void traverseDirectory(const String& path, const Function<void (const String&, DirectoryEntryType)>& function)
+{
+    // Enumerate in one readdir() pass instead of building the whole name
+    // list first and then re-resolving every full path for its type.
+    // Haiku's dirent has no d_type, so a stat per entry is unavoidable, but
+    // statting relative to the open directory skips the path walk each time.
+    DIR* dir = opendir(FileSystem::fileSystemRepresentation(path).data());
+    if (!dir)
+        return;
+    int directoryFD = dirfd(dir);
+    while (dirent* entry = readdir(dir)) {
+        if (!strcmp(entry->d_name, ".") || !strcmp(entry->d_name, ".."))
+            continue;
+        struct stat fileInfo;
+        if (fstatat(directoryFD, entry->d_name, &fileInfo, 0))
+            continue;
+        auto type = S_ISDIR(fileInfo.st_mode) ? DirectoryEntryType::Directory : DirectoryEntryType::File;
+        function(String::fromUTF8(entry->d_name), type);
+    }
+    closedir(dir);
+}
+#else
 void traverseDirectory(const String& path, const Function<void (const String&, DirectoryEntryType)>& function)
 {
     auto entries = FileSystem::listDirectory(path);
@@ -62,6 +85,7 @@ void traverseDirectory(const String& path, const Function<void (const String&, D
         function(entry, type);
     }
 }
+#endif
 
 FileTimes fileTimes(const String& path)
 {
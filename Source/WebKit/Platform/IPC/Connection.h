@@ -652,6 +652,11 @@ private:
     Vector<int> m_fileDescriptors;
     int m_socketDescriptor;
     std::unique_ptr<UnixMessage> m_pendingOutputMessage;
+#if OS(HAIKU)
+    bool flushOutputBatch();
+
+    Vector<uint8_t> m_outputBatch;
+#endif
 #if USE(GLIB)
     GRefPtr<GSocket> m_socket;
     GSocketMonitor m_readSocketMonitor;
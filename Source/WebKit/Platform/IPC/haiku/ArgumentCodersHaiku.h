@@ -25,10 +25,20 @@
 
 #pragma once
 
+#include <type_traits>
 #include <wtf/ArgumentCoder.h>
 
 class BMessenger;
 
+namespace WebCore {
+class FloatPoint;
+class FloatRect;
+class FloatSize;
+class IntPoint;
+class IntRect;
+class IntSize;
+}
+
 namespace IPC {
 
 template<> struct ArgumentCoder<BMessenger> {
@@ -37,4 +47,17 @@ template<> struct ArgumentCoder<BMessenger> {
     static std::optional<BMessenger> decode(Decoder&);
 };
 
+// Vectors of the types listed here cross the wire as a single memcpy'd
+// span instead of one encode call per field per element; the rect lists
+// in drawing-area updates are the heaviest user. This bypasses the
+// generated validating serializers, so only trivially copyable types
+// where every bit pattern decodes to a valid value may be added.
+template<typename T> struct CopiesAsBytesOnWire : std::false_type { };
+template<> struct CopiesAsBytesOnWire<WebCore::FloatPoint> : std::true_type { };
+template<> struct CopiesAsBytesOnWire<WebCore::FloatRect> : std::true_type { };
+template<> struct CopiesAsBytesOnWire<WebCore::FloatSize> : std::true_type { };
+template<> struct CopiesAsBytesOnWire<WebCore::IntPoint> : std::true_type { };
+template<> struct CopiesAsBytesOnWire<WebCore::IntRect> : std::true_type { };
+template<> struct CopiesAsBytesOnWire<WebCore::IntSize> : std::true_type { };
+
 }
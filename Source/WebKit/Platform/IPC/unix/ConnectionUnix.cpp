@@ -426,10 +426,78 @@ bool Connection::sendOutgoingMessage(UniqueRef<Encoder>&& encoder)
     return sendOutputMessage(outputMessage);
 }
 
+#if OS(HAIKU)
+bool Connection::flushOutputBatch()
+{
+    if (m_outputBatch.isEmpty())
+        return true;
+
+    while (send(m_socketDescriptor, m_outputBatch.data(), m_outputBatch.size(), MSG_NOSIGNAL) == -1) {
+        if (errno == EINTR)
+            continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            struct pollfd pollfd;
+
+            pollfd.fd = m_socketDescriptor;
+            pollfd.events = POLLOUT;
+            pollfd.revents = 0;
+            poll(&pollfd, 1, -1);
+            continue;
+        }
+
+        if (errno == ECONNRESET) {
+            connectionDidClose();
+            return false;
+        }
+
+        if (m_isConnected)
+            WTFLogAlways("Error sending IPC message: %s", safeStrerror(errno).data());
+        return false;
+    }
+
+    m_outputBatch.shrink(0);
+    return true;
+}
+#endif
+
 bool Connection::sendOutputMessage(UnixMessage& outputMessage)
 {
     ASSERT(!m_pendingOutputMessage);
 
+#if OS(HAIKU)
+    // Scrolling and event traffic is dominated by small messages, and each
+    // sendmsg() is a comparatively expensive syscall. Coalesce messages that
+    // carry no attachments into one buffer and flush it with a single write
+    // once the outgoing queue has drained (or the batch is full), so a burst
+    // of queued messages costs one syscall instead of one each. The receive
+    // side needs no changes: processMessage() already parses consecutive
+    // messages out of a single read.
+    if (outputMessage.attachments().isEmpty() && !outputMessage.messageInfo().isBodyOutOfLine()) {
+        size_t wireSize = sizeof(MessageInfo) + outputMessage.bodySize();
+
+        // Each read on the other side fills a messageMaxSize buffer, so a
+        // batch must never outgrow one.
+        if (m_outputBatch.size() + wireSize > messageMaxSize && !flushOutputBatch())
+            return false;
+
+        m_outputBatch.append(std::span { reinterpret_cast<const uint8_t*>(&outputMessage.messageInfo()), sizeof(MessageInfo) });
+        m_outputBatch.append(outputMessage.body());
+
+        bool moreMessagesQueued;
+        {
+            Locker locker { m_outgoingMessagesLock };
+            moreMessagesQueued = !m_outgoingMessages.isEmpty();
+        }
+        if (moreMessagesQueued)
+            return true;
+        return flushOutputBatch();
+    }
+
+    // A message carrying attachments must not overtake batched plain ones.
+    if (!flushOutputBatch())
+        return false;
+#endif
+
     auto& messageInfo = outputMessage.messageInfo();
     struct msghdr message;
     memset(&message, 0, sizeof(message));
@@ -17,17 +17,22 @@ list(APPEND WebKit_SOURCES
     Platform/unix/SharedMemoryUnix.cpp
 
     Shared/WebCoreArgumentCoders.cpp
-    Shared/haiku/AuxiliaryProcessMainHaiku.cpp
+    Shared/haiku/NativeWebWheelEventHaiku.cpp
     Shared/haiku/ProcessExecutablePathHaiku.cpp
     Shared/haiku/WebCoreArgumentCodersHaiku.cpp
+    Shared/haiku/WebEventFactory.cpp
     Shared/haiku/WebMemorySamplerHaiku.cpp
+    Shared/unix/AuxiliaryProcessMain.cpp
 
     UIProcess/API/haiku/APIWebsiteDataStoreHaiku.cpp
+    UIProcess/CoordinatedGraphics/DrawingAreaProxyCoordinatedGraphics.cpp
     UIProcess/DefaultUndoController.cpp
     UIProcess/Launcher/haiku/ProcessLauncherHaiku.cpp
     UIProcess/LegacySessionStateCodingNone.cpp
     UIProcess/WebsiteData/haiku/WebsiteDataStoreHaiku.cpp
+    UIProcess/haiku/BackingStoreHaiku.cpp
     UIProcess/haiku/TextCheckerHaiku.cpp
+    UIProcess/haiku/RemoteWebInspectorProxyHaiku.cpp
     UIProcess/haiku/WebInspectorProxyHaiku.cpp
     UIProcess/haiku/WebPageProxyHaiku.cpp
     UIProcess/haiku/WebProcessPoolHaiku.cpp
@@ -77,6 +77,8 @@ public:
 
 #elif PLATFORM(WIN)
     NativeWebWheelEvent(HWND, UINT message, WPARAM, LPARAM, float deviceScaleFactor);
+#elif PLATFORM(HAIKU)
+    explicit NativeWebWheelEvent(const BMessage*);
 #endif
 
 #if USE(APPKIT)
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2019 Haiku Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "WebEventFactory.h"
+
+#include <WebCore/IntPoint.h>
+#include <WebCore/Scrollbar.h>
+#include <InterfaceDefs.h>
+#include <Message.h>
+#include <Point.h>
+
+namespace WebKit {
+
+static OptionSet<WebEventModifier> modifiersForMessage(const BMessage* message)
+{
+    OptionSet<WebEventModifier> result;
+
+    int32 modifiers = message->FindInt32("modifiers");
+    if (modifiers & B_SHIFT_KEY)
+        result.add(WebEventModifier::ShiftKey);
+    if (modifiers & B_COMMAND_KEY)
+        result.add(WebEventModifier::ControlKey);
+    if (modifiers & B_CONTROL_KEY)
+        result.add(WebEventModifier::AltKey);
+    if (modifiers & B_OPTION_KEY)
+        result.add(WebEventModifier::MetaKey);
+    if (modifiers & B_CAPS_LOCK)
+        result.add(WebEventModifier::CapsLockKey);
+
+    return result;
+}
+
+WebWheelEvent WebEventFactory::createWebWheelEvent(const BMessage* message)
+{
+    WebCore::IntPoint position(message->FindPoint("be:view_where"));
+    WebCore::IntPoint globalPosition(message->FindPoint("screen_where"));
+
+    // Same mapping as PlatformWheelEvent(BMessage*) on the WebKitLegacy side:
+    // the wheel deltas report ticks, scrolling by lines.
+    WebCore::FloatSize wheelTicks(-message->FindFloat("be:wheel_delta_x"),
+        -message->FindFloat("be:wheel_delta_y"));
+    WebCore::FloatSize delta = wheelTicks;
+    delta.scale(WebCore::Scrollbar::pixelsPerLineStep());
+
+    return WebWheelEvent({ WebEventType::Wheel, modifiersForMessage(message), WallTime::now() },
+        position, globalPosition, delta, wheelTicks, WebWheelEvent::ScrollByPixelWheelEvent);
+}
+
+} // namespace WebKit
@@ -40,6 +40,9 @@ class SkCanvas;
 IGNORE_CLANG_WARNINGS_BEGIN("cast-align")
 #include <skia/core/SkSurface.h>
 IGNORE_CLANG_WARNINGS_END
+#elif PLATFORM(HAIKU)
+class BBitmap;
+class BView;
 #endif
 
 namespace WebCore {
@@ -54,6 +57,8 @@ typedef struct _cairo cairo_t;
 using PlatformPaintContextPtr = cairo_t*;
 #elif USE(SKIA)
 using PlatformPaintContextPtr = SkCanvas*;
+#elif PLATFORM(HAIKU)
+using PlatformPaintContextPtr = BView*;
 #endif
 
 class BackingStore {
@@ -80,6 +85,11 @@ private:
     PAL::HysteresisActivity m_scrolledHysteresis;
 #elif USE(SKIA)
     sk_sp<SkSurface> m_surface;
+#elif PLATFORM(HAIKU)
+    // The bitmap accepts views; m_view stays attached to it so updates and
+    // scrolls can be blitted into the store without reallocating anything.
+    BBitmap* m_bitmap { nullptr };
+    BView* m_view { nullptr };
 #endif
 };
 
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2024 Haiku, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "ProcessLauncher.h"
+
+#include "Connection.h"
+#include "IPCUtilities.h"
+#include "ProcessExecutablePath.h"
+#include <errno.h>
+#include <image.h>
+#include <signal.h>
+#include <unistd.h>
+#include <wtf/FileSystem.h>
+#include <wtf/RunLoop.h>
+#include <wtf/UniStdExtras.h>
+#include <wtf/text/CString.h>
+#include <wtf/text/WTFString.h>
+
+extern char** environ;
+
+namespace WebKit {
+
+void ProcessLauncher::launchProcess()
+{
+    // The client end must stay open across exec so the child can adopt it;
+    // the server end is ours and must not leak into the child.
+    IPC::SocketPair socketPair = IPC::createPlatformConnection(IPC::PlatformConnectionOptions::SetCloexecOnServer);
+
+    String executablePath;
+    switch (m_launchOptions.processType) {
+    case ProcessLauncher::ProcessType::Web:
+        executablePath = executablePathOfWebProcess();
+        break;
+    case ProcessLauncher::ProcessType::Network:
+        executablePath = executablePathOfNetworkProcess();
+        break;
+    default:
+        ASSERT_NOT_REACHED();
+        return;
+    }
+
+    CString realExecutablePath = FileSystem::fileSystemRepresentation(executablePath);
+    CString processIdentifier = String::number(m_launchOptions.processIdentifier.toUInt64()).utf8();
+    CString connectionIdentifier = String::number(socketPair.client).utf8();
+
+    // The command line is parsed back in AuxiliaryProcessMainCommon::parseCommandLine.
+    const char* argv[] = {
+        realExecutablePath.data(),
+        processIdentifier.data(),
+        connectionIdentifier.data(),
+        nullptr
+    };
+
+    // load_image() spawns the new team suspended, so nothing races the
+    // socket handoff; resume_thread() sets it running.
+    thread_id child = load_image(3, argv, const_cast<const char**>(environ));
+    if (child < B_OK) {
+        WTFLogAlways("Unable to spawn a new child process: %s", strerror(child));
+        CRASH();
+    }
+    resume_thread(child);
+
+    // The child has its own reference to the client socket now.
+    RELEASE_ASSERT(!closeWithRetry(socketPair.client));
+
+    // On Haiku a team_id doubles as the POSIX process ID.
+    m_processID = child;
+
+    // We've finished launching the process, message back to the main run loop.
+    RunLoop::main().dispatch([protectedThis = Ref { *this }, this, serverSocket = socketPair.server] {
+        didFinishLaunchingProcess(m_processID, IPC::Connection::Identifier { serverSocket });
+    });
+}
+
+void ProcessLauncher::terminateProcess()
+{
+    if (m_isLaunching) {
+        invalidate();
+        return;
+    }
+
+    if (!m_processID)
+        return;
+
+    kill(m_processID, SIGKILL);
+    m_processID = 0;
+}
+
+void ProcessLauncher::platformInvalidate()
+{
+}
+
+} // namespace WebKit
@@ -1339,7 +1339,14 @@ void WebProcessPool::didReachGoodTimeToPrewarm()
 {
     loadRestrictedOpenerTypeDataIfNeeded();
 
-    if (!configuration().isAutomaticProcessWarmingEnabled() || !configuration().processSwapsOnNavigation() || usesSingleWebProcess())
+#if PLATFORM(HAIKU)
+    // On Haiku the spare is consumed by new tabs rather than navigation
+    // swaps, so prewarming is useful even without processSwapsOnNavigation.
+    bool prewarmingIsUseful = true;
+#else
+    bool prewarmingIsUseful = configuration().processSwapsOnNavigation();
+#endif
+    if (!configuration().isAutomaticProcessWarmingEnabled() || !prewarmingIsUseful || usesSingleWebProcess())
         return;
 
     if (MemoryPressureHandler::singleton().isUnderMemoryPressure()) {
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2024 Haiku, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "BackingStore.h"
+
+#include "UpdateInfo.h"
+#include <WebCore/FloatRect.h>
+#include <WebCore/ShareableBitmap.h>
+
+#include <Bitmap.h>
+#include <View.h>
+
+namespace WebKit {
+using namespace WebCore;
+
+BackingStore::BackingStore(const IntSize& size, float deviceScaleFactor)
+    : m_size(size)
+    , m_deviceScaleFactor(deviceScaleFactor)
+{
+    IntSize scaledSize(size);
+    scaledSize.scale(deviceScaleFactor);
+
+    m_bitmap = new BBitmap(BRect(0, 0, scaledSize.width() - 1, scaledSize.height() - 1),
+        B_RGBA32, true);
+    m_view = new BView(m_bitmap->Bounds(), "BackingStore", 0, 0);
+    m_bitmap->AddChild(m_view);
+}
+
+BackingStore::~BackingStore()
+{
+    if (m_bitmap->Lock()) {
+        m_bitmap->RemoveChild(m_view);
+        m_bitmap->Unlock();
+    }
+    delete m_view;
+    delete m_bitmap;
+}
+
+void BackingStore::paint(BView* target, const IntRect& rect)
+{
+    // Push only the damaged rect to app_server; the store itself holds the
+    // rest of the view contents.
+    FloatRect sourceRect(rect);
+    sourceRect.scale(m_deviceScaleFactor);
+    target->DrawBitmap(m_bitmap, sourceRect, FloatRect(rect));
+}
+
+void BackingStore::incorporateUpdate(UpdateInfo&& updateInfo)
+{
+    ASSERT(m_size == updateInfo.viewSize);
+
+    if (!updateInfo.bitmapHandle)
+        return;
+
+    auto bitmap = ShareableBitmap::create(WTFMove(*updateInfo.bitmapHandle));
+    if (!bitmap)
+        return;
+
+    // The platform image aliases the bitmap's shared area, so incorporating
+    // an update copies only the damaged rects, never the whole view.
+    PlatformImagePtr image = bitmap->createPlatformImage();
+    if (!image || !image->IsValid())
+        return;
+
+    if (!m_bitmap->Lock())
+        return;
+
+    scroll(updateInfo.scrollRect, updateInfo.scrollOffset);
+
+    // Paint all update rects. They are in view coordinates; the incoming
+    // bitmap covers updateRectBounds at device scale.
+    IntPoint updateRectLocation = updateInfo.updateRectBounds.location();
+    for (const auto& updateRect : updateInfo.updateRects) {
+        FloatRect sourceRect(updateRect);
+        sourceRect.moveBy(-updateRectLocation);
+        sourceRect.scale(updateInfo.deviceScaleFactor);
+
+        FloatRect targetRect(updateRect);
+        targetRect.scale(updateInfo.deviceScaleFactor);
+
+        m_view->DrawBitmap(image.get(), sourceRect, targetRect);
+    }
+
+    m_view->Sync();
+    m_bitmap->Unlock();
+}
+
+void BackingStore::scroll(const IntRect& scrollRect, const IntSize& scrollOffset)
+{
+    // Called with the bitmap locked by incorporateUpdate().
+    if (scrollOffset.isZero())
+        return;
+
+    IntRect targetRect = scrollRect;
+    targetRect.move(scrollOffset);
+    targetRect.intersect(scrollRect);
+    if (targetRect.isEmpty())
+        return;
+
+    IntRect sourceRect = targetRect;
+    sourceRect.move(-scrollOffset);
+
+    FloatRect scaledSourceRect(sourceRect);
+    scaledSourceRect.scale(m_deviceScaleFactor);
+    FloatRect scaledTargetRect(targetRect);
+    scaledTargetRect.scale(m_deviceScaleFactor);
+
+    m_view->CopyBits(scaledSourceRect, scaledTargetRect);
+}
+
+} // namespace WebKit
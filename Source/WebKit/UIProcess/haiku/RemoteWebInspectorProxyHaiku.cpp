@@ -24,8 +24,86 @@
  */
 
 #include "config.h"
-#include "RemoteWebInspectorProxy.h"
+#include "RemoteWebInspectorUIProxy.h"
+
+#if ENABLE(REMOTE_INSPECTOR)
+
+#include <WebCore/CertificateInfo.h>
+#include <WebCore/FloatRect.h>
+#include <WebCore/InspectorFrontendClient.h>
+#include <WebCore/NotImplemented.h>
+#include <wtf/text/WTFString.h>
 
 namespace WebKit {
 
-};
+WebPageProxy* RemoteWebInspectorUIProxy::platformCreateFrontendPageAndWindow()
+{
+    notImplemented();
+    return nullptr;
+}
+
+void RemoteWebInspectorUIProxy::platformCloseFrontendPageAndWindow()
+{
+    notImplemented();
+}
+
+void RemoteWebInspectorUIProxy::platformResetState()
+{
+    notImplemented();
+}
+
+void RemoteWebInspectorUIProxy::platformBringToFront()
+{
+    notImplemented();
+}
+
+void RemoteWebInspectorUIProxy::platformSave(Vector<WebCore::InspectorFrontendClient::SaveData>&&, bool /* forceSaveAs */)
+{
+    notImplemented();
+}
+
+void RemoteWebInspectorUIProxy::platformLoad(const String&, CompletionHandler<void(const String&)>&& completionHandler)
+{
+    notImplemented();
+    completionHandler(nullString());
+}
+
+void RemoteWebInspectorUIProxy::platformPickColorFromScreen(CompletionHandler<void(const std::optional<WebCore::Color>&)>&& completionHandler)
+{
+    notImplemented();
+    completionHandler({ });
+}
+
+void RemoteWebInspectorUIProxy::platformSetSheetRect(const WebCore::FloatRect&)
+{
+    notImplemented();
+}
+
+void RemoteWebInspectorUIProxy::platformSetForcedAppearance(WebCore::InspectorFrontendClient::Appearance)
+{
+    notImplemented();
+}
+
+void RemoteWebInspectorUIProxy::platformStartWindowDrag()
+{
+    notImplemented();
+}
+
+void RemoteWebInspectorUIProxy::platformOpenURLExternally(const String&)
+{
+    notImplemented();
+}
+
+void RemoteWebInspectorUIProxy::platformRevealFileExternally(const String&)
+{
+    notImplemented();
+}
+
+void RemoteWebInspectorUIProxy::platformShowCertificate(const WebCore::CertificateInfo&)
+{
+    notImplemented();
+}
+
+} // namespace WebKit
+
+#endif // ENABLE(REMOTE_INSPECTOR)
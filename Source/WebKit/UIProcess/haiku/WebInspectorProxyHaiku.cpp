@@ -24,154 +24,168 @@
  */
 
 #include "config.h"
-#include "WebInspectorProxy.h"
+#include "WebInspectorUIProxy.h"
 
-#if ENABLE(INSPECTOR)
-
-#include "WebProcessProxy.h"
+#include "DebuggableInfoData.h"
+#include <WebCore/CertificateInfo.h>
+#include <WebCore/FloatRect.h>
+#include <WebCore/InspectorFrontendClient.h>
 #include <WebCore/NotImplemented.h>
-#include <WebKit/WKPage.h>
-#include <WebKit/WKPageGroup.h>
-#include <WebKit/WKString.h>
-#include <wtf/text/CString.h>
-#include <wtf/text/StringBuilder.h>
+#include <wtf/text/MakeString.h>
 #include <wtf/text/WTFString.h>
 
 namespace WebKit {
 
-void WebInspectorProxy::platformHide()
+static String inspectorBaseURL()
 {
     notImplemented();
+    return "file://"_s;
 }
 
-void WebInspectorProxy::platformResetState()
+String WebInspectorUIProxy::inspectorPageURL()
 {
-    notImplemented();
+    return makeString(inspectorBaseURL(), "/Main.html"_s);
 }
 
-void WebInspectorProxy::platformBringToFront()
+String WebInspectorUIProxy::inspectorTestPageURL()
 {
-    notImplemented();
+    return makeString(inspectorBaseURL(), "/Test.html"_s);
+}
+
+DebuggableInfoData WebInspectorUIProxy::infoForLocalDebuggable()
+{
+    auto data = DebuggableInfoData::empty();
+    data.debuggableType = Inspector::DebuggableType::WebPage;
+    return data;
 }
 
-bool WebInspectorProxy::platformIsFront()
+WebPageProxy* WebInspectorUIProxy::platformCreateFrontendPage()
 {
     notImplemented();
-    return false;
+    return nullptr;
 }
 
-void WebInspectorProxy::platformInspectedURLChanged(const String& url)
+void WebInspectorUIProxy::platformCreateFrontendWindow()
 {
     notImplemented();
 }
 
-String WebInspectorProxy::inspectorPageURL()
+void WebInspectorUIProxy::platformCloseFrontendPageAndWindow()
 {
-    StringBuilder builder;
-    builder.append(inspectorBaseURL());
-    builder.appendLiteral("/Main.html");
+    notImplemented();
+}
 
-    return builder.toString();
+void WebInspectorUIProxy::platformDidCloseForCrash()
+{
+    notImplemented();
 }
 
-String WebInspectorProxy::inspectorTestPageURL()
+void WebInspectorUIProxy::platformInvalidate()
 {
-    StringBuilder builder;
-    builder.append(inspectorBaseURL());
-    builder.appendLiteral("/Test.html");
+    notImplemented();
+}
 
-    return builder.toString();
+void WebInspectorUIProxy::platformResetState()
+{
+    notImplemented();
 }
 
-String WebInspectorProxy::inspectorBaseURL()
+void WebInspectorUIProxy::platformBringToFront()
 {
     notImplemented();
-    return "file://" /*+ WebCore::inspectorResourcePath()*/;
 }
 
-unsigned WebInspectorProxy::platformInspectedWindowHeight()
+void WebInspectorUIProxy::platformBringInspectedPageToFront()
 {
     notImplemented();
-    return 0;
 }
 
-unsigned WebInspectorProxy::platformInspectedWindowWidth()
+void WebInspectorUIProxy::platformHide()
 {
     notImplemented();
-    return 0;
 }
 
-void WebInspectorProxy::platformAttach()
+bool WebInspectorUIProxy::platformIsFront()
 {
     notImplemented();
+    return false;
 }
 
-void WebInspectorProxy::platformDetach()
+void WebInspectorUIProxy::platformAttachAvailabilityChanged(bool)
 {
     notImplemented();
 }
 
-void WebInspectorProxy::platformSetAttachedWindowHeight(unsigned)
+void WebInspectorUIProxy::platformSetForcedAppearance(WebCore::InspectorFrontendClient::Appearance)
 {
     notImplemented();
 }
 
-void WebInspectorProxy::platformSetAttachedWindowWidth(unsigned)
+void WebInspectorUIProxy::platformOpenURLExternally(const String&)
 {
     notImplemented();
 }
 
-void WebInspectorProxy::platformSave(const String&, const String&, bool, bool)
+void WebInspectorUIProxy::platformInspectedURLChanged(const String&)
 {
     notImplemented();
 }
 
-void WebInspectorProxy::platformAppend(const String&, const String&)
+void WebInspectorUIProxy::platformShowCertificate(const WebCore::CertificateInfo&)
 {
     notImplemented();
 }
 
-void WebInspectorProxy::platformAttachAvailabilityChanged(bool)
+void WebInspectorUIProxy::platformAttach()
 {
     notImplemented();
 }
 
-void WebInspectorProxy::platformStartWindowDrag()
+void WebInspectorUIProxy::platformDetach()
 {
-	notImplemented();
+    notImplemented();
 }
 
-void WebInspectorProxy::platformCreateFrontendWindow()
+void WebInspectorUIProxy::platformSetAttachedWindowHeight(unsigned)
 {
-	notImplemented();
+    notImplemented();
 }
-void WebInspectorProxy::platformCloseFrontendPageAndWindow()
+
+void WebInspectorUIProxy::platformSetAttachedWindowWidth(unsigned)
 {
-	notImplemented();
+    notImplemented();
 }
 
-void WebInspectorProxy::platformShowCertificate(const WebCore::CertificateInfo&)
+void WebInspectorUIProxy::platformSetSheetRect(const WebCore::FloatRect&)
 {
-	notImplemented();
+    notImplemented();
 }
 
-void WebInspectorProxy::platformDidCloseForCrash()
+void WebInspectorUIProxy::platformStartWindowDrag()
 {
-	notImplemented();
+    notImplemented();
 }
-void WebInspectorProxy::platformInvalidate()
+
+void WebInspectorUIProxy::platformRevealFileExternally(const String&)
 {
-	notImplemented();
+    notImplemented();
 }
-void WebInspectorProxy::platformBringInspectedPageToFront()
+
+void WebInspectorUIProxy::platformSave(Vector<WebCore::InspectorFrontendClient::SaveData>&&, bool /* forceSaveAs */)
 {
-	notImplemented();
+    notImplemented();
 }
-WebPageProxy* WebInspectorProxy::platformCreateFrontendPage()
+
+void WebInspectorUIProxy::platformLoad(const String&, CompletionHandler<void(const String&)>&& completionHandler)
 {
-	notImplemented();
+    notImplemented();
+    completionHandler(nullString());
 }
 
+void WebInspectorUIProxy::platformPickColorFromScreen(CompletionHandler<void(const std::optional<WebCore::Color>&)>&& completionHandler)
+{
+    notImplemented();
+    completionHandler({ });
 }
 
-#endif
+} // namespace WebKit
@@ -28,12 +28,24 @@
 
 #include "WebProcessCreationParameters.h"
 #include <WebCore/NotImplemented.h>
+#include <wtf/RunLoop.h>
 
 namespace WebKit {
 
 void WebProcessPool::platformInitialize(NeedsGlobalStaticInitialization)
 {
-    notImplemented();
+    // Launching a web process here is slow (dynamic linking plus WebCore
+    // initialization), so when the embedder opted into automatic process
+    // warming, spawn the first spare right away instead of waiting for
+    // didReachGoodTimeToPrewarm() - otherwise the very first page still
+    // pays the full launch cost. Deferred to the run loop because the pool
+    // is not fully constructed yet at this point.
+    if (configuration().isAutomaticProcessWarmingEnabled()) {
+        RunLoop::main().dispatch([weakThis = WeakPtr { *this }] {
+            if (weakThis)
+                weakThis->prewarmProcess();
+        });
+    }
 }
 
 void WebProcessPool::platformInitializeNetworkProcess(NetworkProcessCreationParameters&)
@@ -635,7 +635,7 @@ void WebProcess::initializeWebProcess(WebProcessCreationParameters&& parameters,
     WebResourceLoadObserver::setShouldLogUserInteraction(parameters.shouldLogUserInteraction);
 #endif
 
-#if PLATFORM(COCOA)
+#if PLATFORM(COCOA) || PLATFORM(HAIKU)
     if (m_processType == ProcessType::PrewarmedWebContent)
         prewarmGlobally();
 #endif
@@ -33,18 +33,18 @@
 namespace WebKit {
 using namespace WebCore;
 
-class WebProcessMain final : public AuxiliaryProcessMainBase {
+class WebProcessMainHaiku final : public AuxiliaryProcessMainBase<WebProcess> {
 public:
     bool platformInitialize() override
     {
-        BApplication* app = new BApplication("application/x-vnd.haiku-webkit.webprocess");
+        new BApplication("application/x-vnd.haiku-webkit.webprocess");
         return true;
     }
 };
 
-int WebProcessMainUnix(int argc, char** argv)
+int WebProcessMain(int argc, char** argv)
 {
-    return AuxiliaryProcessMain<WebProcess, WebProcessMain>(argc, argv);
+    return AuxiliaryProcessMain<WebProcessMainHaiku>(argc, argv);
 }
 
 } // namespace WebKit
@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2026 Haiku, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE COMPUTER, INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE COMPUTER, INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "WebAutofill.h"
+
+#include <Autolock.h>
+#include <Directory.h>
+#include <FindDirectory.h>
+#include <Path.h>
+
+#include <algorithm>
+#include <ctype.h>
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+
+class BWebAutofill::Index {
+public:
+	struct Entry {
+		BString value;
+		uint32 frequency;
+	};
+
+	// Per field name, values keyed by their lowercased text. std::map keeps
+	// the keys sorted, so a prefix query is a lower_bound plus a scan while
+	// the key keeps the prefix.
+	std::map<std::string, std::map<std::string, Entry> > fields;
+};
+
+
+static std::string
+lowercased(const BString& text)
+{
+	std::string result(text.String());
+	for (size_t i = 0; i < result.size(); i++)
+		result[i] = tolower(result[i]);
+	return result;
+}
+
+
+static status_t
+indexFilePath(BPath& path)
+{
+	status_t result = find_directory(B_USER_SETTINGS_DIRECTORY, &path);
+	if (result != B_OK)
+		return result;
+	path.Append("WebKit/Autofill");
+	return B_OK;
+}
+
+
+// #pragma mark - BWebAutofill
+
+
+BWebAutofill::BWebAutofill()
+	:
+	fLock("web autofill"),
+	fIndex(new Index())
+{
+	_Load();
+}
+
+
+BWebAutofill::~BWebAutofill()
+{
+	delete fIndex;
+}
+
+
+/*static*/ BWebAutofill*
+BWebAutofill::Default()
+{
+	static BWebAutofill sDefaultAutofill;
+	return &sDefaultAutofill;
+}
+
+
+void
+BWebAutofill::AddEntry(const BString& fieldName, const BString& value)
+{
+	if (fieldName.Length() == 0 || value.Length() == 0)
+		return;
+
+	BAutolock locker(fLock);
+
+	Index::Entry& entry
+		= fIndex->fields[lowercased(fieldName)][lowercased(value)];
+	if (entry.frequency == 0)
+		entry.value = value;
+	entry.frequency++;
+
+	_Save();
+}
+
+
+void
+BWebAutofill::FindCompletions(const BString& fieldName, const BString& prefix,
+	int32 maxResults, std::vector<BString>& results) const
+{
+	results.clear();
+	if (maxResults <= 0)
+		return;
+
+	BAutolock locker(fLock);
+
+	std::map<std::string, std::map<std::string, Index::Entry> >::const_iterator
+		field = fIndex->fields.find(lowercased(fieldName));
+	if (field == fIndex->fields.end())
+		return;
+
+	std::string key = lowercased(prefix);
+	std::vector<const Index::Entry*> matches;
+	std::map<std::string, Index::Entry>::const_iterator it
+		= field->second.lower_bound(key);
+	for (; it != field->second.end()
+			&& it->first.compare(0, key.size(), key) == 0; ++it) {
+		matches.push_back(&it->second);
+	}
+
+	std::sort(matches.begin(), matches.end(),
+		[](const Index::Entry* a, const Index::Entry* b) {
+			return a->frequency > b->frequency;
+		});
+
+	if (matches.size() > (size_t)maxResults)
+		matches.resize(maxResults);
+
+	results.reserve(matches.size());
+	for (size_t i = 0; i < matches.size(); i++)
+		results.push_back(matches[i]->value);
+}
+
+
+void
+BWebAutofill::Clear()
+{
+	BAutolock locker(fLock);
+
+	delete fIndex;
+	fIndex = new Index();
+	_Save();
+}
+
+
+// One entry per line: "<frequency>\t<field>\t<value>". Fields and values
+// never contain tabs or newlines (the editor client only records single
+// line text-field input), so no escaping is needed.
+void
+BWebAutofill::_Load()
+{
+	BPath path;
+	if (indexFilePath(path) != B_OK)
+		return;
+
+	FILE* file = fopen(path.Path(), "r");
+	if (file == NULL)
+		return;
+
+	char line[4096];
+	while (fgets(line, sizeof(line), file) != NULL) {
+		char* end = strchr(line, '\n');
+		if (end != NULL)
+			*end = '\0';
+
+		char* field = strchr(line, '\t');
+		if (field == NULL)
+			continue;
+		*field++ = '\0';
+		char* value = strchr(field, '\t');
+		if (value == NULL)
+			continue;
+		*value++ = '\0';
+
+		uint32 frequency = strtoul(line, NULL, 10);
+		if (frequency == 0 || *field == '\0' || *value == '\0')
+			continue;
+
+		Index::Entry& entry
+			= fIndex->fields[lowercased(BString(field))]
+				[lowercased(BString(value))];
+		entry.value = value;
+		entry.frequency += frequency;
+	}
+	fclose(file);
+}
+
+
+void
+BWebAutofill::_Save()
+{
+	BPath path;
+	if (indexFilePath(path) != B_OK)
+		return;
+
+	BPath parent;
+	if (path.GetParent(&parent) == B_OK)
+		create_directory(parent.Path(), 0755);
+
+	FILE* file = fopen(path.Path(), "w");
+	if (file == NULL)
+		return;
+
+	std::map<std::string, std::map<std::string, Index::Entry> >::const_iterator
+		field = fIndex->fields.begin();
+	for (; field != fIndex->fields.end(); ++field) {
+		std::map<std::string, Index::Entry>::const_iterator it
+			= field->second.begin();
+		for (; it != field->second.end(); ++it) {
+			fprintf(file, "%" B_PRIu32 "\t%s\t%s\n", it->second.frequency,
+				field->first.c_str(), it->second.value.String());
+		}
+	}
+	fclose(file);
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2026 Haiku, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE COMPUTER, INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE COMPUTER, INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _WEB_AUTOFILL_H_
+#define _WEB_AUTOFILL_H_
+
+
+#include <Locker.h>
+#include <String.h>
+
+#include <vector>
+
+
+// Process-wide index of previously submitted text-field values, fed by the
+// editor client when editing of a field finishes. Values are indexed per
+// field name in a sorted structure with frequency weights, so
+// FindCompletions() answers a prefix query in memory instead of the
+// embedder rescanning its stored entries on every focus event. Password
+// fields and fields with autocomplete disabled are never recorded.
+//
+// The index is persisted to a compact line-based file under the user
+// settings directory, loaded once at startup and rewritten when entries
+// are added. Recording happens on the application thread and lookups
+// typically on a window thread; the index locks internally.
+class __attribute__ ((visibility ("default"))) BWebAutofill {
+public:
+	static	BWebAutofill*		Default();
+
+	// Records one submitted value for the named field, bumping its
+	// frequency if it was seen before.
+			void				AddEntry(const BString& fieldName,
+									const BString& value);
+
+	// Fills `results` with up to maxResults previously recorded values
+	// for the field whose text starts with `prefix` (case-insensitive),
+	// most frequently used first.
+			void				FindCompletions(const BString& fieldName,
+									const BString& prefix, int32 maxResults,
+									std::vector<BString>& results) const;
+
+			void				Clear();
+
+private:
+								BWebAutofill();
+								~BWebAutofill();
+
+			void				_Load();
+			void				_Save();
+
+private:
+	mutable	BLocker				fLock;
+
+			class Index;
+			Index*				fIndex;
+};
+
+#endif // _WEB_AUTOFILL_H_
@@ -45,8 +45,10 @@
 #include "WebCore/FrameLoadRequest.h"
 #include "WebCore/FrameLoader.h"
 #include "WebCore/FrameView.h"
+#include "WebCore/GraphicsContextHaiku.h"
 #include "WebCore/HTMLFrameOwnerElement.h"
 #include "WebCore/Page.h"
+#include "WebCore/PrintContext.h"
 #include "WebCore/ProgressTracker.h"
 #include "WebCore/Range.h"
 #include "WebCore/RenderObject.h"
@@ -74,6 +76,8 @@ BWebFrame::BWebFrame(BWebPage* webPage, BWebFrame* parentFrame,
     : fZoomFactor(1.0)
     , fIsEditable(false)
     , fTitle(0)
+    , fPrintContext(nullptr)
+    , fPrintPageWidth(0)
     , fData(data)
 {
     if (!parentFrame) {
@@ -92,6 +96,7 @@ BWebFrame::BWebFrame(BWebPage* webPage, BWebFrame* parentFrame,
 
 BWebFrame::~BWebFrame()
 {
+    EndPrinting();
     delete fData;
 }
 
@@ -408,6 +413,49 @@ JSGlobalContextRef BWebFrame::GlobalContext() const
 }
 
 
+int32 BWebFrame::BeginPrinting(float pageWidth, float pageHeight)
+{
+    if (!fData->frame || !fData->frame->document())
+        return 0;
+
+    EndPrinting();
+
+    fPrintContext = new WebCore::PrintContext(fData->frame.get());
+    fPrintContext->begin(pageWidth, pageHeight);
+    fPrintContext->computePageRectsWithPageSize(
+        WebCore::FloatSize(pageWidth, pageHeight), false);
+    fPrintPageWidth = pageWidth;
+    return fPrintContext->pageCount();
+}
+
+
+void BWebFrame::SpoolPage(BView* target, int32 pageIndex)
+{
+    if (!fPrintContext || pageIndex < 0
+        || static_cast<size_t>(pageIndex) >= fPrintContext->pageCount()) {
+        return;
+    }
+
+    // spoolPage() translates to the page's rect and applies the shrink
+    // factor; the target only needs its own scale (e.g. printer DPI / 72,
+    // or a preview reduction) pre-applied by the caller.
+    WebCore::GraphicsContextHaiku context(target);
+    fPrintContext->spoolPage(context, pageIndex, fPrintPageWidth);
+    target->Sync();
+}
+
+
+void BWebFrame::EndPrinting()
+{
+    if (!fPrintContext)
+        return;
+
+    fPrintContext->end();
+    delete fPrintContext;
+    fPrintContext = nullptr;
+}
+
+
 WebCore::LocalFrame* BWebFrame::Frame() const
 {
     return fData->frame.get();
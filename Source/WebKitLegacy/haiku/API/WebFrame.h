@@ -36,6 +36,7 @@
 #include <JavaScriptCore/APICast.h>
 
 class BMessenger;
+class BView;
 class BWebPage;
 
 namespace WebCore {
@@ -45,6 +46,7 @@ class DumpRenderTreeClient;
 class Frame;
 class FrameLoaderClientHaiku;
 class HTMLFrameOwnerElement;
+class PrintContext;
 }
 
 namespace WTF {
@@ -115,6 +117,21 @@ public:
             const char*         Name() const;
 
 			JSGlobalContextRef	GlobalContext() const;
+
+			// Paginated printing. BeginPrinting() relayouts the document for
+			// the given page size (in points, i.e. 1/72") and returns the
+			// page count; SpoolPage() then renders one page into the target
+			// view, which the caller hands to BPrintJob::DrawView() and
+			// BPrintJob::SpoolPage(). Rendering page-at-a-time this way lets
+			// the application keep servicing its window loop (and stream
+			// finished pages to the spooler) between pages instead of
+			// rasterizing the whole document in one blocking pass. A scaled
+			// preview can be produced by spooling into a view with a scaled
+			// coordinate system. EndPrinting() restores screen layout.
+			int32				BeginPrinting(float pageWidth,
+									float pageHeight);
+			void				SpoolPage(BView* target, int32 pageIndex);
+			void				EndPrinting();
 private:
 	friend class BWebView;
 	friend class BWebPage;
@@ -141,6 +158,9 @@ private:
 			BString				fTitle;
 mutable		BString				fName;
 
+			WebCore::PrintContext*	fPrintContext;
+			float				fPrintPageWidth;
+
 			WebFramePrivate*	fData;
 };
 
@@ -0,0 +1,248 @@
+/*
+ * Copyright (C) 2026 Haiku, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE COMPUTER, INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE COMPUTER, INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "WebHistory.h"
+
+#include <Autolock.h>
+#include <OS.h>
+
+#include <algorithm>
+#include <ctype.h>
+#include <map>
+#include <set>
+#include <string>
+
+
+BWebHistoryItem::BWebHistoryItem(const BString& url, bigtime_t lastVisitTime,
+	uint32 visitCount)
+	:
+	fURL(url),
+	fLastVisitTime(lastVisitTime),
+	fVisitCount(visitCount)
+{
+}
+
+
+// #pragma mark - BWebHistory::Index
+
+
+class BWebHistory::Index {
+public:
+	// Columnar storage: row i describes one distinct URL. Queries only walk
+	// the columns they need, and candidate rows are ranked without pulling
+	// the URL strings into cache until the final copy-out.
+	std::vector<BString> urls;
+	std::vector<bigtime_t> lastVisitTimes;
+	std::vector<uint32> visitCounts;
+
+	std::map<std::string, uint32> rowsByURL;
+
+	// Sorted token index over the URL text; prefix queries are a
+	// lower_bound plus a scan while the key keeps the prefix.
+	std::map<std::string, std::vector<uint32> > rowsByToken;
+};
+
+
+static void
+tokenize(const char* text, std::vector<std::string>& tokens)
+{
+	std::string current;
+	for (; *text != '\0'; text++) {
+		char c = *text;
+		if (isalnum(c)) {
+			current += tolower(c);
+			continue;
+		}
+		if (!current.empty()) {
+			tokens.push_back(current);
+			current.clear();
+		}
+	}
+	if (!current.empty())
+		tokens.push_back(current);
+}
+
+
+// #pragma mark - BWebHistory
+
+
+BWebHistory::BWebHistory()
+	:
+	fLock("web history"),
+	fIndex(new Index())
+{
+}
+
+
+BWebHistory::~BWebHistory()
+{
+	delete fIndex;
+}
+
+
+/*static*/ BWebHistory*
+BWebHistory::Default()
+{
+	static BWebHistory sDefaultHistory;
+	return &sDefaultHistory;
+}
+
+
+void
+BWebHistory::AddVisit(const BString& url)
+{
+	AddVisit(url, real_time_clock_usecs(), 1);
+}
+
+
+void
+BWebHistory::AddVisit(const BString& url, bigtime_t visitTime,
+	uint32 visitCount)
+{
+	if (url.Length() == 0 || visitCount == 0)
+		return;
+
+	BAutolock locker(fLock);
+
+	std::string key(url.String());
+	std::map<std::string, uint32>::iterator found
+		= fIndex->rowsByURL.find(key);
+	if (found != fIndex->rowsByURL.end()) {
+		uint32 row = found->second;
+		fIndex->visitCounts[row] += visitCount;
+		if (visitTime > fIndex->lastVisitTimes[row])
+			fIndex->lastVisitTimes[row] = visitTime;
+		return;
+	}
+
+	uint32 row = fIndex->urls.size();
+	fIndex->urls.push_back(url);
+	fIndex->lastVisitTimes.push_back(visitTime);
+	fIndex->visitCounts.push_back(visitCount);
+	fIndex->rowsByURL[key] = row;
+
+	_IndexTokens(url, row);
+}
+
+
+void
+BWebHistory::Clear()
+{
+	BAutolock locker(fLock);
+
+	delete fIndex;
+	fIndex = new Index();
+}
+
+
+int32
+BWebHistory::CountItems() const
+{
+	BAutolock locker(fLock);
+
+	return fIndex->urls.size();
+}
+
+
+void
+BWebHistory::FindMatches(const BString& query, int32 maxResults,
+	std::vector<BWebHistoryItem>& results) const
+{
+	results.clear();
+	if (maxResults <= 0)
+		return;
+
+	BAutolock locker(fLock);
+
+	std::vector<std::string> terms;
+	tokenize(query.String(), terms);
+
+	std::vector<uint32> candidates;
+	if (terms.empty()) {
+		// Nothing tokenizable (pure punctuation, say "://"); scan the URL
+		// column for the raw substring instead.
+		for (uint32 row = 0; row < fIndex->urls.size(); row++) {
+			if (fIndex->urls[row].IFindFirst(query) >= 0)
+				candidates.push_back(row);
+		}
+	} else {
+		// Every term must prefix-match some token of the URL; intersect
+		// the per-term row sets.
+		std::map<uint32, uint32> matchedTerms;
+		for (uint32 i = 0; i < terms.size(); i++) {
+			const std::string& term = terms[i];
+			std::set<uint32> rows;
+			std::map<std::string, std::vector<uint32> >::const_iterator it
+				= fIndex->rowsByToken.lower_bound(term);
+			for (; it != fIndex->rowsByToken.end()
+					&& it->first.compare(0, term.size(), term) == 0; ++it) {
+				rows.insert(it->second.begin(), it->second.end());
+			}
+			for (std::set<uint32>::const_iterator row = rows.begin();
+					row != rows.end(); ++row) {
+				if (matchedTerms[*row] == i)
+					matchedTerms[*row]++;
+			}
+		}
+		for (std::map<uint32, uint32>::const_iterator it
+				= matchedTerms.begin(); it != matchedTerms.end(); ++it) {
+			if (it->second == terms.size())
+				candidates.push_back(it->first);
+		}
+	}
+
+	// Most visited first, most recent visit breaking ties.
+	const Index* index = fIndex;
+	std::sort(candidates.begin(), candidates.end(),
+		[index](uint32 a, uint32 b) {
+			if (index->visitCounts[a] != index->visitCounts[b])
+				return index->visitCounts[a] > index->visitCounts[b];
+			return index->lastVisitTimes[a] > index->lastVisitTimes[b];
+		});
+
+	if (candidates.size() > (size_t)maxResults)
+		candidates.resize(maxResults);
+
+	results.reserve(candidates.size());
+	for (uint32 i = 0; i < candidates.size(); i++) {
+		uint32 row = candidates[i];
+		results.push_back(BWebHistoryItem(fIndex->urls[row],
+			fIndex->lastVisitTimes[row], fIndex->visitCounts[row]));
+	}
+}
+
+
+void
+BWebHistory::_IndexTokens(const BString& url, uint32 row)
+{
+	std::vector<std::string> tokens;
+	tokenize(url.String(), tokens);
+
+	for (uint32 i = 0; i < tokens.size(); i++) {
+		std::vector<uint32>& rows = fIndex->rowsByToken[tokens[i]];
+		if (rows.empty() || rows.back() != row)
+			rows.push_back(row);
+	}
+}
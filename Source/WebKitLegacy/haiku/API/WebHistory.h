@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 Haiku, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE COMPUTER, INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE COMPUTER, INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _WEB_HISTORY_H_
+#define _WEB_HISTORY_H_
+
+
+#include <Locker.h>
+#include <String.h>
+
+#include <vector>
+
+
+// One visited page as returned by BWebHistory queries.
+class __attribute__ ((visibility ("default"))) BWebHistoryItem {
+public:
+								BWebHistoryItem(const BString& url,
+									bigtime_t lastVisitTime,
+									uint32 visitCount);
+
+			const BString&		URL() const { return fURL; }
+			bigtime_t			LastVisitTime() const
+									{ return fLastVisitTime; }
+			uint32				VisitCount() const { return fVisitCount; }
+
+private:
+			BString				fURL;
+			bigtime_t			fLastVisitTime;
+			uint32				fVisitCount;
+};
+
+
+// Process-wide store of visited pages, fed by the frame loader whenever a
+// navigation is recorded in global history. URLs are kept in columnar
+// arrays (URL, last visit time, visit count) with a sorted token index on
+// the URL text, so FindMatches() answers omnibox-style prefix and
+// substring queries from memory without touching disk. The store is not
+// persisted; embedders that keep history on disk can replay it into the
+// index at startup through AddVisit().
+//
+// AddVisit() is called on the application thread and FindMatches() is
+// typically called from a window thread; the store locks internally.
+class __attribute__ ((visibility ("default"))) BWebHistory {
+public:
+	static	BWebHistory*		Default();
+
+	// Records a visit, creating the row on first sight of the URL and
+	// otherwise bumping its visit count. The two-argument form is meant
+	// for replaying previously persisted history.
+			void				AddVisit(const BString& url);
+			void				AddVisit(const BString& url,
+									bigtime_t visitTime, uint32 visitCount);
+
+			void				Clear();
+			int32				CountItems() const;
+
+	// Fills `results` with up to maxResults items whose URL matches the
+	// query, most frequently and most recently visited first. Each
+	// whitespace-separated query term must prefix-match a token of the
+	// URL; queries that tokenize to nothing fall back to a substring
+	// scan.
+			void				FindMatches(const BString& query,
+									int32 maxResults,
+									std::vector<BWebHistoryItem>& results) const;
+
+private:
+								BWebHistory();
+								~BWebHistory();
+
+			void				_IndexTokens(const BString& url, uint32 row);
+
+private:
+	mutable	BLocker				fLock;
+
+			class Index;
+			Index*				fIndex;
+};
+
+#endif // _WEB_HISTORY_H_
@@ -44,11 +44,16 @@
 #include "PageStorageSessionProvider.h"
 #include "PlatformStrategiesHaiku.h"
 #include "ProgressTrackerHaiku.h"
+#include "WebCacheStorageProvider.h"
 #include "pal/text/UnencodableHandling.h"
 
+#include "WebCore/BackForwardCache.h"
 #include "WebCore/BackForwardController.h"
-#include "WebCore/CacheStorageProvider.h"
+#include "WebCore/CachedResource.h"
+#include "WebCore/CachedResourceLoader.h"
+#include "WebCore/CharacterData.h"
 #include "WebCore/Chrome.h"
+#include "WebCore/CommonVM.h"
 #include "WebCore/ContextMenu.h"
 #include "WebCore/ContextMenuController.h"
 #include "WebCore/CookieJar.h"
@@ -59,6 +64,7 @@
 #include <WebCore/DummyStorageProvider.h>
 #include "WebCore/DummySpeechRecognitionProvider.h"
 #include "WebCore/DummyWebRTCProvider.h"
+#include "WebCore/Document.h"
 #include "WebCore/Editor.h"
 #include "WebCore/EmptyBadgeClient.h"
 #include "WebCore/EmptyClients.h"
@@ -66,17 +72,22 @@
 #include "WebCore/FileChooser.h"
 #include "WebCore/FocusController.h"
 #include "WebCore/FontCache.h"
+#include "WebCore/FontDescription.h"
 #include "WebCore/Frame.h"
 #include "WebCore/FrameLoader.h"
 #include "WebCore/FrameView.h"
+#include "WebCore/GCController.h"
 #include "WebCore/GraphicsContextHaiku.h"
 #include "WebCore/HandleUserInputEventResult.h"
 #include "WebCore/LibWebRTCProvider.h"
 #include "WebCore/LogInitialization.h"
 #include "WebCore/MediaRecorderProvider.h"
 #include "WebCore/MemoryCache.h"
+#include "WebCore/MemoryRelease.h"
 #include "WebNavigatorContentUtilsClient.h"
 #include "WebCore/MHTMLArchive.h"
+#include "WebCore/NetworkWaterfall.h"
+#include "WebCore/NodeTraversal.h"
 #include "WebCore/Page.h"
 #include "WebCore/PageConfiguration.h"
 #include "WebCore/PageGroup.h"
@@ -91,6 +102,7 @@
 #include "WebCore/RemoteFrameClient.h"
 #include "WebCore/ResourceHandle.h"
 #include "WebCore/ResourceRequest.h"
+#include "WebCore/ResourceUsageThread.h"
 #include "WebCore/ScriptController.h"
 #include "WebCore/Settings.h"
 #include "WebCore/ThreadGlobalData.h"
@@ -115,6 +127,8 @@
 #include "WebViewGroup.h"
 #include "WebVisitedLinkStore.h"
 
+#include <JavaScriptCore/VM.h>
+
 #include <Bitmap.h>
 #include <Entry.h>
 #include <FilePanel.h>
@@ -123,13 +137,32 @@
 #include <MenuItem.h>
 #include <Message.h>
 #include <app/MessageQueue.h>
+#include <MessageRunner.h>
 #include <Messenger.h>
+#include <NetworkAddress.h>
+#include <OS.h>
 #include <PopUpMenu.h>
 #include <Region.h>
+#include <Screen.h>
+#include <SecureSocket.h>
+#include <Socket.h>
+#include <Url.h>
 #include <Window.h>
 
+#include <algorithm>
+#include <fcntl.h>
+#include <image.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
 #include <wtf/text/AtomString.h>
+#include <wtf/text/AtomStringTable.h>
 #include <wtf/Assertions.h>
+#include <wtf/HashSet.h>
+#include <wtf/MemoryPressureHandler.h>
+#include <wtf/PerformanceCounter.h>
+#include <wtf/SystemTracing.h>
 #include <wtf/Threading.h>
 
 #if USE(GCRYPT)
@@ -159,7 +192,10 @@ enum {
 
     HANDLE_SET_VISIBLE = 'vsbl',
     HANDLE_DRAW = 'draw',
+    HANDLE_FRAME_TICK = 'frtk',
     HANDLE_FRAME_RESIZED = 'rszd',
+    HANDLE_PAINT_GATE_TIMEOUT = 'pgto',
+    HANDLE_DEFERRED_MOUSE_MOVED = 'dmmv',
 
     HANDLE_CHANGE_ZOOM_FACTOR = 'zmfr',
     HANDLE_FIND_STRING = 'find',
@@ -167,9 +203,22 @@ enum {
     HANDLE_SET_STATUS_MESSAGE = 'stsm',
     HANDLE_RESEND_NOTIFICATIONS = 'rsnt',
     HANDLE_SEND_EDITING_CAPABILITIES = 'sedc',
-    HANDLE_SEND_PAGE_SOURCE = 'spsc'
+    HANDLE_SEND_PAGE_SOURCE = 'spsc',
+    HANDLE_SEND_RESOURCE_USAGE = 'srus',
+    HANDLE_SUSPEND = 'sspd',
+    HANDLE_COMPACT_DOM_STRINGS = 'cdms',
+    HANDLE_SET_FRAME_TELEMETRY = 'sftm',
+    HANDLE_SET_MEMORY_TIMELINE = 'smtl',
+    HANDLE_SEND_MEMORY_TIMELINE = 'gmtl',
+    HANDLE_SET_LOAD_METRICS = 'slme',
+    HANDLE_GET_LOAD_METRICS = 'glme',
+    HANDLE_SEND_PERF_COUNTERS = 'spcs'
 };
 
+// Minimum time between two B_MOUSE_MOVED events reaching WebCore; one frame
+// at 60Hz. Moves arriving faster than this are coalesced.
+static const bigtime_t kMouseMovedInterval = 16000;
+
 using namespace WebCore;
 
 class EmptyPluginInfoProvider final : public PluginInfoProvider {
@@ -181,6 +230,101 @@ class EmptyPluginInfoProvider final : public PluginInfoProvider {
 BMessenger BWebPage::sDownloadListener;
 void WebKitInitializeLogChannelsIfNecessary();
 
+#if ENABLE(RESOURCE_USAGE)
+// Ring of memory samples recorded from the resource usage thread's
+// observer callback, which runs on the main thread — the same thread the
+// BWebPage handlers run on, so no locking is needed. 2400 samples at the
+// thread's 500ms cadence cover the last twenty minutes.
+struct BMemoryTimeline {
+    static const int32 kCapacity = 2400;
+
+    struct Sample {
+        bigtime_t when;
+        int64 dirty;
+        int64 gcHeap;
+        int64 gcOwned;
+        int64 images;
+        int64 layers;
+    };
+
+    WTF::Vector<Sample> samples;
+    // Once the ring is full, the oldest sample, which the next one replaces.
+    int32 oldest = 0;
+
+    void record(const ResourceUsageData& data)
+    {
+        Sample sample = {
+            system_time(),
+            (int64)data.totalDirtySize,
+            (int64)data.categories[MemoryCategory::GCHeap].totalSize(),
+            (int64)data.categories[MemoryCategory::GCOwned].totalSize(),
+            (int64)data.categories[MemoryCategory::Images].totalSize(),
+            (int64)data.categories[MemoryCategory::Layers].totalSize()
+        };
+
+        if (samples.size() < kCapacity)
+            samples.append(sample);
+        else {
+            samples[oldest] = sample;
+            oldest = (oldest + 1) % kCapacity;
+        }
+    }
+};
+#endif
+
+// How often the system-wide free page count is checked for pressure.
+static const WTF::Seconds kMemoryPressurePollInterval = WTF::Seconds(2);
+
+// Number of consecutive polls that found the system critically starved.
+static int sConsecutiveCriticalPolls = 0;
+
+/*static*/ void BWebPage::pollSystemMemoryPressure()
+{
+	system_info info;
+	if (get_system_info(&info) == B_OK && info.max_pages > 0) {
+		// When the whole system runs out of pages it does not matter
+		// whether it was us or another team that allocated them; shed
+		// caches either way.
+		float freeFraction = 1.0f - (float)info.used_pages / info.max_pages;
+		if (freeFraction < 0.05f) {
+			MemoryPressureHandler::singleton().triggerMemoryPressureEvent(true);
+			// The critical handler above already dropped every cache we
+			// own. If the next poll still finds the system starved, cache
+			// shedding was not enough; escalate to the application, which
+			// can suspend background tabs (the one thing we cannot decide
+			// here, since only the embedder knows which tabs matter).
+			if (++sConsecutiveCriticalPolls == 2)
+				broadcastMemoryPressure(true);
+		} else {
+			if (freeFraction < 0.1f)
+				MemoryPressureHandler::singleton().triggerMemoryPressureEvent(false);
+			if (sConsecutiveCriticalPolls >= 2)
+				broadcastMemoryPressure(false);
+			sConsecutiveCriticalPolls = 0;
+		}
+	}
+
+	RunLoop::main().dispatchAfter(kMemoryPressurePollInterval,
+		pollSystemMemoryPressure);
+}
+
+/*static*/ void BWebPage::broadcastMemoryPressure(bool critical)
+{
+	Page::forEachPage([critical](Page& page) {
+		ChromeClient& chromeClient = page.chrome().client();
+		if (chromeClient.isEmptyChromeClient()) {
+			// Internal pages (e.g. SVG images) have no embedder to notify.
+			return;
+		}
+		BWebPage* webPage
+			= static_cast<ChromeClientHaiku&>(chromeClient).webPage();
+		BMessage message(B_MEMORY_PRESSURE);
+		message.AddBool("critical", critical);
+		message.AddBool("visible", webPage->fPageVisible);
+		webPage->dispatchMessage(message);
+	});
+}
+
 /*static*/ void BWebPage::InitializeOnce()
 {
 	// NOTE: This needs to be called when the BApplication is ready.
@@ -206,9 +350,146 @@ void WebKitInitializeLogChannelsIfNecessary();
 
     WebVisitedLinkStore::setShouldTrackVisitedLinks(true);
 
+    // Shed caches under memory pressure instead of running into the OOM
+    // killer. The periodic monitor watches our own footprint and responds
+    // with graduated urgency (see MemoryUsagePolicy); pollSystemMemoryPressure()
+    // additionally watches the system-wide free pages.
+    auto& memoryPressureHandler = MemoryPressureHandler::singleton();
+    memoryPressureHandler.setLowMemoryHandler(
+        [](Critical critical, Synchronous synchronous) {
+            WebCore::releaseMemory(critical, synchronous);
+        });
+    memoryPressureHandler.setMemoryKillCallback([]() {
+        // In this single process port "killing the web process" would take
+        // the whole application down, so crossing the kill threshold is
+        // only logged.
+        WTFLogAlways("WebKit: memory footprint exceeded the kill threshold");
+    });
+    memoryPressureHandler.setShouldUsePeriodicMemoryMonitor(true);
+    memoryPressureHandler.install();
+
+    RunLoop::main().dispatchAfter(kMemoryPressurePollInterval,
+        pollSystemMemoryPressure);
+
     RunLoop::run(); // This attaches it to the existing be_app looper
 }
 
+/*static*/ void BWebPage::WarmUp()
+{
+	// NOTE: Must run on the same thread as InitializeOnce(); both the VM
+	// and the font caches belong to the WebCore main thread.
+
+	// Creating the common JavaScript VM is the largest single chunk of
+	// first-use initialization (interpreter setup, builtins, ...).
+	commonVM();
+
+	// Pull the family list out of app_server and prime the font cache with
+	// the fallback font, so the first style resolution does not stall on
+	// font matching.
+	int32 familyCount = count_font_families();
+	for (int32 i = 0; i < familyCount; i++) {
+		font_family family;
+		get_font_family(i, &family);
+	}
+	FontDescription description;
+	description.setComputedSize(16);
+	FontCache::forCurrentThread().lastResortFallbackFont(description);
+}
+
+static int32 prefetch_thread_entry(void* data)
+{
+	char* path = static_cast<char*>(data);
+
+	// Reading the file front to back pulls it into the file cache in one
+	// sequential sweep. The page faults taken while execution jumps around
+	// the image afterwards then hit the cache instead of seeking the disk
+	// for every 4kB page, which on rotating disks is the difference between
+	// streaming and thrashing.
+	int fd = open(path, O_RDONLY);
+	free(path);
+	if (fd >= 0) {
+		static const size_t kChunkSize = 1024 * 1024;
+		char* buffer = static_cast<char*>(malloc(kChunkSize));
+		if (buffer != NULL) {
+			while (read(fd, buffer, kChunkSize) > 0)
+				;
+			free(buffer);
+		}
+		close(fd);
+	}
+	return 0;
+}
+
+/*static*/ void BWebPage::PrefetchLibrary()
+{
+	// Find the image this very code lives in (the WebKit library); by the
+	// time an application can call us the runtime loader has mapped it, but
+	// almost all of it is still unfaulted.
+	image_info info;
+	int32 cookie = 0;
+	addr_t marker = (addr_t)&prefetch_thread_entry;
+	while (get_next_image_info(B_CURRENT_TEAM, &cookie, &info) == B_OK) {
+		if (marker < (addr_t)info.text
+			|| marker >= (addr_t)info.text + info.text_size) {
+			continue;
+		}
+
+		char* path = strdup(info.name);
+		if (path == NULL)
+			return;
+		thread_id thread = spawn_thread(prefetch_thread_entry,
+			"library prefetch", B_NORMAL_PRIORITY, path);
+		if (thread >= 0)
+			resume_thread(thread);
+		else
+			free(path);
+		return;
+	}
+}
+
+static int32 preconnect_thread_entry(void* data)
+{
+	BUrl* url = static_cast<BUrl*>(data);
+
+	bool secure = url->Protocol() == "https";
+	int32 port = url->HasPort() ? url->Port() : (secure ? 443 : 80);
+
+	// Resolving the name here already primes the system resolver cache;
+	// completing the connect additionally warms up the route and, for TLS,
+	// the certificate verification code paths. The socket itself cannot be
+	// handed over to the network kit, so it is simply closed again.
+	BNetworkAddress address(url->Host(), port);
+	if (address.InitCheck() == B_OK) {
+		if (secure) {
+			BSecureSocket socket;
+			socket.Connect(address, 10000000);
+		} else {
+			BSocket socket;
+			socket.Connect(address, 10000000);
+		}
+	}
+
+	delete url;
+	return 0;
+}
+
+/*static*/ void BWebPage::Preconnect(const char* urlString)
+{
+	BUrl* url = new BUrl(urlString);
+	if (!url->IsValid() || !url->HasHost()
+		|| (url->Protocol() != "http" && url->Protocol() != "https")) {
+		delete url;
+		return;
+	}
+
+	thread_id thread = spawn_thread(preconnect_thread_entry, "web preconnect",
+		B_LOW_PRIORITY, url);
+	if (thread >= B_OK)
+		resume_thread(thread);
+	else
+		delete url;
+}
+
 /*static*/ void BWebPage::ShutdownOnce()
 {
 	WebKit::iconDatabase().close();
@@ -225,6 +506,7 @@ void WebKitInitializeLogChannelsIfNecessary();
     uint32 cacheTotalCapacity;
     uint32 cacheMinDeadCapacity;
     uint32 cacheMaxDeadCapacity;
+    uint32 backForwardCacheSize;
     WTF::Seconds deadDecodedDataDeletionInterval;
 
     switch (model) {
@@ -232,12 +514,18 @@ void WebKitInitializeLogChannelsIfNecessary();
         cacheTotalCapacity = 0;
         cacheMinDeadCapacity = 0;
         cacheMaxDeadCapacity = 0;
+        backForwardCacheSize = 0;
         deadDecodedDataDeletionInterval = WTF::Seconds(0);
         break;
     case B_WEBKIT_CACHE_MODEL_WEB_BROWSER:
         cacheTotalCapacity = 32 * 1024 * 1024;
         cacheMinDeadCapacity = cacheTotalCapacity / 4;
         cacheMaxDeadCapacity = cacheTotalCapacity / 2;
+        // Frozen pages for instant back/forward navigation. Kept small:
+        // a cached page holds its whole DOM and render tree, and the
+        // memory pressure handler prunes these first when the system
+        // runs low.
+        backForwardCacheSize = 3;
         deadDecodedDataDeletionInterval = WTF::Seconds(60);
         break;
     default:
@@ -246,6 +534,7 @@ void WebKitInitializeLogChannelsIfNecessary();
 
     MemoryCache::singleton().setCapacities(cacheMinDeadCapacity, cacheMaxDeadCapacity, cacheTotalCapacity);
     MemoryCache::singleton().setDeadDecodedDataDeletionInterval(deadDecodedDataDeletionInterval);
+    BackForwardCache::singleton().setMaxSize(backForwardCacheSize);
 }
 
 
@@ -268,6 +557,16 @@ BWebPage::BWebPage(BWebView* webView, BPrivate::Network::BUrlContext* context)
     , fDisplayedStatusMessage()
     , fPageVisible(true)
     , fPageDirty(false)
+    , fFrameTelemetryEnabled(false)
+    , fMemoryTimeline(NULL)
+    , fPaintsSuppressed(false)
+    , fPaintGateRunner(NULL)
+    , fFramePacerSem(-1)
+    , fFramePacerThread(-1)
+    , fFrameScheduled(false)
+    , fLastMouseMovedTime(0)
+    , fDeferredMouseMovedMessage(NULL)
+    , fMouseMovedRunner(NULL)
     , fToolbarsVisible(true)
     , fStatusbarVisible(true)
     , fMenubarVisible(true)
@@ -294,7 +593,7 @@ BWebPage::BWebPage(BWebView* webView, BPrivate::Network::BUrlContext* context)
 #else
         makeUniqueRef<DummyWebRTCProvider>(),
 #endif
-        CacheStorageProvider::create(),
+        WebCacheStorageProvider::create(),
         viewGroup->userContentController(),
         BackForwardList::create(),
         CookieJar::create(storageProvider.copyRef()),
@@ -333,6 +632,10 @@ BWebPage::BWebPage(BWebView* webView, BPrivate::Network::BUrlContext* context)
     fPage = std::make_unique<WTF::Ref<Page>>(Page::create(WTFMove(pageClients)));
     storageProvider->setPage(fPage->get());
 
+    // Drives the paint gate: we hold back flushes to the view until the page
+    // has something worth looking at (see suppressPaintsUntilFirstVisualLayout()).
+    fPage->get().addLayoutMilestones({ LayoutMilestone::DidFirstVisuallyNonEmptyLayout });
+
 #if ENABLE(GEOLOCATION)
     WebCore::provideGeolocationTo(*fPage, new GeolocationClientMock());
 #endif
@@ -369,6 +672,24 @@ BWebPage::~BWebPage()
     // free'd. For sub-frames, we don't maintain them anyway, and for the
     // main frame, the same mechanism is used.
     delete fSettings;
+#if ENABLE(RESOURCE_USAGE)
+    if (fMemoryTimeline) {
+        ResourceUsageThread::removeObserver(fMemoryTimeline);
+        delete fMemoryTimeline;
+    }
+#endif
+    delete fPaintGateRunner;
+    delete fMouseMovedRunner;
+    delete fDeferredMouseMovedMessage;
+
+    // Stop the frame pacer thread: deleting the semaphore fails its
+    // acquire, which ends the loop.
+    if (fFramePacerSem >= 0)
+        delete_sem(fFramePacerSem);
+    if (fFramePacerThread >= 0) {
+        status_t result;
+        wait_for_thread(fFramePacerThread, &result);
+    }
 }
 
 // #pragma mark - public
@@ -475,6 +796,62 @@ void BWebPage::SendPageSource()
 	Looper()->PostMessage(HANDLE_SEND_PAGE_SOURCE, this);
 }
 
+void BWebPage::SendResourceUsage()
+{
+	Looper()->PostMessage(HANDLE_SEND_RESOURCE_USAGE, this);
+}
+
+status_t BWebPage::SuspendToSessionState(BDataIO& output)
+{
+    status_t result = SaveSessionState(output);
+    if (result != B_OK)
+        return result;
+
+    Looper()->PostMessage(HANDLE_SUSPEND, this);
+    return B_OK;
+}
+
+void BWebPage::CompactDOMStrings()
+{
+    Looper()->PostMessage(HANDLE_COMPACT_DOM_STRINGS, this);
+}
+
+void BWebPage::SetFrameTelemetryEnabled(bool enabled)
+{
+    BMessage message(HANDLE_SET_FRAME_TELEMETRY);
+    message.AddBool("enabled", enabled);
+    Looper()->PostMessage(&message, this);
+}
+
+void BWebPage::SetMemoryTimelineEnabled(bool enabled)
+{
+    BMessage message(HANDLE_SET_MEMORY_TIMELINE);
+    message.AddBool("enabled", enabled);
+    Looper()->PostMessage(&message, this);
+}
+
+void BWebPage::SendMemoryTimeline()
+{
+    Looper()->PostMessage(HANDLE_SEND_MEMORY_TIMELINE, this);
+}
+
+void BWebPage::SetLoadMetricsEnabled(bool enabled)
+{
+    BMessage message(HANDLE_SET_LOAD_METRICS);
+    message.AddBool("enabled", enabled);
+    Looper()->PostMessage(&message, this);
+}
+
+void BWebPage::GetLoadMetrics()
+{
+    Looper()->PostMessage(HANDLE_GET_LOAD_METRICS, this);
+}
+
+void BWebPage::SendPerfCounters()
+{
+    Looper()->PostMessage(HANDLE_SEND_PERF_COUNTERS, this);
+}
+
 void BWebPage::RequestDownload(const BString& url)
 {
 	ResourceRequest request(String::fromUTF8(url.String()));
@@ -536,6 +913,29 @@ status_t BWebPage::GetContentsAsMHTML(BDataIO& output)
         return B_ERROR;
 }
 
+status_t BWebPage::SaveSessionState(BDataIO& output)
+{
+    RefPtr<WebCore::SharedBuffer> state
+        = static_cast<BackForwardList&>(fPage->get().backForward().client()).saveState();
+    if (!state)
+        return B_ERROR;
+
+    ssize_t written = output.Write(state->data(), state->size());
+    if (written < 0 || (size_t)written != state->size())
+        return B_ERROR;
+    return B_OK;
+}
+
+status_t BWebPage::RestoreSessionState(const void* data, size_t size)
+{
+    if (data == NULL || !size)
+        return B_BAD_VALUE;
+
+    static_cast<BackForwardList&>(fPage->get().backForward().client()).restoreState(
+        std::span<const uint8_t>(static_cast<const uint8_t*>(data), size));
+    return B_OK;
+}
+
 // #pragma mark - BWebView API
 
 void BWebPage::setVisible(bool visible)
@@ -588,6 +988,7 @@ void BWebPage::mouseWheelChanged(const BMessage* message,
     const BPoint& where, const BPoint& screenWhere)
 {
     BMessage copiedMessage(*message);
+    copiedMessage.AddPointer("target", this);
     copiedMessage.AddPoint("be:view_where", where);
     copiedMessage.AddPoint("screen_where", screenWhere);
     copiedMessage.AddInt32("modifiers", modifiers());
@@ -796,6 +1197,15 @@ void BWebPage::paint(BRect rect, bool immediate)
         return;
     }
 
+    // While the paint gate is closed (early in a page load), only accumulate
+    // the dirty region. The gate is opened by the first visually non-empty
+    // layout, or by the timeout runner if the page never produces one.
+    if (fPaintsSuppressed) {
+        fSuppressedPaintRect = fSuppressedPaintRect.IsValid()
+            ? fSuppressedPaintRect | rect : rect;
+        return;
+    }
+
     // NOTE: fMainFrame can be 0 because init() eventually ends up calling
     // paint()! BWebFrame seems to cause an initial page to be loaded, maybe
     // this ought to be avoided also for start-up speed reasons!
@@ -807,10 +1217,16 @@ void BWebPage::paint(BRect rect, bool immediate)
     if (!view || !frame->contentRenderer())
         return;
 
+    // The telemetry samples are only taken while enabled, so the regular
+    // paint path does not pay for the clock reads.
+    bigtime_t updateStart = fFrameTelemetryEnabled ? system_time() : 0;
+
     page()->isolatedUpdateRendering();
 
     view->updateLayoutAndStyleIfNeededRecursive();
 
+    bigtime_t updateDone = fFrameTelemetryEnabled ? system_time() : 0;
+
     if (!fWebView->LockLooper())
         return;
     BView* offscreenView = fWebView->OffscreenView();
@@ -825,8 +1241,12 @@ void BWebPage::paint(BRect rect, bool immediate)
     }
 
     fWebView->UnlockLooper();
+
+    bigtime_t compositeStart = fFrameTelemetryEnabled ? system_time() : 0;
     MainFrame()->Frame()->view()->flushCompositingStateIncludingSubframes();
+    bigtime_t compositeDone = fFrameTelemetryEnabled ? system_time() : 0;
 
+    tracePoint(PagePaintStart);
     offscreenView->PushState();
     BRegion region(rect);
     offscreenView->ConstrainClippingRegion(&region);
@@ -839,6 +1259,23 @@ void BWebPage::paint(BRect rect, bool immediate)
     offscreenView->PopState();
     offscreenView->Sync();
     offscreenView->UnlockLooper();
+    tracePoint(PagePaintEnd);
+
+    if (fFrameTelemetryEnabled) {
+        bigtime_t paintDone = system_time();
+        BMessage timing(B_FRAME_TIMING);
+        timing.AddInt64("style layout us", updateDone - updateStart);
+        timing.AddInt64("composite us", compositeDone - compositeStart);
+        timing.AddInt64("paint us", paintDone - compositeDone);
+        timing.AddInt64("blit us", fWebView->LastBlitDuration());
+        // Cumulative since page creation; consumers diff successive frames
+        // to spot read-after-write (layout thrash) patterns in page script.
+        timing.AddInt64("forced layouts", fPage->get().forcedLayoutCount());
+        timing.AddInt64("forced layout us",
+            (int64)fPage->get().forcedLayoutDuration().microseconds());
+        timing.AddRect("rect", rect);
+        dispatchMessage(timing);
+    }
 
     // Notify the window that it can now pull the bitmap in its own thread
     fWebView->SetOffscreenViewClean(rect, immediate);
@@ -847,6 +1284,124 @@ void BWebPage::paint(BRect rect, bool immediate)
 }
 
 
+// Interval of one display refresh, from the current screen mode.
+static bigtime_t refreshInterval(const BScreen& screen)
+{
+    display_mode mode;
+    if (screen.GetMode(&mode) == B_OK && mode.timing.pixel_clock) {
+        uint64 framePixels = (uint64)mode.timing.h_total * mode.timing.v_total;
+        if (framePixels)
+            return framePixels * 1000 / mode.timing.pixel_clock; // kHz
+    }
+    return 16667; // Assume 60Hz when the mode is unavailable.
+}
+
+
+void BWebPage::scheduleFrame(const BRect& dirtyRect)
+{
+    fPendingDrawRect = fPendingDrawRect.IsValid()
+        ? fPendingDrawRect | dirtyRect : dirtyRect;
+
+    if (fFrameScheduled)
+        return;
+
+    if (fFramePacerThread < 0) {
+        if (fFramePacerSem < 0)
+            fFramePacerSem = create_sem(0, "frame pacer request");
+        if (fFramePacerSem >= 0)
+            fFramePacerThread = spawn_thread(framePacerEntry, "frame pacer",
+                B_DISPLAY_PRIORITY, this);
+        if (fFramePacerThread < 0) {
+            // No pacing available; paint right away like before.
+            BRect rect = fPendingDrawRect;
+            fPendingDrawRect = BRect();
+            paint(rect, false);
+            return;
+        }
+        resume_thread(fFramePacerThread);
+    }
+
+    fFrameScheduled = true;
+    release_sem(fFramePacerSem);
+}
+
+
+/*static*/ int32 BWebPage::framePacerEntry(void* self)
+{
+    static_cast<BWebPage*>(self)->framePacerLoop();
+    return 0;
+}
+
+
+// Paces rendering updates to the display: each requested frame waits for
+// the next retrace before it is painted, so animations driven by
+// requestAnimationFrame land once per refresh instead of beating against
+// it. Because the next frame is only requested after the previous paint
+// finished on the looper, a paint that overruns the refresh interval
+// skips to the following retrace rather than letting a backlog drift.
+void BWebPage::framePacerLoop()
+{
+    bigtime_t nextTick = 0;
+    while (acquire_sem(fFramePacerSem) == B_OK) {
+        BScreen screen;
+        bigtime_t interval = refreshInterval(screen);
+
+        // Drivers without a retrace semaphore fail immediately; pace on
+        // the refresh interval of the screen mode ourselves then.
+        if (screen.WaitForRetrace(2 * interval) != B_OK) {
+            bigtime_t now = system_time();
+            if (nextTick <= now)
+                nextTick = now + interval;
+            snooze_until(nextTick, B_SYSTEM_TIMEBASE);
+            nextTick += interval;
+        }
+
+        BMessage tick(HANDLE_FRAME_TICK);
+        BMessenger(this).SendMessage(&tick);
+    }
+}
+
+
+void BWebPage::suppressPaintsUntilFirstVisualLayout()
+{
+    if (fPaintsSuppressed)
+        return;
+
+    fPaintsSuppressed = true;
+    fSuppressedPaintRect = BRect();
+
+    // During the early phase of a load the engine invalidates the view many
+    // times while there is nothing meaningful to show yet. Swallowing these
+    // repaints until WebCore reports the first visually non-empty layout
+    // saves a lot of redundant painting on slow machines. The runner is a
+    // safety net so a page that never reaches the milestone (blank pages,
+    // load errors, ...) does not keep the view frozen.
+    delete fPaintGateRunner;
+    BMessage timeout(HANDLE_PAINT_GATE_TIMEOUT);
+    fPaintGateRunner = new BMessageRunner(BMessenger(this), &timeout,
+        500000 /* µs */, 1);
+}
+
+
+void BWebPage::releasePaintGate()
+{
+    if (!fPaintsSuppressed)
+        return;
+
+    fPaintsSuppressed = false;
+    delete fPaintGateRunner;
+    fPaintGateRunner = NULL;
+
+    BRect dirty = fSuppressedPaintRect;
+    fSuppressedPaintRect = BRect();
+    if (dirty.IsValid())
+        paint(dirty, false);
+
+    BMessage message(FIRST_PAINT);
+    dispatchMessage(message);
+}
+
+
 void BWebPage::scroll(int xOffset, int yOffset, const BRect& rectToScroll,
        const BRect& clipRect)
 {
@@ -887,9 +1442,14 @@ void BWebPage::scroll(int xOffset, int yOffset, const BRect& rectToScroll,
         rectAtDst.OffsetBy(xOffset, yOffset);
 
         offscreenView->CopyBits(rectAtSrc, rectAtDst);
+        offscreenView->Sync();
     }
 
     bitmap->Unlock();
+
+    // Push the scrolled pixels to the front buffer right away; the strip
+    // exposed by the scroll is published by the paint() that follows.
+    fWebView->_PublishFrame(clip);
 }
 
 
@@ -1019,9 +1579,20 @@ void BWebPage::MessageReceived(BMessage* message)
             message->FindRect("update rect", &rect);
             updateRect = updateRect | rect;
         }
-        paint(updateRect, false);
+        scheduleFrame(updateRect);
+        break;
+    }
+    case HANDLE_FRAME_TICK: {
+        fFrameScheduled = false;
+        BRect rect = fPendingDrawRect;
+        fPendingDrawRect = BRect();
+        if (rect.IsValid())
+            paint(rect, false);
         break;
     }
+    case HANDLE_PAINT_GATE_TIMEOUT:
+        releasePaintGate();
+        break;
     case HANDLE_FRAME_RESIZED:
         skipToLastMessage(message);
         handleFrameResized(message);
@@ -1034,16 +1605,73 @@ void BWebPage::MessageReceived(BMessage* message)
         handleActivated(message);
         break;
 
-    case B_MOUSE_MOVED:
+    case B_MOUSE_MOVED: {
         skipToLastMessage(message);
-        // fall through
+
+        // Even with the queue collapsed above, a fast-moving mouse can
+        // trigger several hundred hit tests per second. Allow only one move
+        // per (60Hz) frame; a move arriving too early is parked and
+        // delivered at the frame boundary, so the final hover position is
+        // never lost.
+        bigtime_t now = system_time();
+        if (now - fLastMouseMovedTime < kMouseMovedInterval) {
+            delete fDeferredMouseMovedMessage;
+            fDeferredMouseMovedMessage = new BMessage(*message);
+            if (fMouseMovedRunner == NULL) {
+                BMessage wakeup(HANDLE_DEFERRED_MOUSE_MOVED);
+                fMouseMovedRunner = new BMessageRunner(BMessenger(this),
+                    &wakeup, kMouseMovedInterval, 1);
+            }
+            break;
+        }
+        fLastMouseMovedTime = now;
+        handleMouseEvent(message);
+        break;
+    }
+    case HANDLE_DEFERRED_MOUSE_MOVED:
+        delete fMouseMovedRunner;
+        fMouseMovedRunner = NULL;
+        flushDeferredMouseMoved();
+        break;
     case B_MOUSE_DOWN:
     case B_MOUSE_UP:
+        // A parked move must not arrive after the click that followed it.
+        flushDeferredMouseMoved();
         handleMouseEvent(message);
         break;
-    case B_MOUSE_WHEEL_CHANGED:
+    case B_MOUSE_WHEEL_CHANGED: {
+        // Merge all queued wheel events into one by summing up their deltas,
+        // so a fast-spinning wheel triggers a single scroll and hit test
+        // instead of one per tick. Position and modifiers of the newest
+        // event win. (Haiku wheel messages carry no phase or momentum
+        // information we could forward.)
+        float deltaX = message->FindFloat("be:wheel_delta_x");
+        float deltaY = message->FindFloat("be:wheel_delta_y");
+        bool first = true;
+        BMessageQueue* queue = Looper()->MessageQueue();
+        int32 index = 0;
+        while (BMessage* nextMessage = queue->FindMessage(message->what, index)) {
+            BHandler* target = 0;
+            nextMessage->FindPointer("target", reinterpret_cast<void**>(&target));
+            if (target != this) {
+                index++;
+                continue;
+            }
+            deltaX += nextMessage->FindFloat("be:wheel_delta_x");
+            deltaY += nextMessage->FindFloat("be:wheel_delta_y");
+            if (!first)
+                delete message;
+            message = nextMessage;
+            queue->RemoveMessage(message);
+            first = false;
+        }
+        if (!first) {
+            message->ReplaceFloat("be:wheel_delta_x", deltaX);
+            message->ReplaceFloat("be:wheel_delta_y", deltaY);
+        }
         handleMouseWheelChanged(message);
         break;
+    }
     case B_KEY_DOWN:
     case B_KEY_UP:
         handleKeyEvent(message);
@@ -1069,6 +1697,42 @@ void BWebPage::MessageReceived(BMessage* message)
     case HANDLE_SEND_EDITING_CAPABILITIES:
         handleSendEditingCapabilities(message);
         break;
+    case HANDLE_SEND_RESOURCE_USAGE:
+        handleSendResourceUsage(message);
+        break;
+
+    case HANDLE_SUSPEND:
+        handleSuspend(message);
+        break;
+
+    case HANDLE_COMPACT_DOM_STRINGS:
+        handleCompactDOMStrings(message);
+        break;
+
+    case HANDLE_SET_FRAME_TELEMETRY:
+        handleSetFrameTelemetry(message);
+        break;
+
+    case HANDLE_SET_MEMORY_TIMELINE:
+        handleSetMemoryTimeline(message);
+        break;
+
+    case HANDLE_SEND_MEMORY_TIMELINE:
+        handleSendMemoryTimeline(message);
+        break;
+
+    case HANDLE_SET_LOAD_METRICS:
+        handleSetLoadMetrics(message);
+        break;
+
+    case HANDLE_GET_LOAD_METRICS:
+        handleGetLoadMetrics(message);
+        break;
+
+    case HANDLE_SEND_PERF_COUNTERS:
+        handleSendPerfCounters(message);
+        break;
+
     case HANDLE_SEND_PAGE_SOURCE:
         handleSendPageSource(message);
         break;
@@ -1137,6 +1801,18 @@ void BWebPage::skipToLastMessage(BMessage*& message)
     }
 }
 
+void BWebPage::flushDeferredMouseMoved()
+{
+    if (fDeferredMouseMovedMessage == NULL)
+        return;
+
+    BMessage* deferred = fDeferredMouseMovedMessage;
+    fDeferredMouseMovedMessage = NULL;
+    fLastMouseMovedTime = system_time();
+    handleMouseEvent(deferred);
+    delete deferred;
+}
+
 void BWebPage::handleLoadURL(const BMessage* message)
 {
     const char* urlString;
@@ -1171,6 +1847,12 @@ void BWebPage::handleSetVisible(const BMessage* message)
     message->FindBool("visible", &fPageVisible);
     if (fMainFrame->Frame()->view())
         fMainFrame->Frame()->view()->setParentVisible(fPageVisible);
+    // Propagate visibility into WebCore. Hiding suspends scripted
+    // (requestAnimationFrame) animations, pauses CSS and SVG animations
+    // (hiddenPageCSSAnimationSuspensionEnabled), aligns DOM timers to the
+    // one-second hidden-page interval, and fires visibilitychange so pages
+    // can pause their own media, instead of burning CPU in invisible views.
+    fPage->get().setIsVisible(fPageVisible);
     // Trigger an internal repaint if the page was supposed to be repainted
     // while it was invisible.
     if (fPageVisible && fPageDirty)
@@ -1185,7 +1867,13 @@ void BWebPage::handleFrameResized(const BMessage* message)
     message->FindFloat("height", &height);
 
     WebCore::LocalFrame* frame = fMainFrame->Frame();
-    frame->view()->resize(width + 1, height + 1);
+    // Only force a synchronous full-document layout when the size actually
+    // changed; spurious resize notifications would otherwise throw away any
+    // pending subtree-rooted layout and relayout the world.
+    WebCore::IntSize newSize(width + 1, height + 1);
+    if (frame->view()->frameRect().size() == newSize)
+        return;
+    frame->view()->resize(newSize);
     frame->view()->forceLayout();
     frame->view()->adjustViewSize();
 }
@@ -1206,8 +1894,16 @@ void BWebPage::handleActivated(const BMessage* message)
     bool activated;
     message->FindBool("activated", &activated);
 
-    FocusController& focusController = fPage->get().focusController();
-    focusController.setActive(activated);
+    // Update the page-level activity state rather than poking the focus
+    // controller directly: Page::setActivityState() forwards WindowIsActive
+    // to the focus controller and also lets the rest of WebCore (animation
+    // and timer throttling) see the change.
+    auto state = fPage->get().activityState();
+    if (activated)
+        state.add(ActivityState::WindowIsActive);
+    else
+        state.remove(ActivityState::WindowIsActive);
+    fPage->get().setActivityState(state);
 }
 
 
@@ -1447,6 +2143,21 @@ void BWebPage::handleFindString(BMessage* message)
     if (startInSelection)
         options.add(WebCore::FindOption::StartInSelection);
 
+    // Typeahead: when the new target merely extends the previous one (or
+    // shrinks it, after a backspace), the current match is almost always
+    // still the right anchor. Starting the search at the selection finds it
+    // immediately instead of re-walking the document text from the top on
+    // every keystroke, which dominates find latency on very large pages.
+    if (!startInSelection && fLastFindString.Length() && string.Length()) {
+        int32 prefixLength = std::min(string.Length(), fLastFindString.Length());
+        bool extendsPreviousFind = caseSensitive
+            ? !string.Compare(fLastFindString, prefixLength)
+            : !string.ICompare(fLastFindString, prefixLength);
+        if (extendsPreviousFind)
+            options.add(WebCore::FindOption::StartInSelection);
+    }
+    fLastFindString = string;
+
     bool result = fMainFrame->FindString(string, options);
 
     reply.AddBool("result", result);
@@ -1499,6 +2210,223 @@ void BWebPage::handleSendPageSource(BMessage*)
     dispatchMessage(message);
 }
 
+void BWebPage::handleSendResourceUsage(BMessage*)
+{
+    BMessage message(B_RESOURCE_USAGE_RESULT);
+
+    // All pages run in one VM, so the JS heap cannot be attributed to a
+    // single page; it is reported for context.
+    message.AddInt64("js heap bytes", WebCore::commonVM().heap.size());
+    message.AddInt64("js heap capacity", WebCore::commonVM().heap.capacity());
+
+    int32 documents = 0;
+    int64 domNodes = 0;
+    int64 resourceBytes = 0;
+    int64 decodedImageBytes = 0;
+
+    for (WebCore::Frame* frame = &fPage->get().mainFrame(); frame;
+            frame = frame->tree().traverseNext()) {
+        auto* localFrame = dynamicDowncast<WebCore::LocalFrame>(*frame);
+        if (!localFrame)
+            continue;
+        WebCore::Document* document = localFrame->document();
+        if (!document)
+            continue;
+
+        documents++;
+        for (WebCore::Node* node = document; node;
+                node = WebCore::NodeTraversal::next(*node))
+            domNodes++;
+
+        // The per-document resource map attributes cache entries to the
+        // pages that actually reference them, unlike the process-wide
+        // memory cache statistics.
+        for (const auto& resource : document->cachedResourceLoader().allCachedResources().values()) {
+            resourceBytes += resource->encodedSize();
+            if (resource->isImage())
+                decodedImageBytes += resource->decodedSize();
+        }
+    }
+
+    message.AddInt32("documents", documents);
+    message.AddInt64("dom nodes", domNodes);
+    message.AddInt64("render tree size", fPage->get().renderTreeSize());
+    message.AddInt64("resource bytes", resourceBytes);
+    message.AddInt64("decoded image bytes", decodedImageBytes);
+
+    BBitmap* backingStore = fWebView->OffscreenBitmap();
+    message.AddInt64("backing store bytes",
+        backingStore ? backingStore->BitsLength() : 0);
+
+    // Attribute names, values and class lists are interned in the
+    // thread-global atom table shared by every document, so like the JS
+    // heap these figures cover the whole process.
+    auto& atomTable = WTF::Thread::current().atomStringTable()->table();
+    int64 atomStringBytes = 0;
+    for (auto& entry : atomTable)
+        atomStringBytes += entry.get()->sizeInBytes();
+    message.AddInt32("atom strings", atomTable.size());
+    message.AddInt64("atom string bytes", atomStringBytes);
+
+    dispatchMessage(message);
+}
+
+void BWebPage::handleCompactDOMStrings(BMessage*)
+{
+    // One entry per distinct content. The set pins each canonical string
+    // only for the duration of the walk; afterwards a canonical survives
+    // exactly as long as some node still references it.
+    HashSet<String> canonicalStrings;
+    int64 reclaimedBytes = 0;
+    int64 duplicateNodes = 0;
+
+    for (WebCore::Frame* frame = &fPage->get().mainFrame(); frame;
+            frame = frame->tree().traverseNext()) {
+        auto* localFrame = dynamicDowncast<WebCore::LocalFrame>(*frame);
+        if (!localFrame)
+            continue;
+        WebCore::Document* document = localFrame->document();
+        if (!document)
+            continue;
+
+        for (WebCore::Node* node = document; node;
+                node = WebCore::NodeTraversal::next(*node)) {
+            auto* characterData
+                = dynamicDowncast<WebCore::CharacterData>(*node);
+            if (!characterData || !characterData->length())
+                continue;
+            auto result = canonicalStrings.add(characterData->data());
+            if (result.isNewEntry
+                    || characterData->data().impl() == result.iterator->impl())
+                continue;
+            // The duplicate impl is actually freed once renderers and JS
+            // wrappers holding a reference to it let go, so this figure is
+            // an upper bound on the immediate savings.
+            reclaimedBytes += characterData->data().impl()->sizeInBytes();
+            duplicateNodes++;
+            characterData->deduplicateData(*result.iterator);
+        }
+    }
+
+    BMessage message(B_COMPACT_DOM_STRINGS_RESULT);
+    message.AddInt32("distinct strings", canonicalStrings.size());
+    message.AddInt64("duplicate nodes", duplicateNodes);
+    message.AddInt64("reclaimed", reclaimedBytes);
+    dispatchMessage(message);
+}
+
+void BWebPage::handleSetFrameTelemetry(BMessage* message)
+{
+    bool enabled;
+    if (message->FindBool("enabled", &enabled) == B_OK)
+        fFrameTelemetryEnabled = enabled;
+}
+
+void BWebPage::handleSetMemoryTimeline(BMessage* message)
+{
+#if ENABLE(RESOURCE_USAGE)
+    bool enabled;
+    if (message->FindBool("enabled", &enabled) != B_OK)
+        return;
+
+    if (enabled) {
+        if (!fMemoryTimeline)
+            fMemoryTimeline = new BMemoryTimeline();
+        BMemoryTimeline* timeline = fMemoryTimeline;
+        ResourceUsageThread::addObserver(timeline,
+            ResourceUsageCollectionMode::Memory,
+            [timeline](const ResourceUsageData& data) {
+                timeline->record(data);
+            });
+    } else if (fMemoryTimeline) {
+        // Stop sampling but keep the ring, so the history leading up to a
+        // problem can still be fetched.
+        ResourceUsageThread::removeObserver(fMemoryTimeline);
+    }
+#endif
+}
+
+void BWebPage::handleSendMemoryTimeline(BMessage*)
+{
+    BMessage message(B_MEMORY_TIMELINE_RESULT);
+#if ENABLE(RESOURCE_USAGE)
+    if (fMemoryTimeline) {
+        int32 count = fMemoryTimeline->samples.size();
+        for (int32 i = 0; i < count; i++) {
+            const BMemoryTimeline::Sample& sample
+                = fMemoryTimeline->samples[(fMemoryTimeline->oldest + i) % count];
+            message.AddInt64("time us", sample.when);
+            message.AddInt64("dirty", sample.dirty);
+            message.AddInt64("gc heap", sample.gcHeap);
+            message.AddInt64("gc owned", sample.gcOwned);
+            message.AddInt64("images", sample.images);
+            message.AddInt64("layers", sample.layers);
+        }
+    }
+#endif
+    dispatchMessage(message);
+}
+
+void BWebPage::handleSetLoadMetrics(BMessage* message)
+{
+    bool enabled;
+    if (message->FindBool("enabled", &enabled) == B_OK)
+        WebCore::NetworkWaterfall::setEnabled(enabled);
+}
+
+void BWebPage::handleGetLoadMetrics(BMessage*)
+{
+    BMessage message(B_LOAD_METRICS_RESULT);
+    for (const auto& entry : WebCore::NetworkWaterfall::take()) {
+        message.AddString("url", entry.url.utf8().data());
+        message.AddInt32("status", entry.httpStatusCode);
+        message.AddBool("failed", entry.failed);
+        message.AddBool("conditional", entry.conditional);
+
+        // A zero mark is a phase the request skipped (a reused keep-alive
+        // connection resolves nothing and connects nowhere); collapse
+        // those to zero-length so the exported phases always add up to
+        // the request's total time.
+        MonotonicTime dnsStart = entry.domainLookupStart ? entry.domainLookupStart : entry.fetchStart;
+        MonotonicTime dnsEnd = entry.domainLookupEnd ? entry.domainLookupEnd : dnsStart;
+        MonotonicTime connectEnd = entry.connectEnd ? entry.connectEnd : dnsEnd;
+        MonotonicTime responseStart = entry.responseStart ? entry.responseStart : connectEnd;
+
+        message.AddInt64("start us", int64(entry.fetchStart.secondsSinceEpoch().microseconds()));
+        message.AddInt64("queue us", int64((dnsStart - entry.fetchStart).microseconds()));
+        message.AddInt64("dns us", int64((dnsEnd - dnsStart).microseconds()));
+        message.AddInt64("connect us", int64((connectEnd - dnsEnd).microseconds()));
+        message.AddInt64("ttfb us", int64((responseStart - connectEnd).microseconds()));
+        message.AddInt64("download us", int64((entry.responseEnd - responseStart).microseconds()));
+        message.AddInt64("wire bytes", int64(entry.bytesOnWire));
+        message.AddInt64("decoded bytes", int64(entry.bytesDecoded));
+    }
+    dispatchMessage(message);
+}
+
+void BWebPage::handleSendPerfCounters(BMessage*)
+{
+    BMessage message(B_PERF_COUNTERS_RESULT);
+#if ENABLE(PERFORMANCE_COUNTERS)
+    WTF::PerformanceCounter::forEach([&message](const WTF::PerformanceCounter& counter) {
+        message.AddString("name", counter.name());
+        message.AddInt64("value", int64(counter.value()));
+    });
+#endif
+    dispatchMessage(message);
+}
+
+void BWebPage::handleSuspend(BMessage*)
+{
+    // Drop the live document. Loading about:blank releases the DOM, the
+    // render tree and the page's share of decoded resources; the garbage
+    // collector then reclaims the JS wrappers. The caller serialized the
+    // back/forward list before this message was posted.
+    fMainFrame->StopLoading();
+    fMainFrame->LoadURL("about:blank");
+    WebCore::GCController::singleton().garbageCollectSoon();
+}
+
 // #pragma mark -
 
 status_t BWebPage::dispatchMessage(BMessage& message, BMessage* reply) const
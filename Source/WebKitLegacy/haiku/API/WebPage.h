@@ -37,6 +37,7 @@
 
 #include <memory>
 
+class BMessageRunner;
 class BNetworkCookieJar;
 class BRegion;
 class BView;
@@ -75,12 +76,44 @@ namespace BPrivate {
 class WebDownloadPrivate;
 };
 
+struct BMemoryTimeline;
+
 enum {
 	B_FIND_STRING_RESULT			= 'fsrs',
 	B_DOWNLOAD_ADDED				= 'dwna',
 	B_DOWNLOAD_REMOVED				= 'dwnr',
 	B_EDITING_CAPABILITIES_RESULT	= 'cedr',
-	B_PAGE_SOURCE_RESULT			= 'psrc'
+	B_PAGE_SOURCE_RESULT			= 'psrc',
+	B_RESOURCE_USAGE_RESULT			= 'rusr',
+	B_COMPACT_DOM_STRINGS_RESULT	= 'cdsr',
+	// One message per produced frame while frame telemetry is enabled,
+	// with per-stage durations in microseconds: "style layout us",
+	// "composite us", "paint us" and "blit us" (the blit figure is from
+	// the window thread's most recent Draw(), i.e. the previous frame).
+	B_FRAME_TIMING					= 'frtm',
+	// Reply to SendMemoryTimeline(): parallel arrays of int64s, one entry
+	// per recorded sample, oldest first. "time us" is the system_time() of
+	// the sample; "dirty", "gc heap", "gc owned", "images" and "layers" are
+	// byte counts (see SetMemoryTimelineEnabled() for what they cover).
+	B_MEMORY_TIMELINE_RESULT		= 'mtlr',
+	// Reply to GetLoadMetrics(): one entry per completed network request,
+	// oldest first, as parallel arrays. "url" is a string; "status" an
+	// int32; "start us", "queue us", "dns us", "connect us", "ttfb us" and
+	// "download us" are int64 microseconds (see SetLoadMetricsEnabled()
+	// for what the phases cover); "wire bytes" and "decoded bytes" are
+	// int64 byte counts; "failed" is a bool.
+	B_LOAD_METRICS_RESULT			= 'ldmr',
+	// Reply to SendPerfCounters(): parallel arrays "name" (string) and
+	// "value" (int64), one entry per counter. Values are cumulative and
+	// process-wide; sample twice and diff to attribute work to an action.
+	B_PERF_COUNTERS_RESULT			= 'pcrs',
+	// Sent to every page's listener when dropping our own caches was not
+	// enough to relieve system-wide memory pressure. Carries a bool
+	// "critical" ("false" signals the all-clear) and a bool "visible" with
+	// the page's current visibility. The application should suspend
+	// non-visible tabs, e.g. via SuspendToSessionState(), before the
+	// kernel starts picking victim teams.
+	B_MEMORY_PRESSURE				= 'mprs'
 };
 
 typedef enum {
@@ -92,6 +125,20 @@ class __attribute__ ((visibility ("default"))) BWebPage : private BHandler {
 public:
 	static	void				InitializeOnce();
 	static	void				ShutdownOnce();
+
+	// Optional. Pre-initializes expensive one-time state (the JavaScript
+	// VM, the font database) so the first page load does not pay for it.
+	// Call from the application thread, after InitializeOnce().
+	static	void				WarmUp();
+	// Best-effort hint that a navigation to this URL is likely soon.
+	// Resolves the host name and opens a TCP (or TLS) connection on a
+	// background thread.
+	static	void				Preconnect(const char* urlString);
+	// Optional. Sweeps the WebKit library file into the file cache on a
+	// background thread, so a cold start takes its page faults against the
+	// cache instead of seeking the disk for every lazily paged-in range.
+	// Call as early as possible; most effective on rotating disks.
+	static	void				PrefetchLibrary();
 	static	void				SetCacheModel(BWebKitCacheModel model);
 
 			void				Init();
@@ -117,6 +164,14 @@ public:
 
             status_t            GetContentsAsMHTML(BDataIO& output);
 
+	// Compact binary snapshot of the back/forward list (see
+	// BackForwardList::saveState() for the format). Restoring only
+	// materializes the current entry fully; call LoadURL() or GoBack()/
+	// GoForward() afterwards to actually show a page.
+            status_t            SaveSessionState(BDataIO& output);
+            status_t            RestoreSessionState(const void* data,
+                                    size_t size);
+
 			void				ChangeZoomFactor(float increment,
 									bool textOnly);
 			void				FindString(const char* string,
@@ -132,6 +187,65 @@ public:
 			void				SendEditingCapabilities();
 			void				SendPageSource();
 
+	// Replies with a B_RESOURCE_USAGE_RESULT message describing what this
+	// page holds in memory: per-page DOM node, document and render tree
+	// counts, the encoded and decoded sizes of the resources its documents
+	// reference, and the size of the view's backing store. The JS heap
+	// figures are included for context but cover the whole process, since
+	// all pages share one VM.
+			void				SendResourceUsage();
+
+	// Serializes the back/forward list into output (same format as
+	// SaveSessionState()) and then drops the live page to about:blank,
+	// releasing its DOM, render tree and JS wrappers. The tab comes back
+	// through RestoreSessionState() followed by a navigation, at the cost
+	// of a reload.
+            status_t            SuspendToSessionState(BDataIO& output);
+
+	// Rewrites equal-but-distinct text node strings in this page's
+	// documents to one shared instance and replies with a
+	// B_COMPACT_DOM_STRINGS_RESULT message ("reclaimed" bytes). Long-lived
+	// documents accumulate duplicates (repeated labels, whitespace runs);
+	// call this from an idle hook for background tabs.
+			void				CompactDOMStrings();
+
+	// Opt-in jank attribution for QA builds: while enabled, every frame
+	// this page produces is reported to the listener as a B_FRAME_TIMING
+	// message breaking the frame down by pipeline stage.
+			void				SetFrameTelemetryEnabled(bool enabled);
+
+	// Continuous memory timeline for hunting slow leaks: while enabled, the
+	// resource usage thread's 500ms samples — process dirty memory, the JS
+	// heap (block-allocated and GC-owned), decoded image pixels and tile
+	// buffers — are recorded into a ring holding the most recent ~20
+	// minutes. The same sampler drives the Web Inspector's Memory timeline,
+	// so an attached inspector shows the live view of the identical data.
+	// The figures are process-wide; recording on one page is enough.
+			void				SetMemoryTimelineEnabled(bool enabled);
+	// Replies with a B_MEMORY_TIMELINE_RESULT message carrying the recorded
+	// samples. The ring is kept after recording is disabled, so the history
+	// leading up to a problem can still be fetched afterwards.
+			void				SendMemoryTimeline();
+
+	// Network waterfall capture: while enabled, every completed request is
+	// logged with its phase timings — pool queue wait, DNS, connect (the
+	// TLS handshake happens inside the connect on this network kit), time
+	// to first byte and download — plus bytes on the wire vs. decoded.
+	// The same timings feed the Web Inspector's Network timeline, where
+	// they are attributed per page; this log is process-wide, since the
+	// loader below the page layer is shared.
+			void				SetLoadMetricsEnabled(bool enabled);
+	// Replies with a B_LOAD_METRICS_RESULT message carrying the requests
+	// logged since the last call, oldest first, and clears the log.
+			void				GetLoadMetrics();
+
+	// Replies with a B_PERF_COUNTERS_RESULT message carrying the current
+	// values of the style/layout instrumentation counters (elements
+	// resolved, selectors checked/matched, layouts by kind; see
+	// wtf/PerformanceCounter.h). The counters are always on — one relaxed
+	// atomic add each — so this works on production builds.
+			void				SendPerfCounters();
+
             void				RequestDownload(const BString& url);
 
 private:
@@ -203,6 +317,13 @@ private:
 
     void paint(BRect rect, bool immediate);
 
+    // Paint gate: paints are withheld from the moment a new main frame
+    // document is committed until the first visually non-empty layout (or a
+    // short timeout), then flushed in one go. The embedder is notified via
+    // a FIRST_PAINT message when the gate opens.
+    void suppressPaintsUntilFirstVisualLayout();
+    void releasePaintGate();
+
     void setLoadingProgress(float progress);
     void setStatusMessage(const BString& message);
     void setDisplayedStatusMessage(const BString& message, bool force = false);
@@ -218,6 +339,11 @@ private:
 	virtual	void				MessageReceived(BMessage* message);
 
 	void skipToLastMessage(BMessage*& message);
+	void flushDeferredMouseMoved();
+
+	void scheduleFrame(const BRect& dirtyRect);
+	void framePacerLoop();
+	static int32 framePacerEntry(void* self);
 
 	void handleLoadURL(const BMessage* message);
 	void handleReload(const BMessage* message);
@@ -236,6 +362,18 @@ private:
 	void handleResendNotifications(BMessage* message);
 	void handleSendEditingCapabilities(BMessage* message);
 	void handleSendPageSource(BMessage* message);
+	void handleSendResourceUsage(BMessage* message);
+	void handleSuspend(BMessage* message);
+	void handleCompactDOMStrings(BMessage* message);
+	void handleSetFrameTelemetry(BMessage* message);
+	void handleSetMemoryTimeline(BMessage* message);
+	void handleSendMemoryTimeline(BMessage* message);
+	void handleSetLoadMetrics(BMessage* message);
+	void handleGetLoadMetrics(BMessage* message);
+	void handleSendPerfCounters(BMessage* message);
+
+	static void pollSystemMemoryPressure();
+	static void broadcastMemoryPressure(bool critical);
 
     status_t dispatchMessage(BMessage& message, BMessage* reply = NULL) const;
 
@@ -257,9 +395,32 @@ private:
 		    bool							fPageDirty;
 		    bool							fLayoutingView;
 
+		    bool							fFrameTelemetryEnabled;
+
+		    // Owned ring of memory samples; see SetMemoryTimelineEnabled().
+		    BMemoryTimeline*				fMemoryTimeline;
+
+		    bool							fPaintsSuppressed;
+		    BRect							fSuppressedPaintRect;
+		    BMessageRunner*					fPaintGateRunner;
+
+		    // Frame pacer: rendering updates accumulate here and are
+		    // painted one per display retrace; see framePacerLoop().
+		    sem_id							fFramePacerSem;
+		    thread_id						fFramePacerThread;
+		    bool							fFrameScheduled;
+		    BRect							fPendingDrawRect;
+
+		    bigtime_t						fLastMouseMovedTime;
+		    BMessage*						fDeferredMouseMovedMessage;
+		    BMessageRunner*					fMouseMovedRunner;
+
 			bool							fToolbarsVisible;
 			bool							fStatusbarVisible;
 			bool							fMenubarVisible;
+
+			// Previous FindString() target; see handleFindString().
+			BString							fLastFindString;
 };
 
 #endif // _WEB_PAGE_H
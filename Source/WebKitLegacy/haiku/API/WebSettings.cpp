@@ -28,27 +28,55 @@
 #include "config.h"
 #include "WebSettings.h"
 
+#if ENABLE(CONTENT_EXTENSIONS)
+#include "ContentRuleListHaiku.h"
+#endif
 #include "FrameNetworkingContextHaiku.h"
 #include "IconDatabase.h"
+#if ENABLE(CONTENT_EXTENSIONS)
+#include "WebViewGroup.h"
+#endif
 
 #include "WebCore/ApplicationCacheStorage.h"
 #include "WebCore/BitmapImage.h"
+#if ENABLE(CONTENT_EXTENSIONS)
+#include "WebCore/ContentExtensionsBackend.h"
+#endif
 #include "WebCore/DatabaseTracker.h"
 #include "WebCore/FontPlatformData.h"
 #include "WebCore/Image.h"
 #include "WebCore/IntSize.h"
+#include "WebCore/MemoryCache.h"
+#include "WebCore/SQLiteDatabase.h"
+#include "WebCore/ScriptBytecodeDiskCache.h"
 #include "WebCore/Settings.h"
+#if USE(TILED_BACKING_STORE)
+#include "WebCore/TileHaiku.h"
+#endif
+#if ENABLE(CONTENT_EXTENSIONS)
+#include "WebCore/UserContentController.h"
+#endif
 #include "WebSettingsPrivate.h"
 #include <Application.h>
 #include <Bitmap.h>
 #include <Directory.h>
 #include <Entry.h>
+#include <File.h>
 #include <FindDirectory.h>
 #include <Font.h>
+#include <OS.h>
 #include <Path.h>
 #include <stdio.h>
+#include <time.h>
 #include <UrlContext.h>
 
+#include <JavaScriptCore/Options.h>
+#include <algorithm>
+#include <memory>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/URL.h>
+#include <wtf/Vector.h>
+
 enum {
 	HANDLE_SET_PERSISTENT_STORAGE_PATH = 'hspp',
 	HANDLE_SET_ICON_DATABASE_PATH = 'hsip',
@@ -59,10 +87,18 @@ enum {
 	HANDLE_SET_OFFLINE_WEB_APPLICATION_CACHE_PATH = 'hsap',
 	HANDLE_SET_OFFLINE_WEB_APPLICATION_CACHE_QUOTA = 'hsaq',
 	HANDLE_SET_LOCAL_STORAGE_PATH = 'hslp',
+	HANDLE_SET_BYTECODE_CACHE_PATH = 'hsbp',
+	HANDLE_SET_JAVASCRIPT_MEMORY_LIMIT = 'hsjm',
+	HANDLE_SET_MEMORY_CACHE_CAPACITY = 'hsmc',
+	HANDLE_RUN_STORAGE_MAINTENANCE = 'hrsm',
+	HANDLE_SEND_MEMORY_CACHE_STATISTICS = 'hsms',
+	HANDLE_APPLY_CONTENT_RULE_LIST = 'hacr',
+	HANDLE_REMOVE_CONTENT_RULE_LIST = 'hrcr',
 	HANDLE_SET_FONT = 'hsfn',
 	HANDLE_SET_FONT_SIZE = 'hsfs',
 	HANDLE_SET_PROXY_INFO = 'hspi',
 	HANDLE_SET_JAVASCRIPT_ENABLED = 'jsen',
+	HANDLE_SET_TILE_DEBUG_OVERLAY = 'htdo',
 	HANDLE_APPLY = 'hapl'
 };
 
@@ -78,6 +114,288 @@ enum {
 	FIXED_FONT_SIZE,
 };
 
+// Icon requests whose data has not been read from the database yet are
+// parked here and answered from the IconDatabaseClient callbacks once the
+// database's sync thread has loaded the data, instead of forcing callers
+// to poll. Everything below runs on the application thread: the handlers
+// are dispatched there and the database notifies clients via the main run
+// loop.
+struct PendingIconRequest {
+	BString url;
+	BMessage reply;
+	BMessenger target;
+};
+
+static const size_t kMaxPendingIconRequests = 64;
+
+static WTF::Vector<PendingIconRequest>& pendingIconRequests()
+{
+	static WTF::NeverDestroyed<WTF::Vector<PendingIconRequest>> requests;
+	return requests;
+}
+
+// Performs one lookup for an icon request. Returns true and sends the
+// reply if the icon is known; returns false (without replying) while the
+// data is still being read by the database's sync thread.
+static bool sendIconIfKnown(PendingIconRequest& request)
+{
+	std::pair<WebCore::PlatformImagePtr, WebKit::IconDatabase::IsKnownIcon> icon
+		= WebKit::iconDatabase().synchronousIconForPageURL(
+			WTF::String::fromUTF8(request.url.String()), WebCore::IntSize(16, 16));
+	if (icon.second != WebKit::IconDatabase::IsKnownIcon::Yes)
+		return false;
+
+	BMessage reply(request.reply);
+	reply.RemoveName("url");
+	reply.RemoveName("icon");
+	reply.AddString("url", request.url);
+	BMessage iconArchive;
+	if (icon.first != NULL && icon.first->Archive(&iconArchive) == B_OK)
+		reply.AddMessage("icon", &iconArchive);
+	request.target.SendMessage(&reply);
+	return true;
+}
+
+// A null pageURL means "retry everything" (used when the initial URL
+// import completes).
+static void retryPendingIconRequests(const WTF::String& pageURL)
+{
+	WTF::Vector<PendingIconRequest>& requests = pendingIconRequests();
+	for (size_t i = 0; i < requests.size();) {
+		PendingIconRequest& request = requests[i];
+		WTF::String requestURL = WTF::String::fromUTF8(request.url.String());
+		if (!pageURL.isNull() && pageURL != requestURL) {
+			i++;
+			continue;
+		}
+
+		bool done = sendIconIfKnown(request);
+		if (!done && !pageURL.isNull()) {
+			// The callback for this very page fired and there is still no
+			// usable icon; one will not appear later either.
+			done = true;
+		}
+		if (!done) {
+			// The URL import just finished: pages without an icon mapping
+			// will never get one. The remaining ones are still being read
+			// and get their own per-page callback.
+			done = WebKit::iconDatabase().synchronousIconURLForPageURL(requestURL).isEmpty();
+		}
+
+		if (done)
+			requests.remove(i);
+		else
+			i++;
+	}
+}
+
+// Directories the storage maintenance pass operates on, recorded as the
+// path setters run. Written on the application thread only; the worker
+// thread gets its own copies.
+static BString sOfflineStoragePath;
+static BString sBytecodeCachePath;
+
+class IconRequestsClient : public WebKit::IconDatabaseClient {
+public:
+	void didImportIconDataForPageURL(const WTF::String& pageURL) override
+	{
+		retryPendingIconRequests(pageURL);
+	}
+
+	void didChangeIconForPageURL(const WTF::String& pageURL) override
+	{
+		retryPendingIconRequests(pageURL);
+	}
+
+	void didFinishURLImport() override
+	{
+		retryPendingIconRequests(WTF::String());
+	}
+};
+
+// #pragma mark - storage maintenance
+
+// One pass over the persistent storage directories, run off the
+// application thread at low priority. The pause between files keeps the
+// sequential rewrite IO of VACUUM from starving page loads that happen to
+// hit the disk at the same time.
+struct StorageMaintenanceTask {
+	BString localStoragePath;
+	BString databasePath;
+	BString bytecodeCachePath;
+	BMessage reply;
+	BMessenger target;
+};
+
+static const bigtime_t kMaintenanceFilePause = 100000;
+static const time_t kBytecodeCacheMaxAge = 30 * 24 * 60 * 60;
+
+// Vacuums one SQLite file in place and returns its size afterwards, or a
+// negative value if the file could not be measured. A database that is
+// locked by a storage thread right now makes VACUUM fail with
+// SQLITE_BUSY; the file is then simply left for the next pass.
+static off_t vacuumDatabaseFile(const char* path)
+{
+	WebCore::SQLiteDatabase database;
+	if (database.open(WTF::String::fromUTF8(path),
+			WebCore::SQLiteDatabase::OpenMode::ReadWrite)) {
+		database.runVacuumCommand();
+		database.close();
+	}
+
+	BEntry entry(path);
+	off_t size;
+	if (entry.GetSize(&size) != B_OK)
+		return -1;
+	return size;
+}
+
+// Local storage is one flat directory of "<origin>.localstorage" files.
+static void maintainLocalStorage(const BString& directory, BMessage& reply,
+	int64& reclaimed)
+{
+	BDirectory dir(directory.String());
+	if (dir.InitCheck() != B_OK)
+		return;
+
+	BEntry entry;
+	while (dir.GetNextEntry(&entry) == B_OK) {
+		if (!entry.IsFile())
+			continue;
+		BPath path;
+		if (entry.GetPath(&path) != B_OK)
+			continue;
+
+		off_t before = 0;
+		entry.GetSize(&before);
+		off_t after = vacuumDatabaseFile(path.Path());
+		if (after < 0)
+			continue;
+		if (after < before)
+			reclaimed += before - after;
+
+		BString origin(path.Leaf());
+		int32 suffix = origin.FindLast(".localstorage");
+		if (suffix > 0)
+			origin.Truncate(suffix);
+		reply.AddString("origin", origin);
+		reply.AddInt64("bytes", after);
+
+		snooze(kMaintenanceFilePause);
+	}
+}
+
+// WebSQL keeps the origin tracker database at the top level and one
+// directory of numbered database files per origin below it.
+static void maintainDatabases(const BString& directory, BMessage& reply,
+	int64& reclaimed)
+{
+	BDirectory dir(directory.String());
+	if (dir.InitCheck() != B_OK)
+		return;
+
+	BEntry originEntry;
+	while (dir.GetNextEntry(&originEntry) == B_OK) {
+		if (originEntry.IsFile()) {
+			off_t before = 0;
+			originEntry.GetSize(&before);
+			BPath path;
+			if (originEntry.GetPath(&path) != B_OK)
+				continue;
+			off_t after = vacuumDatabaseFile(path.Path());
+			if (after >= 0 && after < before)
+				reclaimed += before - after;
+			snooze(kMaintenanceFilePause);
+			continue;
+		}
+		if (!originEntry.IsDirectory())
+			continue;
+
+		char originName[B_FILE_NAME_LENGTH];
+		if (originEntry.GetName(originName) != B_OK)
+			continue;
+
+		int64 originBytes = 0;
+		BDirectory originDir(&originEntry);
+		BEntry entry;
+		while (originDir.GetNextEntry(&entry) == B_OK) {
+			if (!entry.IsFile())
+				continue;
+			BPath path;
+			if (entry.GetPath(&path) != B_OK)
+				continue;
+
+			off_t before = 0;
+			entry.GetSize(&before);
+			off_t after = vacuumDatabaseFile(path.Path());
+			if (after < 0) {
+				originBytes += before;
+				continue;
+			}
+			if (after < before)
+				reclaimed += before - after;
+			originBytes += after;
+
+			snooze(kMaintenanceFilePause);
+		}
+
+		reply.AddString("origin", originName);
+		reply.AddInt64("bytes", originBytes);
+	}
+}
+
+// Bytecode cache entries are keyed by script URL and content, so a file
+// that has not been rewritten for a month belongs to a script version the
+// application no longer loads; dropping it only costs a re-parse if the
+// script ever comes back.
+static void pruneBytecodeCache(const BString& directory, int64& reclaimed)
+{
+	BDirectory dir(directory.String());
+	if (dir.InitCheck() != B_OK)
+		return;
+
+	time_t now = time(NULL);
+	BEntry entry;
+	while (dir.GetNextEntry(&entry) == B_OK) {
+		if (!entry.IsFile())
+			continue;
+		time_t modified;
+		if (entry.GetModificationTime(&modified) != B_OK)
+			continue;
+		if (now - modified < kBytecodeCacheMaxAge)
+			continue;
+
+		off_t size = 0;
+		entry.GetSize(&size);
+		if (entry.Remove() == B_OK)
+			reclaimed += size;
+	}
+}
+
+static status_t runStorageMaintenanceTask(void* data)
+{
+	std::unique_ptr<StorageMaintenanceTask> task(
+		static_cast<StorageMaintenanceTask*>(data));
+
+	BMessage reply(task->reply);
+	reply.RemoveName("origin");
+	reply.RemoveName("bytes");
+	reply.RemoveName("reclaimed");
+
+	int64 reclaimed = 0;
+	if (task->localStoragePath.Length())
+		maintainLocalStorage(task->localStoragePath, reply, reclaimed);
+	if (task->databasePath.Length())
+		maintainDatabases(task->databasePath, reply, reclaimed);
+	if (task->bytecodeCachePath.Length())
+		pruneBytecodeCache(task->bytecodeCachePath, reclaimed);
+
+	reply.AddInt64("reclaimed", reclaimed);
+	task->target.SendMessage(&reply);
+	return B_OK;
+}
+
+
 BWebSettings::BWebSettings()
     : fData(new BPrivate::WebSettingsPrivate())
 {
@@ -158,6 +476,55 @@ void BWebSettings::SetOfflineWebApplicationCacheQuota(int64 maximumSize)
 	_PostSetQuota(Default(), HANDLE_SET_OFFLINE_WEB_APPLICATION_CACHE_QUOTA, maximumSize);
 }
 
+void BWebSettings::SetBytecodeCachePath(const BString& path)
+{
+	_PostSetPath(Default(), HANDLE_SET_BYTECODE_CACHE_PATH, path);
+}
+
+void BWebSettings::SetJavaScriptMemoryLimit(int64 bytes)
+{
+	_PostSetQuota(Default(), HANDLE_SET_JAVASCRIPT_MEMORY_LIMIT, bytes);
+}
+
+void BWebSettings::SetMemoryCacheCapacity(int64 bytes)
+{
+	_PostSetQuota(Default(), HANDLE_SET_MEMORY_CACHE_CAPACITY, bytes);
+}
+
+void BWebSettings::RunStorageMaintenance(const BMessage& reply,
+		const BMessenger& target)
+{
+	BMessage message(HANDLE_RUN_STORAGE_MAINTENANCE);
+	message.AddMessage("reply", &reply);
+	message.AddMessenger("target", target);
+	Default()->Looper()->PostMessage(&message, Default());
+}
+
+void BWebSettings::SendMemoryCacheStatistics(const BMessage& reply,
+		const BMessenger& target)
+{
+	BMessage message(HANDLE_SEND_MEMORY_CACHE_STATISTICS);
+	message.AddMessage("reply", &reply);
+	message.AddMessenger("target", target);
+	Default()->Looper()->PostMessage(&message, Default());
+}
+
+void BWebSettings::ApplyContentRuleList(const BString& identifier,
+		const BString& path)
+{
+	BMessage message(HANDLE_APPLY_CONTENT_RULE_LIST);
+	message.AddString("identifier", identifier.String());
+	message.AddString("path", path.String());
+	Default()->Looper()->PostMessage(&message, Default());
+}
+
+void BWebSettings::RemoveContentRuleList(const BString& identifier)
+{
+	BMessage message(HANDLE_REMOVE_CONTENT_RULE_LIST);
+	message.AddString("identifier", identifier.String());
+	Default()->Looper()->PostMessage(&message, Default());
+}
+
 void BWebSettings::SetLocalStoragePath(const BString& path)
 {
 	_PostSetPath(this, HANDLE_SET_LOCAL_STORAGE_PATH, path);
@@ -200,6 +567,13 @@ void BWebSettings::SetJavascriptEnabled(bool enabled)
 	_PostMessage(Default(), &message);
 }
 
+/*static*/ void BWebSettings::SetTileDebugOverlayEnabled(bool enabled)
+{
+	BMessage message(HANDLE_SET_TILE_DEBUG_OVERLAY);
+	message.AddBool("enable", enabled);
+	_PostMessage(Default(), &message);
+}
+
 void BWebSettings::SetProxyInfo(const BString& host, uint32 port,
 	BProxyType type, const BString& username, const BString& password)
 {
@@ -320,6 +694,39 @@ void BWebSettings::MessageReceived(BMessage* message)
 		    _HandleSetLocalStoragePath(path);
 		break;
 	}
+	case HANDLE_SET_BYTECODE_CACHE_PATH: {
+		BString path;
+		if (message->FindString("path", &path) == B_OK)
+		    _HandleSetBytecodeCachePath(path);
+		break;
+	}
+	case HANDLE_SET_JAVASCRIPT_MEMORY_LIMIT: {
+		int64 bytes;
+		if (message->FindInt64("quota", &bytes) == B_OK)
+		    _HandleSetJavaScriptMemoryLimit(bytes);
+		break;
+	}
+	case HANDLE_SET_MEMORY_CACHE_CAPACITY: {
+		int64 bytes;
+		if (message->FindInt64("quota", &bytes) == B_OK)
+		    _HandleSetMemoryCacheCapacity(bytes);
+		break;
+	}
+	case HANDLE_RUN_STORAGE_MAINTENANCE:
+		_HandleRunStorageMaintenance(message);
+		break;
+	case HANDLE_SEND_MEMORY_CACHE_STATISTICS:
+		_HandleSendMemoryCacheStatistics(message);
+		break;
+	case HANDLE_APPLY_CONTENT_RULE_LIST:
+		_HandleApplyContentRuleList(message);
+		break;
+	case HANDLE_REMOVE_CONTENT_RULE_LIST: {
+		BString identifier;
+		if (message->FindString("identifier", &identifier) == B_OK)
+			_HandleRemoveContentRuleList(identifier);
+		break;
+	}
 	case HANDLE_SET_FONT:
 		_HandleSetFont(message);
 		break;
@@ -331,6 +738,10 @@ void BWebSettings::MessageReceived(BMessage* message)
 		_HandleSetJavascriptEnabled(message->FindBool("enable"));
 		break;
 
+	case HANDLE_SET_TILE_DEBUG_OVERLAY:
+		_HandleSetTileDebugOverlay(message->FindBool("enable"));
+		break;
+
 	case HANDLE_SET_PROXY_INFO:
 		_HandleSetProxyInfo(message);
 		break;
@@ -371,6 +782,7 @@ void BWebSettings::_HandleSetPersistentStoragePath(const BString& path)
 
 void BWebSettings::_HandleSetOfflineStoragePath(const BString& path)
 {
+	sOfflineStoragePath = path;
 }
 
 void BWebSettings::_HandleSetOfflineStorageDefaultQuota(int64 maximumSize)
@@ -391,6 +803,9 @@ void BWebSettings::_HandleSetIconDatabasePath(const BString& path)
 
 	if (path.Length()) {
 		WebKit::iconDatabase().setEnabled(true);
+		// The client must be installed before open() starts the sync
+		// thread; it completes parked icon requests once data arrives.
+		WebKit::iconDatabase().setClient(std::make_unique<IconRequestsClient>());
 		BEntry entry(path.String());
 		if (entry.IsDirectory())
 			WebKit::iconDatabase().open(String::fromUTF8(path.String()), WebKit::IconDatabase::defaultDatabaseFilename());
@@ -408,27 +823,29 @@ void BWebSettings::_HandleClearIconDatabase()
 
 void BWebSettings::_HandleSendIconForURL(BMessage* message)
 {
-	BString url;
-	BMessage reply;
-	BMessenger target;
-	if (message->FindString("url", &url) != B_OK
-			|| message->FindMessage("reply", &reply) != B_OK
-			|| message->FindMessenger("target", &target) != B_OK) {
+	PendingIconRequest request;
+	if (message->FindString("url", &request.url) != B_OK
+			|| message->FindMessage("reply", &request.reply) != B_OK
+			|| message->FindMessenger("target", &request.target) != B_OK) {
 		return;
 	}
 
+	if (sendIconIfKnown(request))
+		return;
+
+	// The icon is not in memory (yet). The lookup above already registered
+	// our interest with the database, so park the request and answer it
+	// from the client callbacks once the sync thread has read the data.
+	// Reply without an icon right away so callers keep their placeholder
+	// in the meantime.
+	BMessage reply(request.reply);
 	reply.RemoveName("url");
 	reply.RemoveName("icon");
-	reply.AddString("url", url);
+	reply.AddString("url", request.url);
+	request.target.SendMessage(&reply);
 
-	std::pair<WebCore::PlatformImagePtr, WebKit::IconDatabase::IsKnownIcon> icon
-		= WebKit::iconDatabase().synchronousIconForPageURL(String::fromUTF8(url.String()), WebCore::IntSize(16, 16));
-	BMessage iconArchive;
-	if (icon.second == WebKit::IconDatabase::IsKnownIcon::Yes
-			&& icon.first != NULL && icon.first->Archive(&iconArchive) == B_OK)
-		reply.AddMessage("icon", &iconArchive);
-
-	target.SendMessage(&reply);
+	if (pendingIconRequests().size() < kMaxPendingIconRequests)
+		pendingIconRequests().append(WTFMove(request));
 }
 
 
@@ -448,6 +865,163 @@ void BWebSettings::_HandleSetLocalStoragePath(const BString& path)
     fData->apply();
 }
 
+void BWebSettings::_HandleSetJavaScriptMemoryLimit(int64 bytes)
+{
+	// The GC heap sizes itself against this instead of physical RAM; it only
+	// takes effect for VMs created afterwards, hence the "before the first
+	// page" requirement documented in the header.
+	JSC::Options::forceRAMSize() = bytes > 0 ? static_cast<unsigned>(std::min<int64>(bytes, UINT32_MAX)) : 0;
+}
+
+void BWebSettings::_HandleSetMemoryCacheCapacity(int64 bytes)
+{
+	// Same live/dead split as BWebPage::SetCacheModel(). Dead resources
+	// (no longer referenced by any document) are the first to go; decoded
+	// pixels of live images are pruned LRU once the total is exceeded and
+	// come back via a re-decode on the next paint.
+	uint32 totalCapacity = bytes > 0 ? static_cast<uint32>(std::min<int64>(bytes, UINT32_MAX)) : 0;
+	WebCore::MemoryCache::singleton().setCapacities(totalCapacity / 4, totalCapacity / 2, totalCapacity);
+	WebCore::MemoryCache::singleton().setDeadDecodedDataDeletionInterval(
+		totalCapacity ? WTF::Seconds(60) : WTF::Seconds(0));
+}
+
+void BWebSettings::_HandleRunStorageMaintenance(BMessage* message)
+{
+	StorageMaintenanceTask* task = new StorageMaintenanceTask();
+	if (message->FindMessage("reply", &task->reply) != B_OK
+			|| message->FindMessenger("target", &task->target) != B_OK) {
+		delete task;
+		return;
+	}
+
+	task->localStoragePath = Default()->fData->localStoragePath;
+	task->databasePath = sOfflineStoragePath;
+	task->bytecodeCachePath = sBytecodeCachePath;
+
+	thread_id thread = spawn_thread(runStorageMaintenanceTask,
+		"storage maintenance", B_LOW_PRIORITY, task);
+	if (thread >= 0)
+		resume_thread(thread);
+	else
+		delete task;
+}
+
+void BWebSettings::_HandleSendMemoryCacheStatistics(BMessage* message)
+{
+	BMessage reply;
+	BMessenger target;
+	if (message->FindMessage("reply", &reply) != B_OK
+			|| message->FindMessenger("target", &target) != B_OK)
+		return;
+
+	WebCore::MemoryCache& cache = WebCore::MemoryCache::singleton();
+	WebCore::MemoryCache::Statistics statistics = cache.getStatistics();
+
+	const struct {
+		const char* name;
+		const WebCore::MemoryCache::TypeStatistic& statistic;
+	} types[] = {
+		{ "images", statistics.images },
+		{ "cssStyleSheets", statistics.cssStyleSheets },
+		{ "scripts", statistics.scripts },
+		{ "xslStyleSheets", statistics.xslStyleSheets },
+		{ "fonts", statistics.fonts },
+	};
+	for (const auto& type : types) {
+		reply.AddString("type", type.name);
+		reply.AddInt32("count", type.statistic.count);
+		reply.AddInt64("bytes", type.statistic.size);
+		reply.AddInt64("liveBytes", type.statistic.liveSize);
+		reply.AddInt64("decodedBytes", type.statistic.decodedSize);
+	}
+	reply.AddInt64("totalBytes", cache.size());
+
+	target.SendMessage(&reply);
+}
+
+#if ENABLE(CONTENT_EXTENSIONS)
+// Every BWebPage joins the "default" view group (see the BWebPage
+// constructor), so installing a rule list into that group's user content
+// controller makes all pages evaluate it. The storage path must match the
+// one the constructor passes to getOrCreate(), or a second group would be
+// created here.
+static WebCore::UserContentProvider& defaultUserContentProvider()
+{
+	BPath storagePath;
+	find_directory(B_USER_SETTINGS_DIRECTORY, &storagePath);
+	storagePath.Append("WebKit/LocalStorage");
+
+	static RefPtr<WebViewGroup> group = WebViewGroup::getOrCreate(
+		WTF::ASCIILiteral::fromLiteralUnsafe("default"),
+		WTF::String::fromUTF8(storagePath.Path()));
+	return group->userContentController();
+}
+#endif
+
+void BWebSettings::_HandleApplyContentRuleList(BMessage* message)
+{
+#if ENABLE(CONTENT_EXTENSIONS)
+	BString identifier;
+	BString path;
+	if (message->FindString("identifier", &identifier) != B_OK
+			|| message->FindString("path", &path) != B_OK)
+		return;
+
+	BFile file(path.String(), B_READ_ONLY);
+	off_t size = 0;
+	if (file.InitCheck() != B_OK || file.GetSize(&size) != B_OK || size <= 0) {
+		fprintf(stderr, "BWebSettings: cannot read content rule list \"%s\"\n",
+			path.String());
+		return;
+	}
+
+	BString json;
+	char* buffer = json.LockBuffer(size + 1);
+	ssize_t bytesRead = file.Read(buffer, size);
+	json.UnlockBuffer(bytesRead > 0 ? bytesRead : 0);
+	if (bytesRead != size) {
+		fprintf(stderr, "BWebSettings: cannot read content rule list \"%s\"\n",
+			path.String());
+		return;
+	}
+
+	std::error_code error;
+	RefPtr<WebKit::ContentRuleListHaiku> ruleList
+		= WebKit::ContentRuleListHaiku::create(
+			WTF::String::fromUTF8(json.String()), error);
+	if (!ruleList) {
+		fprintf(stderr, "BWebSettings: compiling content rule list \"%s\" "
+			"failed: %s\n", identifier.String(), error.message().c_str());
+		return;
+	}
+
+	defaultUserContentProvider().userContentExtensionBackend().addContentExtension(
+		WTF::String::fromUTF8(identifier.String()), ruleList.releaseNonNull(),
+		WTF::URL());
+#else
+	(void)message;
+#endif
+}
+
+void BWebSettings::_HandleRemoveContentRuleList(const BString& identifier)
+{
+#if ENABLE(CONTENT_EXTENSIONS)
+	defaultUserContentProvider().userContentExtensionBackend().removeContentExtension(
+		WTF::String::fromUTF8(identifier.String()));
+#else
+	(void)identifier;
+#endif
+}
+
+void BWebSettings::_HandleSetBytecodeCachePath(const BString& path)
+{
+	if (path.Length())
+		create_directory(path.String(), 0755);
+	sBytecodeCachePath = path;
+	WebCore::ScriptBytecodeDiskCache::singleton().setDirectory(
+		WTF::String::fromUTF8(path.String()));
+}
+
 void BWebSettings::_HandleSetFont(BMessage* message)
 {
 	int32 which;
@@ -507,6 +1081,16 @@ void BWebSettings::_HandleSetJavascriptEnabled(bool enable)
 }
 
 
+void BWebSettings::_HandleSetTileDebugOverlay(bool enable)
+{
+#if USE(TILED_BACKING_STORE)
+	WebCore::TileHaiku::setDebugOverlayEnabled(enable);
+#else
+	(void)enable;
+#endif
+}
+
+
 void BWebSettings::_HandleSetProxyInfo(BMessage* message)
 {
 	BString host;
@@ -81,6 +81,69 @@ public:
 	static	void				SetOfflineWebApplicationCachePath(const BString& path);
 	static	void				SetOfflineWebApplicationCacheQuota(int64 maximumSize);
 
+	// Directory for serialized JavaScript bytecode, keyed by script URL and
+	// content, so an application shell's scripts skip parsing on relaunch.
+	// An empty path disables the cache. The application owns the directory
+	// and may clear it at any time.
+	static	void				SetBytecodeCachePath(const BString& path);
+
+	// Caps the RAM size JavaScriptCore sizes its garbage-collected heap
+	// against, instead of the machine's physical memory. The limit covers
+	// all pages (they share one VM); 0 restores the default. Must be set
+	// before the first page is created to take effect.
+	static	void				SetJavaScriptMemoryLimit(int64 bytes);
+
+	// Budget for the in-memory resource cache, which is dominated by
+	// decoded image pixels. The cache evicts least-recently-painted decoded
+	// data first and transparently re-decodes it from the (much smaller)
+	// encoded bytes when painted again. Overrides the coarse preset picked
+	// by BWebPage::SetCacheModel(); 0 disables caching entirely.
+	static	void				SetMemoryCacheCapacity(int64 bytes);
+
+	// Toggles a diagnostic overlay on the tiled backing store of all views:
+	// repainted tile regions are tinted red (fading as they settle), tile
+	// borders are outlined, and each tile is labeled with its last raster
+	// duration, age, raster count and the global raster rate. The overlay
+	// is composited after the tile content, so captured page pixels are
+	// unaffected. Intended for tuning invalidation behavior; off by default.
+	static	void				SetTileDebugOverlayEnabled(bool enable);
+
+	// Runs one maintenance pass over the storage configured through the
+	// path setters above: vacuums the per-origin local storage and database
+	// SQLite files and prunes bytecode cache entries that have not been
+	// used for a month. The pass runs on a low priority background thread
+	// with a pause between files; trigger it when the application is idle.
+	// When it finishes, a copy of the provided message is sent to the
+	// target, extended with parallel "origin"/"bytes" entries listing each
+	// origin's disk usage after the pass and a "reclaimed" int64 with the
+	// total number of bytes freed.
+	static	void				RunStorageMaintenance(const BMessage& reply,
+									const BMessenger& target);
+
+	// Reports the occupancy of the in-memory resource cache, for sizing
+	// SetMemoryCacheCapacity() against a real workload. A copy of the
+	// provided message is sent to the target, extended with parallel
+	// "type"/"count"/"bytes"/"liveBytes"/"decodedBytes" entries (one per
+	// resource type: images, stylesheets, scripts, fonts) and a
+	// "totalBytes" int64 with the cache's current footprint.
+	static	void				SendMemoryCacheStatistics(const BMessage& reply,
+									const BMessenger& target);
+
+	// Compiles the content-blocker rule list stored as WebKit JSON in the
+	// given file and installs it under the given identifier, replacing any
+	// list previously installed under that identifier. The compiled DFA is
+	// evaluated against every request before the network is touched, so a
+	// blocked subresource costs no connection at all. Compilation happens
+	// once, synchronously on the application thread; install lists at
+	// startup, before loading pages. Loads already in progress are not
+	// re-evaluated. A no-op when WebKit was built without content
+	// extension support.
+	static	void				ApplyContentRuleList(const BString& identifier,
+									const BString& path);
+
+	// Removes the rule list installed under the given identifier, if any.
+	static	void				RemoveContentRuleList(const BString& identifier);
+
 			void				SetLocalStoragePath(const BString& path);
 
 			void				SetSerifFont(const BFont& font);
@@ -127,10 +190,18 @@ private:
 			void				_HandleSetWebApplicationCachePath(const BString& path);
 			void				_HandleSetWebApplicationCacheQuota(int64 maximumSize);
 			void				_HandleSetLocalStoragePath(const BString& path);
+			void				_HandleSetBytecodeCachePath(const BString& path);
+			void				_HandleSetJavaScriptMemoryLimit(int64 bytes);
+			void				_HandleSetMemoryCacheCapacity(int64 bytes);
+			void				_HandleRunStorageMaintenance(BMessage* message);
+			void				_HandleSendMemoryCacheStatistics(BMessage* message);
+			void				_HandleApplyContentRuleList(BMessage* message);
+			void				_HandleRemoveContentRuleList(const BString& identifier);
 			void				_HandleSetFont(BMessage* message);
 			void				_HandleSetFontSize(BMessage* message);
 			void				_HandleSetProxyInfo(BMessage* message);
 			void				_HandleSetJavascriptEnabled(bool);
+			void				_HandleSetTileDebugOverlay(bool);
 			void				_HandleApply();
 private:
 			BPrivate::WebSettingsPrivate* fData;
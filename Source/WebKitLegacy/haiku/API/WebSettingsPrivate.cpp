@@ -99,6 +99,57 @@ void WebSettingsPrivate::apply()
 	    settings->setLocalStorageDatabasePath(String::fromUTF8(global->localStoragePath.String()));
 	    settings->setDefaultTextEncodingName(ASCIILiteral::fromLiteralUnsafe("UTF-8"));
         settings->setNeedsSiteSpecificQuirks(true);
+        // Let pages enter the back/forward cache; the cache itself is
+        // sized (and can be turned off) via BWebPage::SetCacheModel().
+        settings->setUsesBackForwardCache(true);
+
+        // Let large images drawn scaled down decode directly to a
+        // reduced resolution (JPEG DCT scaling in the image decoders).
+        settings->setImageSubsamplingEnabled(true);
+
+        // Honor fetchpriority=high/low and loading=lazy. The hint shifts
+        // the resource's ResourceLoadPriority, which the request pool uses
+        // to order queued loads per origin; lazy images wait for the
+        // viewport-proximity check before fetching at all.
+        settings->setFetchPriorityEnabled(true);
+        settings->setLazyImageLoadingEnabled(true);
+
+        // Defer offscreen subframe work. loading=lazy iframes do not even
+        // load (and so never run style, layout or paint) until they near
+        // the viewport, and content-visibility:auto lets pages skip the
+        // rendering work of offscreen subtrees entirely. Both are author
+        // opt-ins, so pages that need offscreen content kept live simply
+        // do not ask for them.
+        settings->setLazyIframeLoadingEnabled(true);
+        settings->setCSSContentVisibilityEnabled(true);
+
+        // Throttle hidden pages. Once BWebPage::handleSetVisible pushes the
+        // view's visibility into Page::setIsVisible, these make an invisible
+        // page align its DOM timers to the one-second hidden interval and
+        // suspend its CSS animations outright, instead of ticking at full
+        // rate behind another window or workspace.
+        settings->setHiddenPageDOMTimerThrottlingEnabled(true);
+        settings->setHiddenPageCSSAnimationSuspensionEnabled(true);
+
+        // Give viewport-constrained (fixed, and sticky inside composited
+        // overflow) elements their own compositing layers, as the
+        // coordinated-graphics ports do. Scrolling past them then adjusts a
+        // layer offset and recomposites instead of repainting the whole
+        // viewport in software because the blit fast path is disabled by a
+        // slow-repaint object.
+        settings->setAcceleratedCompositingForFixedPositionEnabled(
+            settings->acceleratedCompositingEnabled());
+
+#if ENABLE(OFFSCREEN_CANVAS)
+        // The Haiku ImageBuffer backend confines each buffer to the thread
+        // that created it, which is all OffscreenCanvas needs: a canvas
+        // rendered in a Worker creates and draws its buffer entirely on
+        // the worker thread.
+        settings->setOffscreenCanvasEnabled(true);
+#if ENABLE(OFFSCREEN_CANVAS_IN_WORKERS)
+        settings->setOffscreenCanvasInWorkersEnabled(true);
+#endif
+#endif
 
         char path[256];
         status_t result = find_path(B_CURRENT_IMAGE_SYMBOL,
@@ -43,19 +43,77 @@
 #include "WebPage.h"
 #include "WebViewConstants.h"
 
+#if USE(TILED_BACKING_STORE)
+#include "WebCore/TileHaiku.h"
+#endif
+
 #include <Alert.h>
 #include <AppDefs.h>
 #include <Application.h>
 #include <Bitmap.h>
+#include <BitmapStream.h>
+#include <DataIO.h>
+#include <MessageRunner.h>
 #include <Region.h>
+#include <TranslatorFormats.h>
+#include <TranslatorRoster.h>
 #include <Window.h>
+#include <algorithm>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <wtf/SystemTracing.h>
 
 using namespace WebCore;
 
 
 static const int32 kMsgNavigateArrow = '_NvA';
+static const int32 kMsgScrollBenchmarkTick = 'sbtk';
+
+// State of a running scroll benchmark (see RunScrollBenchmark()). Lives on
+// the window thread; the tick runner posts to the view, so every access
+// happens from the window's message loop.
+struct ScrollBenchmark {
+	enum Curve { Constant = 0, Ease, Flick };
+
+	float distance;
+	bigtime_t duration;
+	int curve;
+	BMessage reply;
+	BMessenger target;
+	BMessageRunner* runner;
+
+	bigtime_t startTime;
+	float scrolled;
+	bigtime_t lastInjectTime;
+	bigtime_t lastDrawSeen;
+	int64 drawCountAtStart;
+
+	bigtime_t intervalMax;
+	int64 latencySamples;
+	bigtime_t latencySum;
+	bigtime_t latencyMax;
+	int64 checkerboardSamples;
+	int64 checkerboardSum;
+	int64 checkerboardMax;
+};
+
+// Fraction of the total distance covered at time fraction f in [0, 1].
+static float scrollBenchmarkPosition(int curve, float f)
+{
+	switch (curve) {
+	case ScrollBenchmark::Ease:
+		// Smoothstep: gentle start and stop, full speed in the middle.
+		return f * f * (3 - 2 * f);
+	case ScrollBenchmark::Flick:
+		// Cubic ease-out: a fast flick that decays, the worst case for
+		// tile prefetching.
+		return 1 - (1 - f) * (1 - f) * (1 - f);
+	case ScrollBenchmark::Constant:
+	default:
+		return f;
+	}
+}
 
 
 BWebView::UserData::~UserData()
@@ -72,6 +130,12 @@ BWebView::BWebView(const char* name, BPrivate::Network::BUrlContext* urlContext)
     , fAutoHidePointer(false)
     , fOffscreenBitmap(nullptr)
     , fOffscreenView(nullptr)
+    , fFrontBufferLock("front buffer lock")
+    , fFrontBuffer(nullptr)
+    , fLastBlitDuration(0)
+    , fLastDrawTime(0)
+    , fDrawCount(0)
+    , fScrollBenchmark(nullptr)
     , fWebPage(new BWebPage(this, urlContext))
     , fUserData(nullptr)
 {
@@ -111,6 +175,13 @@ BWebView::~BWebView()
         delete fOffscreenBitmap;
     }
 
+    delete fFrontBuffer;
+
+    if (fScrollBenchmark) {
+        delete fScrollBenchmark->runner;
+        delete fScrollBenchmark;
+    }
+
 	SetUserData(0);
 }
 
@@ -251,18 +322,31 @@ void BWebView::Draw(BRect rect)
 {
     SetDrawingMode(B_OP_COPY);
 
-    // Draw the page that was already rendered as an offscreen bitmap
-    if (fOffscreenBitmap == NULL || !fOffscreenBitmap->Lock()) {
+    // Blit the last completed frame. Only _PublishFrame() ever holds the
+    // front buffer lock, and only for the duration of a region copy, so this
+    // never stalls behind a long WebCore paint into the back buffer (which
+    // used to freeze window dragging during heavy style recalcs).
+    fFrontBufferLock.Lock();
+
+    if (fFrontBuffer == NULL) {
+        fFrontBufferLock.Unlock();
         SetHighColor(255, 255, 255);
         FillRect(rect);
         return;
     }
 
-    DrawBitmap(fOffscreenBitmap, rect, rect);
-
-    fOffscreenBitmap->Unlock();
+    bigtime_t blitStart = system_time();
+    tracePoint(PageBlitStart);
+    DrawBitmap(fFrontBuffer, rect, rect);
+    tracePoint(PageBlitEnd);
+    // Written from the window thread, read from the application thread
+    // without locking; a torn read at worst misattributes one frame's
+    // blit time in the telemetry.
+    fLastBlitDuration = system_time() - blitStart;
+    fLastDrawTime = blitStart;
+    fDrawCount++;
 
-    GraphicsContextHaiku g(this);
+    fFrontBufferLock.Unlock();
 }
 
 void BWebView::FrameResized(float width, float height)
@@ -312,6 +396,10 @@ void BWebView::MessageReceived(BMessage* message)
         _DispatchKeyEvent(B_KEY_DOWN);
         break;
 
+    case kMsgScrollBenchmarkTick:
+        _ScrollBenchmarkTick();
+        break;
+
 #if ENABLE(POINTER_LOCK)
     case 'plok':
     {
@@ -474,6 +562,93 @@ void BWebView::SetAutoHidePointer(bool doIt)
 	fAutoHidePointer = doIt;
 }
 
+struct SnapshotRequest {
+    BBitmap* bitmap;
+    BSize maxSize;
+    BMessage reply;
+    BMessenger target;
+};
+
+void BWebView::RequestSnapshot(const BSize& maxSize, const BMessage& reply,
+    const BMessenger& target)
+{
+    SnapshotRequest* request = new SnapshotRequest;
+    request->bitmap = nullptr;
+    request->maxSize = maxSize;
+    request->reply = reply;
+    request->target = target;
+
+    // The only main-thread work is this copy of the last completed frame;
+    // scaling and encoding happen on the worker.
+    fFrontBufferLock.Lock();
+    if (fFrontBuffer != NULL)
+        request->bitmap = new BBitmap(*fFrontBuffer);
+    fFrontBufferLock.Unlock();
+
+    thread_id worker = spawn_thread(_SnapshotWorker, "snapshot worker",
+        B_LOW_PRIORITY, request);
+    if (worker >= B_OK && resume_thread(worker) == B_OK)
+        return;
+
+    // Could not start the worker; still answer so callers don't wait forever.
+    delete request->bitmap;
+    BMessage message(request->reply);
+    message.RemoveName("png");
+    request->target.SendMessage(&message);
+    delete request;
+}
+
+void BWebView::RunScrollBenchmark(float distance, bigtime_t duration,
+    const char* curve, const BMessage& reply, const BMessenger& target)
+{
+    if (fScrollBenchmark != nullptr || duration <= 0)
+        return;
+
+    ScrollBenchmark* benchmark = new ScrollBenchmark;
+    benchmark->distance = distance;
+    benchmark->duration = duration;
+    if (curve != NULL && strcmp(curve, "ease") == 0)
+        benchmark->curve = ScrollBenchmark::Ease;
+    else if (curve != NULL && strcmp(curve, "flick") == 0)
+        benchmark->curve = ScrollBenchmark::Flick;
+    else
+        benchmark->curve = ScrollBenchmark::Constant;
+    benchmark->reply = reply;
+    benchmark->target = target;
+
+    benchmark->startTime = system_time();
+    benchmark->scrolled = 0;
+    benchmark->lastInjectTime = 0;
+    benchmark->lastDrawSeen = fLastDrawTime;
+    benchmark->drawCountAtStart = fDrawCount;
+    benchmark->intervalMax = 0;
+    benchmark->latencySamples = 0;
+    benchmark->latencySum = 0;
+    benchmark->latencyMax = 0;
+    benchmark->checkerboardSamples = 0;
+    benchmark->checkerboardSum = 0;
+    benchmark->checkerboardMax = 0;
+
+#if USE(TILED_BACKING_STORE)
+    // Drop whatever accumulated before the run started.
+    TileHaiku::takeCheckerboardArea();
+#endif
+
+    // Tick at roughly frame rate; injection and sampling both ride on it.
+    BMessage tick(kMsgScrollBenchmarkTick);
+    benchmark->runner = new BMessageRunner(BMessenger(this), &tick, 16000);
+    if (benchmark->runner->InitCheck() != B_OK) {
+        // Still answer so callers don't wait forever.
+        BMessage message(reply);
+        target.SendMessage(&message);
+        delete benchmark->runner;
+        delete benchmark;
+        return;
+    }
+
+    fScrollBenchmark = benchmark;
+}
+
 void BWebView::SetUserData(BWebView::UserData* userData)
 {
 	if (fUserData == userData)
@@ -510,6 +685,8 @@ void BWebView::SetRootLayer(WebCore::GraphicsLayer* layer)
 
 void BWebView::SetOffscreenViewClean(BRect cleanRect, bool immediate)
 {
+    _PublishFrame(cleanRect);
+
     if (LockLooper()) {
         if (immediate)
             Draw(cleanRect);
@@ -553,6 +730,168 @@ void BWebView::ExitVideoFullscreenForVideoElement(WebCore::HTMLVideoElement&)
 
 // #pragma mark - private
 
+/*static*/ int32 BWebView::_SnapshotWorker(void* data)
+{
+    SnapshotRequest* request = static_cast<SnapshotRequest*>(data);
+    BBitmap* bitmap = request->bitmap;
+
+    // Scale down to fit maxSize, if a usable size was given. The scaled
+    // bitmap accepts views, so app_server does the filtering for us; this
+    // is safe from any thread as long as the bitmap is locked.
+    if (bitmap != NULL && request->maxSize.width > 0
+            && request->maxSize.height > 0) {
+        BRect bounds = bitmap->Bounds();
+        float scale = std::min(
+            request->maxSize.width / (bounds.Width() + 1),
+            request->maxSize.height / (bounds.Height() + 1));
+        if (scale < 1) {
+            BRect scaledBounds(0, 0,
+                floorf((bounds.Width() + 1) * scale) - 1,
+                floorf((bounds.Height() + 1) * scale) - 1);
+            BBitmap* scaled = new BBitmap(scaledBounds, B_RGB32, true);
+            if (scaled->IsValid()) {
+                BView* view = new BView(scaledBounds, "snapshot scaler",
+                    B_FOLLOW_NONE, 0);
+                scaled->AddChild(view);
+                scaled->Lock();
+                view->DrawBitmap(bitmap, bounds, scaledBounds,
+                    B_FILTER_BITMAP_BILINEAR);
+                view->Sync();
+                scaled->RemoveChild(view);
+                scaled->Unlock();
+                delete view;
+                delete bitmap;
+                bitmap = scaled;
+            } else
+                delete scaled;
+        }
+    }
+
+    BMessage message(request->reply);
+    message.RemoveName("png");
+
+    if (bitmap != NULL) {
+        BBitmapStream input(bitmap);
+            // The stream owns the bitmap now and deletes it.
+        BMallocIO output;
+        if (BTranslatorRoster::Default()->Translate(&input, NULL, NULL,
+                &output, B_PNG_FORMAT) == B_OK) {
+            message.AddData("png", B_RAW_TYPE, output.Buffer(),
+                output.BufferLength());
+        }
+    }
+
+    request->target.SendMessage(&message);
+    delete request;
+    return B_OK;
+}
+
+void BWebView::_ScrollBenchmarkTick()
+{
+    ScrollBenchmark* benchmark = fScrollBenchmark;
+    if (benchmark == nullptr)
+        return;
+
+    bigtime_t now = system_time();
+    float f = std::min(1.f,
+        float(now - benchmark->startTime) / benchmark->duration);
+
+    // Inject the next wheel step through the same path real wheel input
+    // takes (see the B_MOUSE_WHEEL_CHANGED case in MessageReceived()), so
+    // the benchmark exercises hit testing, the scrolling fast path and
+    // tile prefetching exactly like a user would.
+    float want = benchmark->distance * scrollBenchmarkPosition(
+        benchmark->curve, f);
+    float delta = want - benchmark->scrolled;
+    if (delta >= 1) {
+        BMessage wheel(B_MOUSE_WHEEL_CHANGED);
+        wheel.AddFloat("be:wheel_delta_x", 0);
+        // PlatformWheelEventHaiku negates the delta and scales it by the
+        // scrollbar line step; positive values here scroll down.
+        wheel.AddFloat("be:wheel_delta_y",
+            delta / Scrollbar::pixelsPerLineStep());
+        BPoint where(Bounds().Width() / 2, Bounds().Height() / 2);
+        BPoint screenWhere = ConvertToScreen(where);
+        fWebPage->mouseWheelChanged(&wheel, where, screenWhere);
+        benchmark->scrolled = want;
+        benchmark->lastInjectTime = now;
+    }
+
+    // Frame interval and input-to-blit latency, sampled from the Draw()
+    // bookkeeping. One latency sample per injection: the first frame
+    // blitted after a wheel event is the one the user was waiting for.
+    if (fLastDrawTime != benchmark->lastDrawSeen) {
+        if (benchmark->lastDrawSeen != 0) {
+            benchmark->intervalMax = std::max(benchmark->intervalMax,
+                fLastDrawTime - benchmark->lastDrawSeen);
+        }
+        if (benchmark->lastInjectTime != 0
+                && fLastDrawTime > benchmark->lastInjectTime) {
+            bigtime_t latency = fLastDrawTime - benchmark->lastInjectTime;
+            benchmark->latencySum += latency;
+            benchmark->latencyMax = std::max(benchmark->latencyMax, latency);
+            benchmark->latencySamples++;
+            benchmark->lastInjectTime = 0;
+        }
+        benchmark->lastDrawSeen = fLastDrawTime;
+    }
+
+#if USE(TILED_BACKING_STORE)
+    // Checkerboard area painted since the previous tick.
+    int64 area = TileHaiku::takeCheckerboardArea();
+    benchmark->checkerboardSum += area;
+    benchmark->checkerboardMax = std::max(benchmark->checkerboardMax, area);
+    benchmark->checkerboardSamples++;
+#endif
+
+    if (f >= 1)
+        _FinishScrollBenchmark();
+}
+
+void BWebView::_FinishScrollBenchmark()
+{
+    ScrollBenchmark* benchmark = fScrollBenchmark;
+    fScrollBenchmark = nullptr;
+
+    bigtime_t elapsed = system_time() - benchmark->startTime;
+    int64 frames = fDrawCount - benchmark->drawCountAtStart;
+
+    BMessage message(benchmark->reply);
+    switch (benchmark->curve) {
+    case ScrollBenchmark::Ease:
+        message.AddString("curve", "ease");
+        break;
+    case ScrollBenchmark::Flick:
+        message.AddString("curve", "flick");
+        break;
+    default:
+        message.AddString("curve", "constant");
+        break;
+    }
+    message.AddFloat("distance", benchmark->scrolled);
+    message.AddInt64("duration us", elapsed);
+    message.AddInt64("frames", frames);
+    if (frames > 0) {
+        message.AddInt64("mean frame interval us", elapsed / frames);
+        message.AddInt64("max frame interval us", benchmark->intervalMax);
+    }
+    if (benchmark->latencySamples > 0) {
+        message.AddInt64("mean latency us",
+            benchmark->latencySum / benchmark->latencySamples);
+        message.AddInt64("max latency us", benchmark->latencyMax);
+    }
+    if (benchmark->checkerboardSamples > 0) {
+        message.AddInt64("mean checkerboard px",
+            benchmark->checkerboardSum / benchmark->checkerboardSamples);
+        message.AddInt64("max checkerboard px", benchmark->checkerboardMax);
+        message.AddInt64("checkerboard px", benchmark->checkerboardSum);
+    }
+    benchmark->target.SendMessage(&message);
+
+    delete benchmark->runner;
+    delete benchmark;
+}
+
 void BWebView::_ResizeOffscreenView(int width, int height)
 {
 	if (width <= 1 || height <= 1)
@@ -603,6 +942,45 @@ void BWebView::_ResizeOffscreenView(int width, int height)
     }
 
     fOffscreenBitmap->Unlock();
+
+    // Grow the front buffer along with the back buffer. A plain bitmap is
+    // enough here; it is only ever filled via ImportBits().
+    fFrontBufferLock.Lock();
+    BBitmap* oldFront = fFrontBuffer;
+    fFrontBuffer = new BBitmap(bounds, B_RGB32);
+    if (oldFront) {
+        // Keep the old contents around until WebCore has repainted the
+        // newly exposed area.
+        fFrontBuffer->ImportBits(oldFront);
+        delete oldFront;
+    } else
+        memset(fFrontBuffer->Bits(), 0xff, fFrontBuffer->BitsLength());
+    fFrontBufferLock.Unlock();
+}
+
+
+void BWebView::_PublishFrame(BRect dirty)
+{
+    // Copy the freshly painted region from the back buffer to the front
+    // buffer. WebCore only repaints dirty rects, so the back buffer has to
+    // keep its contents between paints; a pointer-swapping swap chain would
+    // force a full repaint every frame, while copying just the dirty region
+    // gives Draw() the same never-blocks property at a fraction of the cost.
+    if (fOffscreenBitmap == NULL || !fOffscreenBitmap->Lock())
+        return;
+
+    fFrontBufferLock.Lock();
+    if (fFrontBuffer != NULL) {
+        dirty = dirty & fOffscreenBitmap->Bounds() & fFrontBuffer->Bounds();
+        if (dirty.IsValid()) {
+            BPoint origin(dirty.left, dirty.top);
+            fFrontBuffer->ImportBits(fOffscreenBitmap, origin, origin,
+                dirty.IntegerWidth() + 1, dirty.IntegerHeight() + 1);
+        }
+    }
+    fFrontBufferLock.Unlock();
+
+    fOffscreenBitmap->Unlock();
 }
 
 
@@ -29,14 +29,18 @@
 #define _WEB_VIEW_H_
 
 
+#include <Locker.h>
 #include <String.h>
 #include <View.h>
 #include <UrlContext.h>
 
 #include <memory>
 
+class BMessenger;
 class BWebPage;
 
+struct ScrollBenchmark;
+
 namespace WebCore {
     class AcceleratedCompositingContext;
     class ChromeClientHaiku;
@@ -118,6 +122,34 @@ public:
 	// BWebview API
 			void				SetAutoHidePointer(bool doIt);
 
+	// Captures the last composited frame for e.g. tab thumbnails without
+	// blocking the window or application threads: the front buffer is
+	// copied under its lock, then a worker thread scales the copy down to
+	// fit maxSize (preserving aspect ratio; ignored if not positive) and
+	// encodes it as PNG. The target receives a copy of the reply message
+	// with the encoded bytes attached as "png" (B_RAW_TYPE), or without
+	// that field if no frame was available or encoding failed.
+			void				RequestSnapshot(const BSize& maxSize,
+									const BMessage& reply,
+									const BMessenger& target);
+
+	// Scroll-quality measurement harness: scrolls the page by distance
+	// pixels over duration microseconds with synthetic wheel events fed
+	// through the same path real wheel input takes, and records what the
+	// user would have seen while it ran. curve selects the velocity
+	// profile: "constant", "ease" (slow-fast-slow) or "flick" (fast start,
+	// decaying). When the run ends, the target receives a copy of reply
+	// with the scorecard attached: frame count, mean and worst frame
+	// interval, mean and worst input-to-blit latency, and mean/worst/total
+	// checkerboard area per sample (px², requires the tiled backing
+	// store). Comparing scorecards across builds replaces "does scrolling
+	// feel better" arguments with numbers. One run at a time; requests
+	// made while a run is active are ignored.
+			void				RunScrollBenchmark(float distance,
+									bigtime_t duration, const char* curve,
+									const BMessage& reply,
+									const BMessenger& target);
+
 			void				SetUserData(UserData* cookie);
 			UserData*			GetUserData() const;
 
@@ -133,6 +165,10 @@ private:
 
             inline BBitmap*     OffscreenBitmap() const
                                     { return fOffscreenBitmap; }
+            // Duration of the most recent front buffer blit in Draw();
+            // feeds the B_FRAME_TIMING telemetry (see BWebPage).
+            inline bigtime_t    LastBlitDuration() const
+                                    { return fLastBlitDuration; }
             inline  BView*      OffscreenView() const
                                     { return fOffscreenView; }
 			void				SetOffscreenViewClean(BRect cleanRect,
@@ -142,7 +178,11 @@ private:
 			void				ExitVideoFullscreenForVideoElement(WebCore::HTMLVideoElement& element);
 
 private:
+    static	int32				_SnapshotWorker(void* data);
+			void				_ScrollBenchmarkTick();
+			void				_FinishScrollBenchmark();
             void                _ResizeOffscreenView(int width, int height);
+            void                _PublishFrame(BRect dirty);
 			void				_DispatchMouseEvent(const BPoint& where,
 									uint32 sanityWhat);
 			void				_DispatchKeyEvent(uint32 sanityWhat);
@@ -155,6 +195,20 @@ private:
             BBitmap*            fOffscreenBitmap;
             BView*              fOffscreenView;
 
+            // Completed frames are copied from the offscreen (back) bitmap
+            // into this front buffer, which is all Draw() ever touches. The
+            // window thread therefore only blits finished frames and never
+            // waits for WebCore to finish painting into the back buffer.
+            BLocker             fFrontBufferLock;
+            BBitmap*            fFrontBuffer;
+            bigtime_t           fLastBlitDuration;
+
+            // Written and read on the window thread only; the scroll
+            // benchmark samples them from its tick handler.
+            bigtime_t           fLastDrawTime;
+            int64               fDrawCount;
+            ScrollBenchmark*    fScrollBenchmark;
+
 			BWebPage*			fWebPage;
 
 			UserData*			fUserData;
@@ -51,7 +51,8 @@ enum {
     LOAD_STARTED =                                      319,
     RESPONSE_RECEIVED =                                 320,
     ICON_CHANGED =                                      321,
-    SSL_CERT_ERROR =                                    322
+    SSL_CERT_ERROR =                                    322,
+    FIRST_PAINT =                                       323
 };
 
 enum {
@@ -26,15 +26,27 @@
 
 #include "BackForwardList.h"
 
+#include "LegacyHistoryItemClient.h"
+#include "WebCore/BackForwardCache.h"
 #include "WebCore/Frame.h"
 #include "WebCore/FrameLoader.h"
 #include "WebCore/FrameLoaderClient.h"
 #include "WebCore/HistoryItem.h"
+#include "WebCore/KeyedCoding.h"
 #include "WebCore/SerializedScriptValue.h"
+#include "WebCore/SharedBuffer.h"
 
 static const unsigned DefaultCapacity = 100;
 static const unsigned NoCurrentItemIndex = UINT_MAX;
 
+// How many entries on either side of the current one keep their full
+// decoded state (document state, subframe item trees, serialized state
+// objects, cached page). Entries further away are trimmed down to what
+// saveState() would persist for them anyway -- URL, title, scroll
+// position -- and are rebuilt from their URL when navigated back to,
+// exactly like an entry restored by restoreState().
+static const unsigned LiveItemWindow = 5;
+
 using namespace WebCore;
 
 BackForwardList::BackForwardList()
@@ -76,6 +88,8 @@ void BackForwardList::addItem(WebCore::FrameIdentifier, Ref<HistoryItem>&& newIt
     m_entryHash.add(newItem.ptr());
     m_entries.insert(m_current + 1, WTFMove(newItem));
     ++m_current;
+
+    trimStaleItemState();
 }
 
 void BackForwardList::goToItem(HistoryItem& item)
@@ -89,6 +103,29 @@ void BackForwardList::goToItem(HistoryItem& item)
             break;
     if (index < m_entries.size()) {
         m_current = index;
+        trimStaleItemState();
+    }
+}
+
+void BackForwardList::trimStaleItemState()
+{
+    if (m_current == NoCurrentItemIndex)
+        return;
+
+    for (unsigned i = 0; i < m_entries.size(); ++i) {
+        unsigned distance
+            = i > m_current ? i - m_current : m_current - i;
+        if (distance <= LiveItemWindow)
+            continue;
+
+        HistoryItem& item = *m_entries[i];
+        if (item.isInBackForwardCache())
+            BackForwardCache::singleton().remove(item);
+        item.clearDocumentState();
+        item.clearChildren();
+        item.setStateObject(nullptr);
+        // Form data is deliberately kept: dropping it would silently turn
+        // a POST entry into a GET reload.
     }
 }
 
@@ -128,3 +165,85 @@ void BackForwardList::close()
     m_closed = true;
 }
 
+// Bump this whenever a field changes meaning; old blobs are then ignored
+// entirely rather than half-restored.
+static const uint32_t sessionStateVersion = 1;
+
+RefPtr<WebCore::SharedBuffer> BackForwardList::saveState() const
+{
+    auto encoder = KeyedEncoder::encoder();
+
+    encoder->encodeUInt32("version"_s, sessionStateVersion);
+    encoder->encodeBool("has-current"_s, m_current != NoCurrentItemIndex);
+    encoder->encodeUInt32("current"_s,
+        m_current == NoCurrentItemIndex ? 0 : m_current);
+    encoder->encodeObjects("entries"_s, m_entries.begin(), m_entries.end(),
+        [](KeyedEncoder& encoder, const RefPtr<HistoryItem>& item) {
+            encoder.encodeString("url"_s, item->urlString());
+            encoder.encodeString("title"_s, item->title());
+            encoder.encodeInt32("scroll-x"_s, item->scrollPosition().x());
+            encoder.encodeInt32("scroll-y"_s, item->scrollPosition().y());
+        });
+
+    return encoder->finishEncoding();
+}
+
+void BackForwardList::restoreState(std::span<const uint8_t> data)
+{
+    auto decoder = KeyedDecoder::decoder(data);
+
+    uint32_t version = 0;
+    if (!decoder->decodeUInt32("version"_s, version)
+        || version != sessionStateVersion) {
+        return;
+    }
+
+    struct DecodedEntry {
+        String url;
+        String title;
+        int32_t scrollX { 0 };
+        int32_t scrollY { 0 };
+    };
+    Vector<DecodedEntry> decodedEntries;
+    if (!decoder->decodeObjects("entries"_s, decodedEntries,
+        [](KeyedDecoder& decoder, DecodedEntry& entry) {
+            if (!decoder.decodeString("url"_s, entry.url))
+                return false;
+            if (!decoder.decodeString("title"_s, entry.title))
+                return false;
+            if (!decoder.decodeInt32("scroll-x"_s, entry.scrollX))
+                return false;
+            return decoder.decodeInt32("scroll-y"_s, entry.scrollY);
+        })) {
+        return;
+    }
+
+    bool hasCurrent = false;
+    uint32_t current = 0;
+    if (!decoder->decodeBool("has-current"_s, hasCurrent))
+        hasCurrent = false;
+    if (!decoder->decodeUInt32("current"_s, current))
+        current = 0;
+
+    m_entries.clear();
+    m_entryHash.clear();
+    m_current = NoCurrentItemIndex;
+
+    for (size_t i = 0; i < decodedEntries.size(); ++i) {
+        const DecodedEntry& decoded = decodedEntries[i];
+        Ref<HistoryItem> item = HistoryItem::create(
+            LegacyHistoryItemClient::singleton(), decoded.url, decoded.title);
+        // Only the entry shown right after the restore needs its view
+        // state; the others are loaded from their URL when navigated to.
+        if (hasCurrent && i == current)
+            item->setScrollPosition(IntPoint(decoded.scrollX, decoded.scrollY));
+        m_entryHash.add(item.ptr());
+        m_entries.append(WTFMove(item));
+    }
+
+    if (hasCurrent && current < m_entries.size())
+        m_current = current;
+    else if (!m_entries.isEmpty())
+        m_current = m_entries.size() - 1;
+}
+
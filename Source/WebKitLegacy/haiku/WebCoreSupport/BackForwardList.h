@@ -31,6 +31,12 @@
 #include <wtf/HashSet.h>
 #include <wtf/Vector.h>
 
+#include <span>
+
+namespace WebCore {
+class SharedBuffer;
+}
+
 typedef Vector<RefPtr<WebCore::HistoryItem>> HistoryItemVector;
 typedef HashSet<RefPtr<WebCore::HistoryItem>> HistoryItemHashSet;
 
@@ -63,12 +69,23 @@ public:
     void close() override;
     //bool closed() override;
 
+    // Compact binary session persistence built on the platform
+    // KeyedEncoder. Each entry is a self-contained object, and only the
+    // current one is fully materialized on restore; the others get their
+    // URL and title and fetch the rest when navigated to.
+    RefPtr<WebCore::SharedBuffer> saveState() const;
+    void restoreState(std::span<const uint8_t> data);
+
     //void removeItem(WebCore::HistoryItem&) override;
     //HistoryItemVector& entries() override;
 
 private:
     explicit BackForwardList();
 
+    // Drops the heavy decoded state of entries far from the current one;
+    // see LiveItemWindow in the implementation file.
+    void trimStaleItemState();
+
     HistoryItemVector m_entries;
     HistoryItemHashSet m_entryHash;
     unsigned m_current;
@@ -54,6 +54,8 @@ namespace WebCore {
         virtual ~ChromeClientHaiku();
         void chromeDestroyed() override;
 
+        BWebPage* webPage() const { return m_webPage; }
+
         void setWindowRect(const FloatRect&) override;
         FloatRect windowRect() const override;
 
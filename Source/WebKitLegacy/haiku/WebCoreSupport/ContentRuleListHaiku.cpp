@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE COMPUTER, INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE COMPUTER, INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "ContentRuleListHaiku.h"
+
+#if ENABLE(CONTENT_EXTENSIONS)
+
+#include "WebCore/ContentExtensionCompiler.h"
+#include "WebCore/ContentExtensionError.h"
+#include "WebCore/ContentExtensionParser.h"
+
+namespace WebKit {
+
+using namespace WebCore;
+
+// Collects the compiler's output sections into memory, in the order the
+// backend's span accessors hand them back out.
+class ContentRuleListHaiku::CompilationClient final
+    : public ContentExtensions::ContentExtensionCompilationClient {
+public:
+    explicit CompilationClient(Data& data)
+        : m_data(data)
+    {
+    }
+
+private:
+    void writeSource(String&&) final
+    {
+        // The source only matters to stores that recompile after a format
+        // version bump; the caller keeps the JSON file around instead.
+    }
+
+    void writeActions(Vector<ContentExtensions::SerializedActionByte>&& actions) final
+    {
+        m_data.actions.appendVector(actions);
+    }
+
+    void writeURLFiltersBytecode(Vector<ContentExtensions::DFABytecode>&& bytecode) final
+    {
+        m_data.urlFilters.appendVector(bytecode);
+    }
+
+    void writeTopURLFiltersBytecode(Vector<ContentExtensions::DFABytecode>&& bytecode) final
+    {
+        m_data.topURLFilters.appendVector(bytecode);
+    }
+
+    void writeFrameURLFiltersBytecode(Vector<ContentExtensions::DFABytecode>&& bytecode) final
+    {
+        m_data.frameURLFilters.appendVector(bytecode);
+    }
+
+    void finalize() final
+    {
+    }
+
+    Data& m_data;
+};
+
+RefPtr<ContentRuleListHaiku> ContentRuleListHaiku::create(String&& ruleJSON,
+    std::error_code& error)
+{
+    auto parsedRules = ContentExtensions::parseRuleList(ruleJSON);
+    if (!parsedRules.has_value()) {
+        error = parsedRules.error();
+        return nullptr;
+    }
+
+    Data data;
+    CompilationClient client(data);
+    error = ContentExtensions::compileRuleList(client, WTFMove(ruleJSON),
+        WTFMove(parsedRules.value()));
+    if (error)
+        return nullptr;
+
+    return adoptRef(*new ContentRuleListHaiku(WTFMove(data)));
+}
+
+ContentRuleListHaiku::ContentRuleListHaiku(Data&& data)
+    : m_data(WTFMove(data))
+{
+}
+
+std::span<const uint8_t> ContentRuleListHaiku::serializedActions() const
+{
+    return { m_data.actions.data(), m_data.actions.size() };
+}
+
+std::span<const uint8_t> ContentRuleListHaiku::urlFiltersBytecode() const
+{
+    return { m_data.urlFilters.data(), m_data.urlFilters.size() };
+}
+
+std::span<const uint8_t> ContentRuleListHaiku::topURLFiltersBytecode() const
+{
+    return { m_data.topURLFilters.data(), m_data.topURLFilters.size() };
+}
+
+std::span<const uint8_t> ContentRuleListHaiku::frameURLFiltersBytecode() const
+{
+    return { m_data.frameURLFilters.data(), m_data.frameURLFilters.size() };
+}
+
+} // namespace WebKit
+
+#endif // ENABLE(CONTENT_EXTENSIONS)
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2026 Haiku, inc.
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE COMPUTER, INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE COMPUTER, INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ContentRuleListHaiku_h
+#define ContentRuleListHaiku_h
+
+#if ENABLE(CONTENT_EXTENSIONS)
+
+#include "WebCore/CompiledContentExtension.h"
+#include <system_error>
+#include <wtf/RefPtr.h>
+#include <wtf/Vector.h>
+#include <wtf/text/WTFString.h>
+
+namespace WebKit {
+
+// A content rule list compiled from its WebKit JSON source into the DFA
+// bytecode that WebCore::ContentExtensions::ContentExtensionsBackend
+// interprets on the request path. The compiled form is held in memory for
+// the lifetime of the object; compile once at startup and install the
+// result into the view group's UserContentController.
+class ContentRuleListHaiku final
+    : public WebCore::ContentExtensions::CompiledContentExtension {
+public:
+    // Parses and compiles the given rule list JSON. Returns nullptr and
+    // sets the error code when the source does not parse or compile.
+    static RefPtr<ContentRuleListHaiku> create(WTF::String&& ruleJSON,
+        std::error_code& error);
+
+private:
+    struct Data {
+        Vector<WebCore::ContentExtensions::SerializedActionByte> actions;
+        Vector<WebCore::ContentExtensions::DFABytecode> urlFilters;
+        Vector<WebCore::ContentExtensions::DFABytecode> topURLFilters;
+        Vector<WebCore::ContentExtensions::DFABytecode> frameURLFilters;
+    };
+
+    class CompilationClient;
+
+    explicit ContentRuleListHaiku(Data&&);
+
+    // WebCore::ContentExtensions::CompiledContentExtension
+    std::span<const uint8_t> serializedActions() const final;
+    std::span<const uint8_t> urlFiltersBytecode() const final;
+    std::span<const uint8_t> topURLFiltersBytecode() const final;
+    std::span<const uint8_t> frameURLFiltersBytecode() const final;
+
+    Data m_data;
+};
+
+} // namespace WebKit
+
+#endif // ENABLE(CONTENT_EXTENSIONS)
+
+#endif // ContentRuleListHaiku_h
@@ -38,19 +38,129 @@
 #include <WebCore/FocusController.h>
 #include <WebCore/Frame.h>
 #include <WebCore/FrameSelection.h>
+#include <WebCore/HTMLInputElement.h>
 #include <WebCore/KeyboardEvent.h>
 #include <WebCore/NotImplemented.h>
 #include <WebCore/Page.h>
 #include <WebCore/PlatformKeyboardEvent.h>
 #include <WebCore/Settings.h>
+#include <WebCore/TextChecking.h>
 #include <WebCore/WindowsKeyboardCodes.h>
 
+#include "WebAutofill.h"
 #include "WebFrame.h"
 #include "WebViewConstants.h"
 #include "WebPage.h"
 
+#include <File.h>
+#include <FindDirectory.h>
+#include <Path.h>
+
+#include <unicode/uchar.h>
+#include <wtf/HashSet.h>
+#include <wtf/Lock.h>
+
 namespace WebCore {
 
+// #pragma mark - spell checking dictionary
+
+// The system word list (the same one StyledEdit's spell checker uses).
+// Loaded once, lazily, on a low priority background thread; until it is
+// ready everything is reported as correctly spelled, and WebCore simply
+// asks again on the next edit.
+static Lock s_dictionaryLock;
+static HashSet<String> s_dictionary;
+static enum { DictionaryNotLoaded, DictionaryLoading, DictionaryLoaded }
+    s_dictionaryState = DictionaryNotLoaded;
+
+static int32 load_dictionary_entry(void*)
+{
+    HashSet<String> words;
+
+    BPath path;
+    if (find_directory(B_SYSTEM_DATA_DIRECTORY, &path) == B_OK
+        && path.Append("spell_check/word_dictionary") == B_OK) {
+        BFile file(path.Path(), B_READ_ONLY);
+        off_t size = 0;
+        if (file.InitCheck() == B_OK && file.GetSize(&size) == B_OK) {
+            Vector<char> buffer(size);
+            if (file.Read(buffer.data(), size) == size) {
+                size_t start = 0;
+                for (size_t i = 0; i <= (size_t)size; i++) {
+                    if (i < (size_t)size && buffer[i] != '\n')
+                        continue;
+                    if (i > start) {
+                        words.add(String::fromUTF8(std::span<const char>(
+                            buffer.data() + start, i - start))
+                            .convertToLowercaseWithoutLocale());
+                    }
+                    start = i + 1;
+                }
+            }
+        }
+    }
+
+    Locker locker { s_dictionaryLock };
+    s_dictionary = WTFMove(words);
+    s_dictionaryState = DictionaryLoaded;
+    return 0;
+}
+
+// Returns whether the dictionary is ready for lookups, and kicks off the
+// loader thread on the first call.
+static bool ensureDictionary()
+{
+    Locker locker { s_dictionaryLock };
+    if (s_dictionaryState == DictionaryLoaded)
+        return !s_dictionary.isEmpty();
+
+    if (s_dictionaryState == DictionaryNotLoaded) {
+        thread_id thread = spawn_thread(load_dictionary_entry,
+            "dictionary loader", B_LOW_PRIORITY, NULL);
+        if (thread >= B_OK) {
+            s_dictionaryState = DictionaryLoading;
+            resume_thread(thread);
+        }
+    }
+    return false;
+}
+
+static bool isWordMisspelled(const String& word)
+{
+    // Single letters and abbreviations with digits are not worth marking.
+    if (word.length() < 2)
+        return false;
+
+    Locker locker { s_dictionaryLock };
+    return !s_dictionary.contains(word.convertToLowercaseWithoutLocale());
+}
+
+// Appends the range of every misspelled word in text. Apostrophes between
+// letters belong to the word ("doesn't").
+static void collectMisspelledWords(StringView text,
+    Vector<CharacterRange>& misspellings)
+{
+    unsigned length = text.length();
+    unsigned wordStart = 0;
+    bool inWord = false;
+
+    for (unsigned i = 0; i <= length; i++) {
+        UChar c = i < length ? text[i] : ' ';
+        bool wordCharacter = u_isalpha(c) || (c == '\'' && inWord
+            && i + 1 < length && u_isalpha(text[i + 1]));
+
+        if (wordCharacter && !inWord) {
+            wordStart = i;
+            inWord = true;
+        } else if (!wordCharacter && inWord) {
+            inWord = false;
+            if (isWordMisspelled(text.substring(wordStart,
+                    i - wordStart).toString()))
+                misspellings.append(CharacterRange(wordStart, i - wordStart));
+        }
+    }
+}
+
 EditorClientHaiku::EditorClientHaiku(BWebPage* page)
     : m_page(page)
     , m_isInRedo(false)
@@ -74,13 +184,12 @@ bool EditorClientHaiku::smartInsertDeleteEnabled()
 
 bool EditorClientHaiku::isContinuousSpellCheckingEnabled()
 {
-    notImplemented();
-    return false;
+    return m_continuousSpellChecking;
 }
 
 void EditorClientHaiku::toggleContinuousSpellChecking()
 {
-    notImplemented();
+    m_continuousSpellChecking = !m_continuousSpellChecking;
 }
 
 bool EditorClientHaiku::isGrammarCheckingEnabled()
@@ -311,8 +420,18 @@ void EditorClientHaiku::textFieldDidBeginEditing(Element&)
 {
 }
 
-void EditorClientHaiku::textFieldDidEndEditing(Element&)
+void EditorClientHaiku::textFieldDidEndEditing(Element& element)
 {
+    // Feed the autofill index; it answers the embedder's prefix queries on
+    // the next focus without rescanning stored entries.
+    auto* input = dynamicDowncast<HTMLInputElement>(element);
+    if (!input || !input->isTextField() || input->isPasswordField()
+        || !input->shouldAutocomplete())
+        return;
+
+    BString name = input->name().string();
+    BString value = input->value();
+    BWebAutofill::Default()->AddEntry(name, value);
 }
 
 void EditorClientHaiku::textDidChangeInTextField(Element&)
@@ -354,9 +473,26 @@ void EditorClientHaiku::learnWord(const String&)
     notImplemented();
 }
 
-void EditorClientHaiku::checkSpellingOfString(StringView, int*, int*)
+void EditorClientHaiku::checkSpellingOfString(StringView text,
+    int* misspellingLocation, int* misspellingLength)
 {
-    notImplemented();
+    if (misspellingLocation)
+        *misspellingLocation = -1;
+    if (misspellingLength)
+        *misspellingLength = 0;
+
+    if (!ensureDictionary())
+        return;
+
+    Vector<CharacterRange> misspellings;
+    collectMisspelledWords(text, misspellings);
+    if (misspellings.isEmpty())
+        return;
+
+    if (misspellingLocation)
+        *misspellingLocation = misspellings[0].location;
+    if (misspellingLength)
+        *misspellingLength = misspellings[0].length;
 }
 
 #if 0
@@ -377,9 +513,38 @@ void EditorClientHaiku::getGuessesForWord(const String&, const String&, const We
     notImplemented();
 }
 
-void EditorClientHaiku::requestCheckingOfString(TextCheckingRequest&, const WebCore::VisibleSelection&)
+void EditorClientHaiku::requestCheckingOfString(TextCheckingRequest& request,
+    const WebCore::VisibleSelection&)
 {
-    notImplemented();
+    Ref<TextCheckingRequest> protectedRequest(request);
+    const TextCheckingRequestData& data = protectedRequest->data();
+
+    // This is the asynchronous checking path: WebCore's SpellChecker hands
+    // us only the dirtied paragraph (TextCheckingProcessIncremental), so
+    // the amount of work per edit does not grow with the document. The
+    // results are applied as document markers by the caller.
+    if (!m_continuousSpellChecking
+        || !data.checkingTypes().contains(TextCheckingType::Spelling)
+        || !ensureDictionary()) {
+        // Nothing to check against (yet); WebCore asks again on the next
+        // edit, by which time the dictionary thread may have finished.
+        protectedRequest->didCancel();
+        return;
+    }
+
+    Vector<CharacterRange> misspellings;
+    collectMisspelledWords(data.text(), misspellings);
+
+    Vector<TextCheckingResult> results;
+    results.reserveInitialCapacity(misspellings.size());
+    for (const CharacterRange& range : misspellings) {
+        TextCheckingResult result;
+        result.type = TextCheckingType::Spelling;
+        result.range = range;
+        results.append(WTFMove(result));
+    }
+
+    protectedRequest->didSucceed(results);
 }
 
 void EditorClientHaiku::updateSpellingUIWithGrammarString(const String&, const GrammarDetail&)
@@ -160,6 +160,8 @@ private:
     BString m_pendingPreedit;
 
     bool m_lastSelectionWasPainted { false };
+
+    bool m_continuousSpellChecking { true };
 };
 
 } // namespace WebCore
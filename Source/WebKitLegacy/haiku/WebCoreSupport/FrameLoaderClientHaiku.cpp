@@ -65,6 +65,7 @@
 #include "WebCore/Settings.h"
 #include "WebFrame.h"
 #include "WebFramePrivate.h"
+#include "WebHistory.h"
 #include "WebKitInfo.h"
 #include "WebPage.h"
 #include "WebView.h"
@@ -440,6 +441,11 @@ void FrameLoaderClientHaiku::dispatchDidCommitLoad(
     message.AddString("url", decoded);
     dispatchMessage(message);
 
+    // The old document is gone now; close the paint gate so the view is not
+    // repainted over and over while the new page is still mostly empty.
+    if (m_webFrame == m_webPage->MainFrame())
+        m_webPage->suppressPaintsUntilFirstVisualLayout();
+
     // We should assume first the frame has no title. If it has, then the above
     // dispatchDidReceiveTitle() will be called very soon with the correct title.
     // This properly resets the title when we navigate to a URI without a title.
@@ -456,6 +462,9 @@ void FrameLoaderClientHaiku::dispatchDidFailProvisionalLoad(const ResourceError&
 void FrameLoaderClientHaiku::dispatchDidFailLoad(const ResourceError& error)
 {
     CALLED();
+    // Whatever content there is won't get any better; show it.
+    m_webPage->releasePaintGate();
+
     if (m_loadingErrorPage) {
         TRACE("m_loadingErrorPage\n");
         return;
@@ -500,6 +509,14 @@ void FrameLoaderClientHaiku::dispatchDidFinishLoad()
     dispatchMessage(message);
 }
 
+void FrameLoaderClientHaiku::dispatchDidReachLayoutMilestone(OptionSet<LayoutMilestone> milestones)
+{
+    // This is the "there is something worth looking at now" signal we
+    // requested in the page configuration; it opens the paint gate.
+    if (milestones.contains(LayoutMilestone::DidFirstVisuallyNonEmptyLayout))
+        m_webPage->releasePaintGate();
+}
+
 void FrameLoaderClientHaiku::dispatchWillSubmitForm(FormState&, WTF::CompletionHandler<void()>&& function)
 {
     CALLED();
@@ -677,8 +694,11 @@ void FrameLoaderClientHaiku::updateGlobalHistory()
     if (!frame)
         return;
 
+    BString url = frame->loader().documentLoader()->urlForHistory().string();
+    BWebHistory::Default()->AddVisit(url);
+
     BMessage message(UPDATE_HISTORY);
-    message.AddString("url", frame->loader().documentLoader()->urlForHistory().string());
+    message.AddString("url", url);
     dispatchMessage(message);
 }
 
@@ -113,6 +113,7 @@ class FrameLoaderClientHaiku : public LocalFrameLoaderClient {
     void dispatchDidFailLoad(const ResourceError&) override;
     void dispatchDidFinishDocumentLoad() override;
     void dispatchDidFinishLoad() override;
+    void dispatchDidReachLayoutMilestone(OptionSet<LayoutMilestone>) override;
 
     LocalFrame* dispatchCreatePage(const NavigationAction&, NewFrameOpenerPolicy) override;
     void dispatchShow() override;
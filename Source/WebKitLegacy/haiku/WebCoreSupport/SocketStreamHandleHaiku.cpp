@@ -72,20 +72,15 @@ std::optional<size_t> SocketStreamHandleImpl::platformSendInternal(std::span<con
     LOG(Network, "SocketStreamHandle %p platformSend", this);
     ASSERT(isMainThread());
 
-    if (m_hasPendingWriteData)
-        return 0;
-
-    m_hasPendingWriteData = true;
+    Locker locker { m_sendLock };
 
-    auto writeBuffer = makeUniqueArray<uint8_t>(data.size());
-    memcpy(writeBuffer.get(), data.data(), data.size());
+    // Backpressure: let the caller queue the frame in its own buffer and
+    // retry when the worker has drained ours.
+    if (m_pendingSendData.size() + data.size() > kMaxPendingSendBytes)
+        return 0;
 
-    callOnWorkerThread([this, writeBuffer = WTFMove(writeBuffer), writeBufferSize = data.size()]() mutable {
-        ASSERT(!isMainThread());
-        m_writeBuffer = WTFMove(writeBuffer);
-        m_writeBufferSize = writeBufferSize;
-        m_writeBufferOffset = 0;
-    });
+    // Coalesce: frames queued back to back leave in a single Write.
+    m_pendingSendData.append(data);
 
     return data.size();
 }
@@ -128,33 +123,47 @@ void SocketStreamHandleImpl::threadEntryPoint()
     while (m_running) {
         executeTasks();
 
+        bool haveSendData = m_sendScratchOffset < m_sendScratch.size();
+        if (!haveSendData) {
+            Locker locker { m_sendLock };
+            haveSendData = !m_pendingSendData.isEmpty();
+        }
+
         status_t readable = socket->WaitForReadable(20 * 1000);
 		status_t writable = B_ERROR;
-        if (m_writeBuffer.get() != nullptr)
+        if (haveSendData)
 			writable = socket->WaitForWritable(20 * 1000);
 
         // These logic only run when there's data waiting.
         if ((writable == B_OK) && m_running) {
-            auto bytesSent = socket->Write(m_writeBuffer.get() + m_writeBufferOffset, m_writeBufferSize - m_writeBufferOffset);
-            m_writeBufferOffset += bytesSent;
+            if (m_sendScratchOffset >= m_sendScratch.size()) {
+                // Grab everything queued since the last drain in one swap;
+                // the buffers keep their capacity across batches.
+                Locker locker { m_sendLock };
+                m_sendScratch.shrink(0);
+                m_sendScratchOffset = 0;
+                std::swap(m_sendScratch, m_pendingSendData);
+            }
 
-            if (m_writeBufferSize <= m_writeBufferOffset) {
-                m_writeBuffer = nullptr;
-                m_writeBufferSize = 0;
-                m_writeBufferOffset = 0;
+            // One Write for the whole batch (through the TLS layer on wss).
+            auto bytesSent = socket->Write(m_sendScratch.data() + m_sendScratchOffset, m_sendScratch.size() - m_sendScratchOffset);
+            if (bytesSent > 0)
+                m_sendScratchOffset += bytesSent;
 
+            if (m_sendScratchOffset >= m_sendScratch.size()) {
                 callOnMainThread([this, protectedThis = Ref{*this}] {
-                    m_hasPendingWriteData = false;
                     sendPendingData();
                 });
             }
         }
 
         if ((readable == B_OK) && m_running) {
-            auto readBuffer = makeUniqueArray<uint8_t>(kReadBufferSize);
-            ssize_t bytesRead = socket->Read(readBuffer.get(), kReadBufferSize);
+            Vector<uint8_t> readBuffer = takeReadBuffer();
+            ssize_t bytesRead = socket->Read(readBuffer.data(), readBuffer.size());
             // `0` result means nothing to handle at this moment.
             if (bytesRead <= 0) {
+                returnReadBuffer(WTFMove(readBuffer));
+
 				// Make sure we are still connected.
 				if (!socket->IsConnected()) {
 					m_running = false;
@@ -166,17 +175,34 @@ void SocketStreamHandleImpl::threadEntryPoint()
                 continue;
 			}
 
-            callOnMainThread([this, protectedThis = Ref{*this}, buffer = WTFMove(readBuffer), size = bytesRead ] {
+            callOnMainThread([this, protectedThis = Ref{*this}, buffer = WTFMove(readBuffer), size = bytesRead ]() mutable {
                 if (m_state == Open)
-                    m_client.didReceiveSocketStreamData(*this, std::span<const unsigned char>(buffer.get(), size));
+                    m_client.didReceiveSocketStreamData(*this, std::span<const unsigned char>(buffer.data(), size));
+                returnReadBuffer(WTFMove(buffer));
             });
         }
     }
 
-    m_writeBuffer = nullptr;
 	delete socket;
 }
 
+Vector<uint8_t> SocketStreamHandleImpl::takeReadBuffer()
+{
+    Locker locker { m_readBufferPoolLock };
+
+    if (!m_readBufferPool.isEmpty())
+        return m_readBufferPool.takeLast();
+    return Vector<uint8_t>(kReadBufferSize);
+}
+
+void SocketStreamHandleImpl::returnReadBuffer(Vector<uint8_t>&& buffer)
+{
+    Locker locker { m_readBufferPoolLock };
+
+    if (m_readBufferPool.size() < kReadBufferPoolSize)
+        m_readBufferPool.append(WTFMove(buffer));
+}
+
 void SocketStreamHandleImpl::handleError(status_t errorCode)
 {
     m_running = false;
@@ -40,6 +40,7 @@
 #include <wtf/StreamBuffer.h>
 #include <wtf/Threading.h>
 #include <wtf/UniqueArray.h>
+#include <wtf/Vector.h>
 
 #include <OS.h>
 
@@ -75,7 +76,12 @@ private:
     void callOnWorkerThread(Function<void()>&&);
     void executeTasks();
 
-    static const size_t kReadBufferSize = 4 * 1024;
+    Vector<uint8_t> takeReadBuffer();
+    void returnReadBuffer(Vector<uint8_t>&&);
+
+    static const size_t kReadBufferSize = 16 * 1024;
+    static const size_t kReadBufferPoolSize = 8;
+    static const size_t kMaxPendingSendBytes = 1024 * 1024;
 
     RefPtr<const StorageSessionProvider> m_storageSessionProvider;
     RefPtr<Thread> m_workerThread;
@@ -83,10 +89,19 @@ private:
 
     MessageQueue<Function<void()>> m_taskQueue;
 
-    bool m_hasPendingWriteData { false };
-    size_t m_writeBufferSize { 0 };
-    size_t m_writeBufferOffset { 0 };
-    UniqueArray<uint8_t> m_writeBuffer;
+    // Frames queued on the main thread accumulate in m_pendingSendData and
+    // are swapped wholesale into m_sendScratch when the worker drains, so
+    // a burst of small sends leaves in one Write and both buffers keep
+    // their capacity across batches.
+    Lock m_sendLock;
+    Vector<uint8_t> m_pendingSendData;
+    Vector<uint8_t> m_sendScratch;
+    size_t m_sendScratchOffset { 0 };
+
+    // Recycled receive buffers; returned to the pool once the client has
+    // consumed the data on the main thread.
+    Lock m_readBufferPoolLock;
+    Vector<Vector<uint8_t>> m_readBufferPool;
 
     StreamBuffer<uint8_t, 1024 * 1024> m_buffer;
     static const unsigned maxBufferSize = 100 * 1024 * 1024;
@@ -0,0 +1,311 @@
+/*
+ * Copyright (C) 2026 Haiku, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "WebCacheStorageProvider.h"
+
+#include "WebCore/ClientOrigin.h"
+#include "pal/crypto/CryptoDigest.h"
+#include <wtf/HashMap.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Vector.h>
+
+using namespace WebCore;
+using namespace WebCore::DOMCacheEngine;
+
+// Everything runs in-process on the main thread, so the whole engine is a
+// process-wide store shared by every connection. Caches keep their records
+// in memory; a removed cache stays reachable through its identifier until
+// the last DOMCache holding it goes away, matching the spec behavior of
+// Cache objects surviving caches.delete().
+
+struct CacheState {
+    WTF_MAKE_STRUCT_FAST_ALLOCATED;
+
+    DOMCacheIdentifier identifier;
+    ClientOrigin origin;
+    String name;
+    Vector<Record> records;
+    uint64_t nextRecordIdentifier { 1 };
+    unsigned referenceCount { 0 };
+    bool removed { false };
+};
+
+struct CacheStorageStore {
+    HashMap<ClientOrigin, Vector<DOMCacheIdentifier>> cachesPerOrigin;
+    HashMap<DOMCacheIdentifier, std::unique_ptr<CacheState>> caches;
+
+    // Response bodies keyed by the SHA-256 of their bytes. Putting a body
+    // whose digest is already known shares the existing buffer instead of
+    // keeping another copy, across entries, caches and origins; the same
+    // bundle cached under many URLs is stored once.
+    HashMap<String, Ref<SharedBuffer>> bodiesByDigest;
+
+    uint64_t updateCounter { 0 };
+};
+
+static CacheStorageStore& cacheStore()
+{
+    static NeverDestroyed<CacheStorageStore> store;
+    return store;
+}
+
+static void internResponseBody(ResponseBody& body)
+{
+    auto* buffer = std::get_if<Ref<SharedBuffer>>(&body);
+    if (!buffer)
+        return;
+
+    auto digest = PAL::CryptoDigest::create(PAL::CryptoDigest::Algorithm::SHA_256);
+    digest->addBytes((*buffer)->span());
+    auto key = digest->toHexString();
+
+    auto result = cacheStore().bodiesByDigest.ensure(key, [&] {
+        return Ref<SharedBuffer> { *buffer };
+    });
+    if (!result.isNewEntry && result.iterator->value->size() == (*buffer)->size())
+        body = Ref<SharedBuffer> { result.iterator->value };
+}
+
+static void pruneInternedBodies()
+{
+    // Drop table entries no record references anymore; they only pinned the
+    // buffer for future deduplication.
+    cacheStore().bodiesByDigest.removeIf([](auto& entry) {
+        return entry.value->hasOneRef();
+    });
+}
+
+static CacheState* cacheForIdentifier(DOMCacheIdentifier identifier)
+{
+    auto iterator = cacheStore().caches.find(identifier);
+    return iterator == cacheStore().caches.end() ? nullptr : iterator->value.get();
+}
+
+static void destroyCache(CacheState& cache)
+{
+    auto& store = cacheStore();
+    auto identifiers = store.cachesPerOrigin.find(cache.origin);
+    if (identifiers != store.cachesPerOrigin.end()) {
+        identifiers->value.removeFirst(cache.identifier);
+        if (identifiers->value.isEmpty())
+            store.cachesPerOrigin.remove(identifiers);
+    }
+    store.caches.remove(cache.identifier);
+    pruneInternedBodies();
+}
+
+class WebCacheStorageConnection final : public CacheStorageConnection {
+public:
+    static Ref<WebCacheStorageConnection> create() { return adoptRef(*new WebCacheStorageConnection); }
+
+private:
+    WebCacheStorageConnection() = default;
+
+    Ref<OpenPromise> open(const ClientOrigin&, const String& cacheName) final;
+    Ref<RemovePromise> remove(DOMCacheIdentifier) final;
+    Ref<RetrieveCachesPromise> retrieveCaches(const ClientOrigin&, uint64_t updateCounter) final;
+    Ref<RetrieveRecordsPromise> retrieveRecords(DOMCacheIdentifier, RetrieveRecordsOptions&&) final;
+    Ref<BatchPromise> batchDeleteOperation(DOMCacheIdentifier, const ResourceRequest&, CacheQueryOptions&&) final;
+    Ref<BatchPromise> batchPutOperation(DOMCacheIdentifier, Vector<CrossThreadRecord>&&) final;
+
+    void reference(DOMCacheIdentifier) final;
+    void dereference(DOMCacheIdentifier) final;
+    void lockStorage(const ClientOrigin&) final { }
+    void unlockStorage(const ClientOrigin&) final { }
+};
+
+Ref<WebCacheStorageConnection::OpenPromise> WebCacheStorageConnection::open(const ClientOrigin& origin, const String& cacheName)
+{
+    auto& store = cacheStore();
+    auto& identifiers = store.cachesPerOrigin.ensure(origin, [] {
+        return Vector<DOMCacheIdentifier> { };
+    }).iterator->value;
+
+    for (auto identifier : identifiers) {
+        auto* cache = cacheForIdentifier(identifier);
+        if (cache && !cache->removed && cache->name == cacheName)
+            return OpenPromise::createAndResolve(CacheIdentifierOperationResult { identifier, false });
+    }
+
+    auto cache = makeUnique<CacheState>();
+    cache->identifier = DOMCacheIdentifier::generate();
+    cache->origin = origin;
+    cache->name = cacheName;
+
+    auto identifier = cache->identifier;
+    identifiers.append(identifier);
+    store.caches.add(identifier, WTFMove(cache));
+    store.updateCounter++;
+
+    return OpenPromise::createAndResolve(CacheIdentifierOperationResult { identifier, false });
+}
+
+Ref<WebCacheStorageConnection::RemovePromise> WebCacheStorageConnection::remove(DOMCacheIdentifier identifier)
+{
+    auto* cache = cacheForIdentifier(identifier);
+    if (!cache || cache->removed)
+        return RemovePromise::createAndResolve(false);
+
+    cache->removed = true;
+    cacheStore().updateCounter++;
+    if (!cache->referenceCount)
+        destroyCache(*cache);
+
+    return RemovePromise::createAndResolve(true);
+}
+
+Ref<WebCacheStorageConnection::RetrieveCachesPromise> WebCacheStorageConnection::retrieveCaches(const ClientOrigin& origin, uint64_t)
+{
+    auto& store = cacheStore();
+    CacheInfos result;
+    result.updateCounter = store.updateCounter;
+
+    auto identifiers = store.cachesPerOrigin.find(origin);
+    if (identifiers != store.cachesPerOrigin.end()) {
+        for (auto identifier : identifiers->value) {
+            auto* cache = cacheForIdentifier(identifier);
+            if (cache && !cache->removed)
+                result.infos.append(CacheInfo { identifier, cache->name });
+        }
+    }
+
+    return RetrieveCachesPromise::createAndResolve(WTFMove(result));
+}
+
+Ref<WebCacheStorageConnection::RetrieveRecordsPromise> WebCacheStorageConnection::retrieveRecords(DOMCacheIdentifier identifier, RetrieveRecordsOptions&& options)
+{
+    auto* cache = cacheForIdentifier(identifier);
+    if (!cache)
+        return RetrieveRecordsPromise::createAndReject(Error::Internal);
+
+    Vector<CrossThreadRecord> result;
+    bool matchAll = options.request.url().isNull();
+    if (!matchAll && !options.ignoreMethod && options.request.httpMethod() != "GET"_s)
+        return RetrieveRecordsPromise::createAndResolve(WTFMove(result));
+
+    CacheQueryOptions queryOptions { options.ignoreSearch, options.ignoreMethod, options.ignoreVary };
+    for (auto& record : cache->records) {
+        if (!matchAll && !queryCacheMatch(options.request, record.request, record.response, queryOptions))
+            continue;
+
+        CrossThreadRecord copy { record.identifier, record.updateResponseCounter, record.requestHeadersGuard,
+            ResourceRequest { record.request }, record.options, String { record.referrer },
+            record.responseHeadersGuard, { }, nullptr, 0 };
+        if (options.shouldProvideResponse) {
+            copy.response = record.response.crossThreadData();
+            copy.responseBody = copyResponseBody(record.responseBody);
+            copy.responseBodySize = record.responseBodySize;
+        }
+        result.append(WTFMove(copy));
+    }
+
+    return RetrieveRecordsPromise::createAndResolve(WTFMove(result));
+}
+
+Ref<WebCacheStorageConnection::BatchPromise> WebCacheStorageConnection::batchDeleteOperation(DOMCacheIdentifier identifier, const ResourceRequest& request, CacheQueryOptions&& options)
+{
+    auto* cache = cacheForIdentifier(identifier);
+    if (!cache)
+        return BatchPromise::createAndReject(Error::Internal);
+
+    Vector<uint64_t> removedIdentifiers;
+    if (!options.ignoreMethod && request.httpMethod() != "GET"_s)
+        return BatchPromise::createAndResolve(WTFMove(removedIdentifiers));
+
+    cache->records.removeAllMatching([&](auto& record) {
+        if (!queryCacheMatch(request, record.request, record.response, options))
+            return false;
+        removedIdentifiers.append(record.identifier);
+        return true;
+    });
+    pruneInternedBodies();
+
+    return BatchPromise::createAndResolve(WTFMove(removedIdentifiers));
+}
+
+Ref<WebCacheStorageConnection::BatchPromise> WebCacheStorageConnection::batchPutOperation(DOMCacheIdentifier identifier, Vector<CrossThreadRecord>&& records)
+{
+    auto* cache = cacheForIdentifier(identifier);
+    if (!cache)
+        return BatchPromise::createAndReject(Error::Internal);
+
+    Vector<uint64_t> putIdentifiers;
+    putIdentifiers.reserveInitialCapacity(records.size());
+
+    for (auto& crossThreadRecord : records) {
+        auto record = fromCrossThreadRecord(WTFMove(crossThreadRecord));
+        internResponseBody(record.responseBody);
+
+        CacheQueryOptions queryOptions;
+        auto index = cache->records.findIf([&](auto& existing) {
+            return queryCacheMatch(record.request, existing.request, existing.response, queryOptions);
+        });
+        if (index != notFound) {
+            // Same request already cached: replace the response side and keep
+            // the record identity so existing FetchResponses get updated.
+            auto& existing = cache->records[index];
+            existing.updateResponseCounter++;
+            existing.responseHeadersGuard = record.responseHeadersGuard;
+            existing.response = WTFMove(record.response);
+            existing.responseBody = WTFMove(record.responseBody);
+            existing.responseBodySize = record.responseBodySize;
+            putIdentifiers.append(existing.identifier);
+            continue;
+        }
+
+        record.identifier = cache->nextRecordIdentifier++;
+        record.updateResponseCounter = 0;
+        putIdentifiers.append(record.identifier);
+        cache->records.append(WTFMove(record));
+    }
+    pruneInternedBodies();
+
+    return BatchPromise::createAndResolve(WTFMove(putIdentifiers));
+}
+
+void WebCacheStorageConnection::reference(DOMCacheIdentifier identifier)
+{
+    if (auto* cache = cacheForIdentifier(identifier))
+        cache->referenceCount++;
+}
+
+void WebCacheStorageConnection::dereference(DOMCacheIdentifier identifier)
+{
+    auto* cache = cacheForIdentifier(identifier);
+    if (!cache)
+        return;
+
+    ASSERT(cache->referenceCount);
+    if (--cache->referenceCount || !cache->removed)
+        return;
+
+    destroyCache(*cache);
+}
+
+Ref<CacheStorageConnection> WebCacheStorageProvider::createCacheStorageConnection()
+{
+    return WebCacheStorageConnection::create();
+}
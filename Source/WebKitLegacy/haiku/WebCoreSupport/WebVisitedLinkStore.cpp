@@ -82,6 +82,11 @@ bool WebVisitedLinkStore::isLinkVisited(Page& page, SharedStringHash linkHash, c
 {
     populateVisitedLinksIfNeeded(page);
 
+    // Unvisited links (the overwhelming majority on a typical page) are
+    // rejected by the bloom filter without a hash set probe.
+    if (!m_linkFilter.mayContain(linkHash))
+        return false;
+
     return m_visitedLinkHashes.contains(linkHash);
 }
 
@@ -123,7 +128,11 @@ void WebVisitedLinkStore::populateVisitedLinksIfNeeded(Page& sourcePage)
 void WebVisitedLinkStore::addVisitedLinkHash(SharedStringHash linkHash)
 {
     ASSERT(s_shouldTrackVisitedLinks);
-    m_visitedLinkHashes.add(linkHash);
+    // Revisiting an already known link must not invalidate styles again;
+    // only a hash that actually changes the set affects :visited matching.
+    if (!m_visitedLinkHashes.add(linkHash).isNewEntry)
+        return;
+    m_linkFilter.add(linkHash);
 
     invalidateStylesForLink(linkHash);
 }
@@ -134,6 +143,7 @@ void WebVisitedLinkStore::removeVisitedLinkHashes()
     if (m_visitedLinkHashes.isEmpty())
         return;
     m_visitedLinkHashes.clear();
+    m_linkFilter.clear();
 
     invalidateStylesForAllLinks();
 }
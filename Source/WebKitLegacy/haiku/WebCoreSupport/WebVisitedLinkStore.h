@@ -28,6 +28,7 @@
 
 #include <WebCore/platform/SharedStringHash.h>
 #include <WebCore/page/VisitedLinkStore.h>
+#include <wtf/BloomFilter.h>
 
 class WebVisitedLinkStore final : public WebCore::VisitedLinkStore {
 public:
@@ -50,6 +51,10 @@ private:
     void removeVisitedLinkHashes();
 
     HashSet<WebCore::SharedStringHash, WebCore::SharedStringHashHash> m_visitedLinkHashes;
+    // Probabilistic front filter for the common case: almost every link on a
+    // page is unvisited, and the filter rejects those without touching the
+    // hash set. False positives just fall through to the set.
+    WTF::BloomFilter<16> m_linkFilter;
     bool m_visitedLinksPopulated;
 };
 
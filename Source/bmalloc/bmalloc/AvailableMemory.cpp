@@ -55,6 +55,8 @@
 #include <sys/sysctl.h>
 #include <sys/types.h>
 #include <sys/user.h>
+#elif BOS(HAIKU)
+#include <OS.h>
 #endif
 #include <unistd.h>
 #endif
@@ -187,7 +189,7 @@ size_t availableMemory()
     return availableMemory;
 }
 
-#if BPLATFORM(IOS_FAMILY) || BOS(LINUX) || BOS(FREEBSD)
+#if BPLATFORM(IOS_FAMILY) || BOS(LINUX) || BOS(FREEBSD) || BOS(HAIKU)
 MemoryStatus memoryStatus()
 {
 #if BPLATFORM(IOS_FAMILY)
@@ -213,6 +215,14 @@ MemoryStatus memoryStatus()
     size_t memoryFootprint = 0;
     if (!sysctl(mib, 4, &info, &infolen, nullptr, 0))
         memoryFootprint = static_cast<size_t>(info.ki_rssize) * vmPageSize();
+#elif BOS(HAIKU)
+    // Sum the resident portion of every area the team has mapped; Haiku has
+    // no direct per-team RSS counter.
+    size_t memoryFootprint = 0;
+    area_info info;
+    ssize_t cookie = 0;
+    while (get_next_area_info(B_CURRENT_TEAM, &cookie, &info) == B_OK)
+        memoryFootprint += info.ram_size;
 #endif
 
     double percentInUse = static_cast<double>(memoryFootprint) / static_cast<double>(availableMemory());
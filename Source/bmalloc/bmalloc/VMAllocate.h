@@ -201,7 +201,15 @@ inline void vmDeallocatePhysicalPages(void* p, size_t vmSize)
 #if BOS(DARWIN)
     SYSCALL(madvise(p, vmSize, MADV_FREE_REUSABLE));
 #elif BOS(HAIKU)
+#ifdef MADV_FREE
+    // The POSIX advice calls are accepted but do not decommit anything on
+    // Haiku, which left scavenged heaps at their high-water-mark RSS. The
+    // kernel does implement MADV_FREE for anonymous areas, releasing the
+    // backing pages; ranges revive on the next touch like on FreeBSD.
+    SYSCALL(madvise(p, vmSize, MADV_FREE));
+#else
     SYSCALL(posix_madvise(p, vmSize, POSIX_MADV_DONTNEED));
+#endif
 #elif BOS(FREEBSD)
     SYSCALL(madvise(p, vmSize, MADV_FREE));
 #else
@@ -0,0 +1,370 @@
+/*
+ * Copyright (C) 2026 Haiku, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE COMPUTER, INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE COMPUTER, INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Headless benchmark runner for the PerformanceTests harnesses.
+ *
+ * Drives a BWebPage in a hidden window, loads the given harness URL,
+ * starts the run with --start (a JavaScript statement, e.g. clicking the
+ * harness' start button) and polls --probe (a JavaScript expression)
+ * until it evaluates to a number, which is taken as the score for that
+ * iteration. After --iterations runs it prints one JSON object to stdout
+ * with the individual scores, mean and standard deviation, appends the
+ * run to a local SQLite history, and compares the mean against the
+ * recent history: if it is worse by more than 5% or two standard
+ * deviations, the run is flagged as a regression and the tool exits
+ * non-zero (for nightly build scripts).
+ *
+ * Example (Speedometer 3, which exposes its result on the client):
+ *   BenchmarkRunner --name speedometer3 \
+ *       --start "document.querySelector('#home button').click()" \
+ *       --probe "window.benchmarkClient && benchmarkClient.metrics ? \
+ *                benchmarkClient.metrics.Score.mean : undefined" \
+ *       file:///boot/home/PerformanceTests/Speedometer3/index.html
+ */
+
+#include "WebPage.h"
+#include "WebSettings.h"
+#include "WebView.h"
+#include "WebViewConstants.h"
+#include "WebWindow.h"
+
+#include <Application.h>
+#include <FindDirectory.h>
+#include <MessageRunner.h>
+#include <Path.h>
+
+#include <JavaScriptCore/JSContextRef.h>
+#include <JavaScriptCore/JSStringRef.h>
+#include <JavaScriptCore/JSValueRef.h>
+
+#include <sqlite3.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <vector>
+
+const char* kApplicationSignature
+    = "application/x-vnd.WebKit-BenchmarkRunner";
+
+enum {
+    POLL_PROBE = 'poll',
+    RUN_TIMED_OUT = 'rnto'
+};
+
+// The probe is evaluated this often once the page has finished loading.
+static const bigtime_t kProbeInterval = 500000;
+
+// How many previous runs of the same benchmark the regression check
+// averages over.
+static const int kHistoryWindow = 5;
+
+
+class BenchmarkApp : public BApplication {
+public:
+    BenchmarkApp()
+        : BApplication(kApplicationSignature)
+        , fWindow(NULL)
+        , fWebView(NULL)
+        , fPollRunner(NULL)
+        , fTimeoutRunner(NULL)
+        , fName("benchmark")
+        , fIterations(5)
+        , fTimeout(600)
+        , fLowerIsBetter(false)
+        , fExitStatus(0)
+    {
+    }
+
+    void ArgvReceived(int32 argc, char** argv) override
+    {
+        for (int32 i = 1; i < argc; i++) {
+            if (!strcmp(argv[i], "--name") && i + 1 < argc)
+                fName = argv[++i];
+            else if (!strcmp(argv[i], "--start") && i + 1 < argc)
+                fStartScript = argv[++i];
+            else if (!strcmp(argv[i], "--probe") && i + 1 < argc)
+                fProbeScript = argv[++i];
+            else if (!strcmp(argv[i], "--iterations") && i + 1 < argc)
+                fIterations = atoi(argv[++i]);
+            else if (!strcmp(argv[i], "--timeout") && i + 1 < argc)
+                fTimeout = atoi(argv[++i]);
+            else if (!strcmp(argv[i], "--db") && i + 1 < argc)
+                fDatabasePath = argv[++i];
+            else if (!strcmp(argv[i], "--lower-is-better"))
+                fLowerIsBetter = true;
+            else
+                fURL = argv[i];
+        }
+    }
+
+    void ReadyToRun() override
+    {
+        if (fURL.Length() == 0 || fProbeScript.Length() == 0
+            || fIterations < 1) {
+            fprintf(stderr, "usage: BenchmarkRunner [--name NAME] "
+                "[--iterations N] [--timeout SECONDS] [--db FILE] "
+                "[--start STATEMENT] --probe EXPRESSION "
+                "[--lower-is-better] URL\n");
+            fExitStatus = 2;
+            PostMessage(B_QUIT_REQUESTED);
+            return;
+        }
+
+        BWebPage::InitializeOnce();
+        BWebPage::SetCacheModel(B_WEBKIT_CACHE_MODEL_WEB_BROWSER);
+
+        fWindow = new BWebWindow(BRect(0, 0, 1023, 767), "BenchmarkRunner",
+            B_NO_BORDER_WINDOW_LOOK, B_NORMAL_WINDOW_FEEL, 0);
+
+        fWebView = new BWebView("BenchmarkRunner");
+        fWindow->AddChild(fWebView);
+        fWindow->SetCurrentWebView(fWebView);
+        fWebView->ResizeTo(1023, 767);
+
+        fWebView->WebPage()->SetListener(BMessenger(this));
+        fWebView->WebPage()->Settings()->Apply();
+
+        // Start the looper, but keep the window hidden.
+        fWindow->Hide();
+        fWindow->Show();
+
+        fTimeoutRunner = new BMessageRunner(BMessenger(this),
+            new BMessage(RUN_TIMED_OUT), (bigtime_t)fTimeout * 1000000, 1);
+
+        startIteration();
+    }
+
+    void MessageReceived(BMessage* message) override
+    {
+        switch (message->what) {
+        case LOAD_FINISHED: {
+            // Only react to the main frame; subresource iframes finish
+            // too. The harness page is loaded once per iteration.
+            BView* view;
+            if (message->FindPointer("view", (void**)&view) != B_OK
+                || view != fWebView)
+                break;
+            if (fStartScript.Length() != 0)
+                evaluate(fStartScript.String());
+            delete fPollRunner;
+            fPollRunner = new BMessageRunner(BMessenger(this),
+                new BMessage(POLL_PROBE), kProbeInterval);
+            break;
+        }
+
+        case POLL_PROBE: {
+            double score;
+            if (!evaluateNumber(fProbeScript.String(), score))
+                break;
+            delete fPollRunner;
+            fPollRunner = NULL;
+            fScores.push_back(score);
+            if ((int)fScores.size() < fIterations)
+                startIteration();
+            else
+                finish();
+            break;
+        }
+
+        case RUN_TIMED_OUT:
+            fprintf(stderr, "BenchmarkRunner: timed out after %d seconds "
+                "(%zu of %d iterations done)\n", fTimeout, fScores.size(),
+                fIterations);
+            fExitStatus = 2;
+            PostMessage(B_QUIT_REQUESTED);
+            break;
+
+        case SSL_CERT_ERROR: {
+            // Local benchmark mirrors often use self-signed certificates.
+            BMessage reply;
+            reply.AddBool("continue", true);
+            message->SendReply(&reply);
+            break;
+        }
+
+        default:
+            BApplication::MessageReceived(message);
+            break;
+        }
+    }
+
+    int ExitStatus() const { return fExitStatus; }
+
+private:
+    void startIteration()
+    {
+        fWebView->WebPage()->MainFrame()->LoadURL(fURL.String());
+    }
+
+    JSValueRef evaluate(const char* script)
+    {
+        JSGlobalContextRef context
+            = fWebView->WebPage()->MainFrame()->GlobalContext();
+        JSStringRef scriptString = JSStringCreateWithUTF8CString(script);
+        JSValueRef result = JSEvaluateScript(context, scriptString, NULL,
+            NULL, 0, NULL);
+        JSStringRelease(scriptString);
+        return result;
+    }
+
+    bool evaluateNumber(const char* script, double& value)
+    {
+        JSGlobalContextRef context
+            = fWebView->WebPage()->MainFrame()->GlobalContext();
+        JSValueRef result = evaluate(script);
+        if (result == NULL || !JSValueIsNumber(context, result))
+            return false;
+        value = JSValueToNumber(context, result, NULL);
+        return !isnan(value);
+    }
+
+    void finish()
+    {
+        double mean = 0;
+        for (size_t i = 0; i < fScores.size(); i++)
+            mean += fScores[i];
+        mean /= fScores.size();
+
+        double variance = 0;
+        for (size_t i = 0; i < fScores.size(); i++)
+            variance += (fScores[i] - mean) * (fScores[i] - mean);
+        if (fScores.size() > 1)
+            variance /= fScores.size() - 1;
+        double stddev = sqrt(variance);
+
+        double baseline = 0;
+        bool regression = checkHistory(mean, stddev, baseline);
+
+        printf("{\"name\": \"%s\", \"url\": \"%s\", \"scores\": [",
+            fName.String(), fURL.String());
+        for (size_t i = 0; i < fScores.size(); i++)
+            printf("%s%g", i ? ", " : "", fScores[i]);
+        printf("], \"mean\": %g, \"stddev\": %g", mean, stddev);
+        if (baseline > 0)
+            printf(", \"baseline\": %g", baseline);
+        printf(", \"regression\": %s}\n", regression ? "true" : "false");
+
+        if (regression)
+            fExitStatus = 1;
+        PostMessage(B_QUIT_REQUESTED);
+    }
+
+    // Appends this run to the history database and compares its mean
+    // against the average of the previous kHistoryWindow runs. Returns
+    // true when the new mean is worse by more than 5% or more than two
+    // standard deviations, whichever is larger.
+    bool checkHistory(double mean, double stddev, double& baseline)
+    {
+        BString path = fDatabasePath;
+        if (path.Length() == 0) {
+            BPath settingsPath;
+            if (find_directory(B_USER_SETTINGS_DIRECTORY, &settingsPath)
+                != B_OK)
+                return false;
+            settingsPath.Append("WebKit/Benchmarks.db");
+            path = settingsPath.Path();
+        }
+
+        sqlite3* database;
+        if (sqlite3_open(path.String(), &database) != SQLITE_OK) {
+            fprintf(stderr, "BenchmarkRunner: cannot open history "
+                "database %s\n", path.String());
+            return false;
+        }
+        sqlite3_exec(database,
+            "CREATE TABLE IF NOT EXISTS runs ("
+            "id INTEGER PRIMARY KEY, name TEXT, timestamp INTEGER, "
+            "mean REAL, stddev REAL)", NULL, NULL, NULL);
+
+        sqlite3_stmt* statement;
+        int previousRuns = 0;
+        baseline = 0;
+        if (sqlite3_prepare_v2(database,
+            "SELECT mean FROM runs WHERE name = ? "
+            "ORDER BY timestamp DESC LIMIT ?", -1, &statement, NULL)
+            == SQLITE_OK) {
+            sqlite3_bind_text(statement, 1, fName.String(), -1,
+                SQLITE_TRANSIENT);
+            sqlite3_bind_int(statement, 2, kHistoryWindow);
+            while (sqlite3_step(statement) == SQLITE_ROW) {
+                baseline += sqlite3_column_double(statement, 0);
+                previousRuns++;
+            }
+            sqlite3_finalize(statement);
+        }
+
+        if (sqlite3_prepare_v2(database,
+            "INSERT INTO runs (name, timestamp, mean, stddev) "
+            "VALUES (?, ?, ?, ?)", -1, &statement, NULL) == SQLITE_OK) {
+            sqlite3_bind_text(statement, 1, fName.String(), -1,
+                SQLITE_TRANSIENT);
+            sqlite3_bind_int64(statement, 2, (sqlite3_int64)time(NULL));
+            sqlite3_bind_double(statement, 3, mean);
+            sqlite3_bind_double(statement, 4, stddev);
+            sqlite3_step(statement);
+            sqlite3_finalize(statement);
+        }
+        sqlite3_close(database);
+
+        if (previousRuns == 0)
+            return false;
+        baseline /= previousRuns;
+
+        double shortfall = fLowerIsBetter ? mean - baseline : baseline - mean;
+        double tolerance = fmax(baseline * 0.05, 2 * stddev);
+        return shortfall > tolerance;
+    }
+
+private:
+    BWebWindow* fWindow;
+    BWebView* fWebView;
+    BMessageRunner* fPollRunner;
+    BMessageRunner* fTimeoutRunner;
+
+    BString fName;
+    BString fURL;
+    BString fStartScript;
+    BString fProbeScript;
+    BString fDatabasePath;
+    int fIterations;
+    int fTimeout;
+    bool fLowerIsBetter;
+
+    std::vector<double> fScores;
+    int fExitStatus;
+};
+
+
+int main(int argc, char** argv)
+{
+    BenchmarkApp app;
+    app.Run();
+    return app.ExitStatus();
+}
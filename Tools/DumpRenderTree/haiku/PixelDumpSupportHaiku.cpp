@@ -53,7 +53,7 @@ RefPtr<BitmapContext> createBitmapContextFromWebView(bool, bool, bool, bool draw
     size.width = r.Width() + 1;
     size.height = r.Height() + 1;
     BBitmap* bitmap = WebCore::DumpRenderTreeClient::getOffscreen(webView);
-    return BitmapContext::createByAdoptingData(size, bitmap);
+    return BitmapContext::createForOffscreen(size, bitmap);
 }
 
 void computeSHA1HashStringForBitmapContext(BitmapContext* context, char hashString[33])
@@ -61,9 +61,11 @@ void computeSHA1HashStringForBitmapContext(BitmapContext* context, char hashStri
     if (!context || !context->m_bitmap)
         return;
 
-    BRect bounds = context->m_bitmap->Bounds();
-    int pixelsWide = bounds.Width();
-    int pixelsHigh = bounds.Height();
+    // Hash straight out of the offscreen bitmap, bounded to the viewport.
+    // The bytes fed to SHA1 are exactly the ones the old copy-then-hash
+    // path produced, so existing expected pixel hashes remain valid.
+    int pixelsWide = (int)context->m_size.width - 1;
+    int pixelsHigh = (int)context->m_size.height - 1;
     int bytesPerRow = context->m_bitmap->BytesPerRow();
     unsigned char* pixelData = (unsigned char*)context->m_bitmap->Bits();
 
@@ -86,7 +88,20 @@ void dumpBitmap(BitmapContext* context, const char* checksum)
     if (!context || !context->m_bitmap)
         return;
 
-    BBitmapStream stream(context->m_bitmap);
+    // The PNG must contain exactly the viewport, so a copy is needed here;
+    // reuse one bitmap across mismatches (it only reallocates when the
+    // test view size changes, i.e. between regular and W3C SVG tests).
+    static BBitmap* viewportCopy = NULL;
+    BRect viewportBounds(0, 0, context->m_size.width - 1,
+        context->m_size.height - 1);
+    if (viewportCopy == NULL || viewportCopy->Bounds() != viewportBounds) {
+        delete viewportCopy;
+        viewportCopy = new BBitmap(viewportBounds, 0, B_RGBA32);
+    }
+    viewportCopy->ImportBits(context->m_bitmap, BPoint(0, 0), BPoint(0, 0),
+        context->m_size);
+
+    BBitmapStream stream(viewportCopy);
     BMallocIO mio;
     status_t err = BTranslatorRoster::Default()->Translate(&stream, NULL, NULL, &mio, B_PNG_FORMAT);
     if (err == B_OK)
@@ -96,5 +111,5 @@ void dumpBitmap(BitmapContext* context, const char* checksum)
 
     BBitmap* out;
     stream.DetachBitmap(&out);
-    ASSERT(out == context->m_bitmap);
+    ASSERT(out == viewportCopy);
 }
@@ -37,29 +37,30 @@
 class BitmapContext : public RefCounted<BitmapContext> {
 public:
 
-    static RefPtr<BitmapContext> createByAdoptingData(BSize size,
+    // The context borrows the web view's live offscreen bitmap instead of
+    // copying it: hashing reads the viewport-sized part in place, so a
+    // passing pixel test costs no allocation and no full-frame copy. Only
+    // a mismatch — which needs a PNG of exactly the viewport — pays for a
+    // copy (see dumpBitmap()). The offscreen may be larger than the
+    // viewport, since the view never shrinks it; m_size bounds the part
+    // that belongs to the test. It stays valid for the duration of the
+    // dump, which runs while the view is idle between tests.
+    static RefPtr<BitmapContext> createForOffscreen(BSize size,
         BBitmap* bitmap)
     {
-		BitmapContext* context = new BitmapContext(size, bitmap);
+        BitmapContext* context = new BitmapContext(size, bitmap);
         return adoptRef(*context);
     }
 
-    ~BitmapContext()
-    {
-        delete m_bitmap;
-    }
-
-    BBitmap* m_bitmap;
+    BBitmap* m_bitmap; // Borrowed from the web view; not owned.
+    BSize m_size; // The viewport portion to hash and dump.
 
 private:
 
     BitmapContext(BSize size, BBitmap* bitmap)
+        : m_bitmap(bitmap)
+        , m_size(size)
     {
-        // The size may be smaller than the bitmap, as we only want to keep the
-        // viewport.
-        m_bitmap = new BBitmap(BRect(0, 0, size.Width() - 1, size.Height() - 1), 0,
-            B_RGBA32);
-        m_bitmap->ImportBits(bitmap, BPoint(0, 0), BPoint(0, 0), size);
     }
 };
 